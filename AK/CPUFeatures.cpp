@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CPUFeatures.h>
+#include <AK/Types.h>
+
+#if ARCH(X86_64) || ARCH(I386)
+#    include <cpuid.h>
+#endif
+
+namespace AK {
+
+static CPUFeatures detect_cpu_features()
+{
+    CPUFeatures features;
+
+#if ARCH(X86_64) || ARCH(I386)
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+        return features;
+
+    features.pclmul = (ecx & bit_PCLMUL) != 0;
+    features.ssse3 = (ecx & bit_SSSE3) != 0;
+    features.sse41 = (ecx & bit_SSE4_1) != 0;
+    features.aes = (ecx & bit_AES) != 0;
+
+    // AVX state has to be enabled by the OS (XCR0 bits 1 and 2) before we may use any YMM registers.
+    bool os_saves_ymm_state = false;
+    if ((ecx & bit_OSXSAVE) != 0 && (ecx & bit_AVX) != 0) {
+        u32 xcr0_low = 0, xcr0_high = 0;
+        asm volatile("xgetbv"
+                     : "=a"(xcr0_low), "=d"(xcr0_high)
+                     : "c"(0));
+        os_saves_ymm_state = (xcr0_low & 0b110) == 0b110;
+    }
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) {
+        features.avx2 = os_saves_ymm_state && (ebx & bit_AVX2) != 0;
+        features.sha = (ebx & bit_SHA) != 0;
+    }
+#endif
+
+    return features;
+}
+
+CPUFeatures const& cpu_features()
+{
+    static CPUFeatures const features = detect_cpu_features();
+    return features;
+}
+
+}
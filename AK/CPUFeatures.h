@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Platform.h>
+
+namespace AK {
+
+// Instruction set extensions that are detected at runtime, so that hot loops can
+// dispatch to a specialized implementation while keeping a portable fallback.
+struct CPUFeatures {
+    bool ssse3 { false };
+    bool sse41 { false };
+    bool avx2 { false };
+    bool aes { false };
+    bool pclmul { false };
+    bool sha { false };
+};
+
+CPUFeatures const& cpu_features();
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::cpu_features;
+using AK::CPUFeatures;
+#endif
@@ -60,6 +60,12 @@ public:
         ++m_size;
     }
 
+    void clear()
+    {
+        m_segments.clear();
+        m_size = 0;
+    }
+
 private:
     Vector<NonnullOwnPtr<Vector<T, segment_size>>> m_segments;
     size_t m_size { 0 };
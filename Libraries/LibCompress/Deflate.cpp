@@ -7,7 +7,6 @@
 
 #include <AK/Array.h>
 #include <AK/Assertions.h>
-#include <AK/BinarySearch.h>
 #include <AK/MemoryStream.h>
 #include <LibCompress/Deflate.h>
 #include <LibCompress/Huffman.h>
@@ -62,9 +61,13 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
     }
 
     if (non_zero_symbols == 1) { // special case - only 1 symbol
-        code.m_prefix_table[0] = PrefixTableEntry { static_cast<u16>(last_non_zero), 1u };
-        code.m_prefix_table[1] = code.m_prefix_table[0];
-        code.m_max_prefixed_code_length = 1;
+        code.m_primary_table_bits = 1;
+        code.m_max_code_length = 1;
+        TRY(code.m_decode_table.try_resize(2));
+        code.m_decode_table[0] = DecodeTableEntry { static_cast<u16>(last_non_zero), 1, 0 };
+        code.m_decode_table[1] = code.m_decode_table[0];
+        code.m_code_length_counts[1] = 1;
+        TRY(code.m_sorted_symbols.try_append(last_non_zero));
 
         if (code.m_bit_codes.size() < static_cast<size_t>(last_non_zero + 1)) {
             TRY(code.m_bit_codes.try_resize(last_non_zero + 1));
@@ -76,16 +79,8 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
         return code;
     }
 
-    struct PrefixCode {
-        u16 symbol_code { 0 };
-        u16 symbol_value { 0 };
-        u16 code_length { 0 };
-    };
-    Array<PrefixCode, 1 << CanonicalCode::max_allowed_prefixed_code_length> prefix_codes;
-    size_t number_of_prefix_codes = 0;
-
     auto next_code = 0;
-    for (size_t code_length = 1; code_length <= 15; ++code_length) {
+    for (size_t code_length = 1; code_length <= max_code_length; ++code_length) {
         next_code <<= 1;
         auto start_bit = 1 << code_length;
 
@@ -93,23 +88,12 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
             if (bytes[symbol] != code_length)
                 continue;
 
-            if (next_code > start_bit)
+            if (next_code >= start_bit)
                 return Error::from_string_literal("Failed to decode code lengths");
 
-            if (code_length <= CanonicalCode::max_allowed_prefixed_code_length) {
-                if (number_of_prefix_codes >= prefix_codes.size())
-                    return Error::from_string_literal("Invalid canonical Huffman code");
-
-                auto& prefix_code = prefix_codes[number_of_prefix_codes++];
-                prefix_code.symbol_code = next_code;
-                prefix_code.symbol_value = symbol;
-                prefix_code.code_length = code_length;
-
-                code.m_max_prefixed_code_length = code_length;
-            } else {
-                code.m_symbol_codes.append(start_bit | next_code);
-                code.m_symbol_values.append(symbol);
-            }
+            code.m_max_code_length = code_length;
+            code.m_code_length_counts[code_length]++;
+            TRY(code.m_sorted_symbols.try_append(symbol));
 
             if (code.m_bit_codes.size() < symbol + 1) {
                 TRY(code.m_bit_codes.try_resize(symbol + 1));
@@ -122,20 +106,51 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
         }
     }
 
-    if (next_code != (1 << 15))
+    if (next_code != (1 << max_code_length))
         return Error::from_string_literal("Failed to decode code lengths");
 
-    for (auto [symbol_code, symbol_value, code_length] : prefix_codes) {
-        if (code_length == 0 || code_length > CanonicalCode::max_allowed_prefixed_code_length)
-            break;
+    // The decode tables are indexed by the upcoming bits of the stream. A code that is shorter than the table index
+    // occupies every entry whose low bits match it, so that the bits following the code don't affect the lookup.
+    // Codes that don't fit the primary table share a second-level table per primary prefix, sized for the longest
+    // code with that prefix.
+    auto primary_bits = min(code.m_max_code_length, max_primary_table_bits);
+    auto primary_mask = (1u << primary_bits) - 1;
+    code.m_primary_table_bits = primary_bits;
+    TRY(code.m_decode_table.try_resize(1u << primary_bits));
+
+    Array<u8, 1 << max_primary_table_bits> longest_code_for_prefix {};
+    for (auto symbol : code.m_sorted_symbols) {
+        auto code_length = code.m_bit_code_lengths[symbol];
+        if (code_length > primary_bits) {
+            auto& longest_code = longest_code_for_prefix[code.m_bit_codes[symbol] & primary_mask];
+            longest_code = max(longest_code, code_length);
+        }
+    }
+
+    for (size_t prefix = 0; prefix <= primary_mask; ++prefix) {
+        if (longest_code_for_prefix[prefix] == 0)
+            continue;
+
+        auto subtable_bits = longest_code_for_prefix[prefix] - primary_bits;
+        code.m_decode_table[prefix] = DecodeTableEntry { static_cast<u16>(code.m_decode_table.size()), 0, static_cast<u8>(subtable_bits) };
+        TRY(code.m_decode_table.try_resize(code.m_decode_table.size() + (1u << subtable_bits)));
+    }
 
-        auto shift = code.m_max_prefixed_code_length - code_length;
-        symbol_code <<= shift;
+    for (auto symbol : code.m_sorted_symbols) {
+        auto code_length = code.m_bit_code_lengths[symbol];
+        auto bits = code.m_bit_codes[symbol];
+        DecodeTableEntry entry { symbol, static_cast<u8>(code_length), 0 };
 
-        for (size_t j = 0; j < (1u << shift); ++j) {
-            auto index = fast_reverse16(symbol_code + j, code.m_max_prefixed_code_length);
-            code.m_prefix_table[index] = PrefixTableEntry { symbol_value, code_length };
+        if (code_length <= primary_bits) {
+            for (size_t index = bits; index <= primary_mask; index += 1u << code_length)
+                code.m_decode_table[index] = entry;
+            continue;
         }
+
+        auto subtable = code.m_decode_table[bits & primary_mask];
+        auto subtable_size = 1u << subtable.subtable_bits;
+        for (size_t index = bits >> primary_bits; index < subtable_size; index += 1u << (code_length - primary_bits))
+            code.m_decode_table[subtable.value + index] = entry;
     }
 
     return code;
@@ -143,23 +158,44 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
 
 ErrorOr<u32> CanonicalCode::read_symbol(LittleEndianInputBitStream& stream) const
 {
-    auto prefix = TRY(stream.peek_bits<size_t>(m_max_prefixed_code_length));
+    // Peeking can only fail close to the end of the stream, where the next code may be shorter than the longest one.
+    auto maybe_bits = stream.peek_bits<size_t>(m_max_code_length);
+    if (maybe_bits.is_error()) [[unlikely]]
+        return read_symbol_bit_by_bit(stream);
+    auto bits = maybe_bits.value();
 
-    if (auto [symbol_value, code_length] = m_prefix_table[prefix]; code_length != 0) {
-        stream.discard_previously_peeked_bits(code_length);
-        return symbol_value;
+    auto entry = m_decode_table[bits & ((1u << m_primary_table_bits) - 1)];
+    if (entry.subtable_bits != 0)
+        entry = m_decode_table[entry.value + ((bits >> m_primary_table_bits) & ((1u << entry.subtable_bits) - 1))];
+
+    if (entry.code_length == 0)
+        return Error::from_string_literal("Symbol exceeds maximum symbol number");
+
+    stream.discard_previously_peeked_bits(entry.code_length);
+    return entry.value;
+}
+
+ErrorOr<u32> CanonicalCode::read_symbol_bit_by_bit(LittleEndianInputBitStream& stream) const
+{
+    if (m_sorted_symbols.size() == 1) {
+        TRY(stream.read_bit());
+        return m_sorted_symbols.first();
     }
 
-    auto code_bits = TRY(stream.read_bits<u16>(m_max_prefixed_code_length));
-    code_bits = fast_reverse16(code_bits, m_max_prefixed_code_length);
-    code_bits |= 1 << m_max_prefixed_code_length;
+    // Canonical codes of the same length are consecutive integers, so we only need to know where each length starts.
+    u32 code_bits = 0;
+    u32 first_code = 0;
+    size_t first_index = 0;
+    for (size_t code_length = 1; code_length <= m_max_code_length; ++code_length) {
+        code_bits |= TRY(stream.read_bit());
 
-    for (size_t i = m_max_prefixed_code_length; i < 16; ++i) {
-        size_t index;
-        if (binary_search(m_symbol_codes.span(), code_bits, &index))
-            return m_symbol_values[index];
+        auto count = m_code_length_counts[code_length];
+        if (code_bits - first_code < count)
+            return m_sorted_symbols[first_index + code_bits - first_code];
 
-        code_bits = code_bits << 1 | TRY(stream.read_bit());
+        first_index += count;
+        first_code = (first_code + count) << 1;
+        code_bits <<= 1;
     }
 
     return Error::from_string_literal("Symbol exceeds maximum symbol number");
@@ -177,36 +213,44 @@ ErrorOr<bool> DeflateDecompressor::CompressedBlock::try_read_more()
     if (m_eof == true)
         return false;
 
-    auto const symbol = TRY(m_literal_codes.read_symbol(*m_decompressor.m_input_stream));
+    auto& decompressor = m_decompressor;
+    auto& input_stream = *decompressor.m_input_stream;
 
-    if (symbol >= 286)
-        return Error::from_string_literal("Invalid deflate literal/length symbol");
+    if (decompressor.output_space() < max_back_reference_length)
+        decompressor.compact_output_window();
 
-    if (symbol < EndOfBlock) {
-        u8 byte_symbol = symbol;
-        m_decompressor.m_output_buffer.write({ &byte_symbol, sizeof(byte_symbol) });
-        return true;
-    }
+    // Decode symbols straight into the output window for as long as it has room for the longest back reference.
+    auto* output = decompressor.m_output_window.data();
+    auto const start_offset = decompressor.m_output_write_offset;
 
-    if (symbol == EndOfBlock) {
-        m_eof = true;
-        return false;
-    }
+    while (decompressor.output_space() >= max_back_reference_length) {
+        auto const symbol = TRY(m_literal_codes.read_symbol(input_stream));
 
-    if (!m_distance_codes.has_value())
-        return Error::from_string_literal("Distance codes have not been initialized");
+        if (symbol < EndOfBlock) {
+            output[decompressor.m_output_write_offset++] = symbol;
+            continue;
+        }
+
+        if (symbol == EndOfBlock) {
+            m_eof = true;
+            // Let the caller drain what we produced before it moves on to the next block.
+            return decompressor.m_output_write_offset != start_offset;
+        }
 
-    auto const length = TRY(m_decompressor.decode_length(symbol));
-    auto const distance_symbol = TRY(m_distance_codes.value().read_symbol(*m_decompressor.m_input_stream));
-    if (distance_symbol >= 30)
-        return Error::from_string_literal("Invalid deflate distance symbol");
+        if (symbol >= 286)
+            return Error::from_string_literal("Invalid deflate literal/length symbol");
 
-    auto const distance = TRY(m_decompressor.decode_distance(distance_symbol));
+        if (!m_distance_codes.has_value())
+            return Error::from_string_literal("Distance codes have not been initialized");
 
-    auto copied_length = TRY(m_decompressor.m_output_buffer.copy_from_seekback(distance, length));
+        auto const length = TRY(decompressor.decode_length(symbol));
+        auto const distance_symbol = TRY(m_distance_codes.value().read_symbol(input_stream));
+        if (distance_symbol >= 30)
+            return Error::from_string_literal("Invalid deflate distance symbol");
 
-    // TODO: What should we do if the output buffer is full?
-    VERIFY(copied_length == length);
+        auto const distance = TRY(decompressor.decode_distance(distance_symbol));
+        TRY(decompressor.copy_back_reference(distance, length));
+    }
 
     return true;
 }
@@ -225,25 +269,26 @@ ErrorOr<bool> DeflateDecompressor::UncompressedBlock::try_read_more()
     if (m_decompressor.m_input_stream->is_eof())
         return Error::from_string_literal("Input data ends in the middle of an uncompressed DEFLATE block");
 
-    Array<u8, 4096> temporary_buffer;
-    auto readable_bytes = temporary_buffer.span().trim(min(m_bytes_remaining, m_decompressor.m_output_buffer.empty_space()));
-    auto read_bytes = TRY(m_decompressor.m_input_stream->read_some(readable_bytes));
-    auto written_bytes = m_decompressor.m_output_buffer.write(read_bytes);
-    VERIFY(read_bytes.size() == written_bytes);
+    if (m_decompressor.output_space() == 0)
+        m_decompressor.compact_output_window();
+
+    auto writable_bytes = m_decompressor.m_output_window.bytes().slice(m_decompressor.m_output_write_offset, min(m_bytes_remaining, m_decompressor.output_space()));
+    auto read_bytes = TRY(m_decompressor.m_input_stream->read_some(writable_bytes));
 
-    m_bytes_remaining -= written_bytes;
+    m_decompressor.m_output_write_offset += read_bytes.size();
+    m_bytes_remaining -= read_bytes.size();
     return true;
 }
 
 ErrorOr<NonnullOwnPtr<DeflateDecompressor>> DeflateDecompressor::construct(MaybeOwned<LittleEndianInputBitStream> stream)
 {
-    auto output_buffer = TRY(CircularBuffer::create_empty(32 * KiB));
-    return TRY(adopt_nonnull_own_or_enomem(new (nothrow) DeflateDecompressor(move(stream), move(output_buffer))));
+    auto output_window = TRY(ByteBuffer::create_uninitialized(output_window_size + output_window_slack));
+    return TRY(adopt_nonnull_own_or_enomem(new (nothrow) DeflateDecompressor(move(stream), move(output_window))));
 }
 
-DeflateDecompressor::DeflateDecompressor(MaybeOwned<LittleEndianInputBitStream> stream, CircularBuffer output_buffer)
+DeflateDecompressor::DeflateDecompressor(MaybeOwned<LittleEndianInputBitStream> stream, ByteBuffer output_window)
     : m_input_stream(move(stream))
-    , m_output_buffer(move(output_buffer))
+    , m_output_window(move(output_window))
 {
 }
 
@@ -305,10 +350,10 @@ ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
         }
 
         if (m_state == State::ReadingCompressedBlock) {
-            auto nread = m_output_buffer.read(slice).size();
+            auto nread = read_from_output_window(slice);
 
             while (nread < slice.size() && TRY(m_compressed_block.try_read_more())) {
-                nread += m_output_buffer.read(slice.slice(nread)).size();
+                nread += read_from_output_window(slice.slice(nread));
             }
 
             total_read += nread;
@@ -322,10 +367,10 @@ ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
         }
 
         if (m_state == State::ReadingUncompressedBlock) {
-            auto nread = m_output_buffer.read(slice).size();
+            auto nread = read_from_output_window(slice);
 
             while (nread < slice.size() && TRY(m_uncompressed_block.try_read_more())) {
-                nread += m_output_buffer.read(slice.slice(nread)).size();
+                nread += read_from_output_window(slice.slice(nread));
             }
 
             total_read += nread;
@@ -370,31 +415,71 @@ ErrorOr<ByteBuffer> DeflateDecompressor::decompress_all(ReadonlyBytes bytes)
 
 ErrorOr<u32> DeflateDecompressor::decode_length(u32 symbol)
 {
-    if (symbol <= 264)
-        return symbol - 254;
+    VERIFY(symbol >= 257 && symbol <= 285);
 
-    if (symbol <= 284) {
-        auto extra_bits = (symbol - 261) / 4;
-        return (((symbol - 265) % 4 + 4) << extra_bits) + 3 + TRY(m_input_stream->read_bits(extra_bits));
-    }
+    auto const& [_, base_length, extra_bits] = packed_length_symbols[symbol - 257];
+    if (extra_bits == 0)
+        return base_length;
+    return base_length + TRY(m_input_stream->read_bits<u32>(extra_bits));
+}
 
-    if (symbol == 285)
-        return DeflateDecompressor::max_back_reference_length;
+ErrorOr<u32> DeflateDecompressor::decode_distance(u32 symbol)
+{
+    VERIFY(symbol <= 29);
 
-    VERIFY_NOT_REACHED();
+    auto const& [_, base_distance, extra_bits] = packed_distances[symbol];
+    if (extra_bits == 0)
+        return base_distance;
+    return base_distance + TRY(m_input_stream->read_bits<u32>(extra_bits));
 }
 
-ErrorOr<u32> DeflateDecompressor::decode_distance(u32 symbol)
+size_t DeflateDecompressor::read_from_output_window(Bytes bytes)
 {
-    if (symbol <= 3)
-        return symbol + 1;
+    auto available_bytes = m_output_window.bytes().slice(m_output_read_offset, m_output_write_offset - m_output_read_offset);
+    auto read_bytes = available_bytes.copy_trimmed_to(bytes);
+    m_output_read_offset += read_bytes;
+    return read_bytes;
+}
+
+void DeflateDecompressor::compact_output_window()
+{
+    // Keep everything that hasn't been read yet, and enough history before it for any back reference.
+    auto keep_from = min(m_output_read_offset, m_output_write_offset - min(m_output_write_offset, max_back_reference_distance));
+    if (keep_from == 0)
+        return;
+
+    auto kept_bytes = m_output_write_offset - keep_from;
+    __builtin_memmove(m_output_window.data(), m_output_window.data() + keep_from, kept_bytes);
+    m_output_read_offset -= keep_from;
+    m_output_write_offset = kept_bytes;
+}
+
+ErrorOr<void> DeflateDecompressor::copy_back_reference(size_t distance, size_t length)
+{
+    if (distance > m_output_write_offset)
+        return Error::from_string_literal("Tried a seekback copy beyond the seekback limit");
+    VERIFY(length <= output_space());
+
+    auto* destination = m_output_window.data() + m_output_write_offset;
+    auto const* source = destination - distance;
+    m_output_write_offset += length;
+
+    if (distance >= sizeof(u64)) {
+        // Every chunk only reads bytes that have already been written, even if the match overlaps itself.
+        // The last chunk may spill over the end of the match, into the slack after the window if need be.
+        for (size_t i = 0; i < length; i += sizeof(u64))
+            __builtin_memcpy(destination + i, source + i, sizeof(u64));
+        return {};
+    }
 
-    if (symbol <= 29) {
-        auto extra_bits = (symbol / 2) - 1;
-        return ((symbol % 2 + 2) << extra_bits) + 1 + TRY(m_input_stream->read_bits(extra_bits));
+    if (distance == 1) {
+        __builtin_memset(destination, *source, length);
+        return {};
     }
 
-    VERIFY_NOT_REACHED();
+    for (size_t i = 0; i < length; ++i)
+        destination[i] = source[i];
+    return {};
 }
 
 ErrorOr<void> DeflateDecompressor::decode_codes(CanonicalCode& literal_code, Optional<CanonicalCode>& distance_code)
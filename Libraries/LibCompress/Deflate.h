@@ -9,7 +9,6 @@
 
 #include <AK/BitStream.h>
 #include <AK/ByteBuffer.h>
-#include <AK/CircularBuffer.h>
 #include <AK/Endian.h>
 #include <AK/Forward.h>
 #include <AK/MaybeOwned.h>
@@ -31,19 +30,27 @@ public:
     static ErrorOr<CanonicalCode> from_bytes(ReadonlyBytes);
 
 private:
-    static constexpr size_t max_allowed_prefixed_code_length = 8;
+    ErrorOr<u32> read_symbol_bit_by_bit(LittleEndianInputBitStream&) const;
 
-    struct PrefixTableEntry {
-        u16 symbol_value { 0 };
-        u16 code_length { 0 };
+    static constexpr size_t max_code_length = 15;
+
+    // Codes of up to this many bits are resolved with a single table lookup, longer ones need a second-level table.
+    static constexpr size_t max_primary_table_bits = 10;
+
+    struct DecodeTableEntry {
+        u16 value { 0 };        // The symbol, or the index of the second-level table if subtable_bits is non-zero.
+        u8 code_length { 0 };   // Length of the whole code, zero if no code maps to this entry.
+        u8 subtable_bits { 0 }; // Number of bits after the primary ones that index into the second-level table.
     };
 
-    // Decompression - indexed by code
-    Vector<u16, 286> m_symbol_codes;
-    Vector<u16, 286> m_symbol_values;
+    // Decompression - indexed by the next (least significant bit first) bits of the stream
+    Vector<DecodeTableEntry> m_decode_table;
+    size_t m_primary_table_bits { 0 };
+    size_t m_max_code_length { 0 };
 
-    Array<PrefixTableEntry, 1 << max_allowed_prefixed_code_length> m_prefix_table {};
-    size_t m_max_prefixed_code_length { 0 };
+    // Decompression - canonical code layout, used when the stream is too short to peek a full code
+    Array<u16, max_code_length + 1> m_code_length_counts {};
+    Vector<u16, 288> m_sorted_symbols;
 
     // Compression - indexed by symbol
     // Deflate uses a maximum of 288 symbols (maximum of 32 for distances),
@@ -109,13 +116,25 @@ public:
     static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes);
 
 private:
-    DeflateDecompressor(MaybeOwned<LittleEndianInputBitStream> stream, CircularBuffer buffer);
+    DeflateDecompressor(MaybeOwned<LittleEndianInputBitStream> stream, ByteBuffer output_window);
 
     ErrorOr<u32> decode_length(u32);
     ErrorOr<u32> decode_distance(u32);
     ErrorOr<void> decode_codes(CanonicalCode& literal_code, Optional<CanonicalCode>& distance_code);
 
+    size_t output_space() const { return output_window_size - m_output_write_offset; }
+    void compact_output_window();
+    size_t read_from_output_window(Bytes);
+    ErrorOr<void> copy_back_reference(size_t distance, size_t length);
+
     static constexpr u16 max_back_reference_length = 258;
+    static constexpr size_t max_back_reference_distance = 32 * KiB;
+
+    // Decompressed data is decoded straight into a flat window, which keeps the last 32 KiB around for back
+    // references and is compacted whenever it runs out of space.
+    static constexpr size_t output_window_size = 4 * max_back_reference_distance;
+    // Back references are copied in word-sized chunks, which may write a few bytes past their end.
+    static constexpr size_t output_window_slack = sizeof(u64);
 
     bool m_read_final_block { false };
 
@@ -126,7 +145,10 @@ private:
     };
 
     MaybeOwned<LittleEndianInputBitStream> m_input_stream;
-    CircularBuffer m_output_buffer;
+
+    ByteBuffer m_output_window;
+    size_t m_output_read_offset { 0 };
+    size_t m_output_write_offset { 0 };
 };
 
 class DeflateCompressor final : public Stream {
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/JsonObject.h>
+#include <AK/LexicalPath.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/Environment.h>
+#include <LibCore/PerformanceTrace.h>
+#include <LibCore/Process.h>
+#include <LibCore/System.h>
+
+namespace Core {
+
+static void write_event(int fd, JsonObject const& event)
+{
+    // NOTE: Each event goes out in a single write to a file opened for appending, so that events from different
+    //       threads never interleave, and nothing is lost when the process is killed without a chance to flush.
+    auto line = ByteString::formatted("{}\n", event.serialized<StringBuilder>());
+    (void)System::write(fd, line.bytes());
+}
+
+static int trace_file()
+{
+    static int const fd = [] {
+        auto directory = Environment::get(PerformanceTrace::directory_environment_variable);
+        if (!directory.has_value() || directory->is_empty())
+            return -1;
+
+        auto pid = Process::current().pid();
+        auto path = LexicalPath::join(*directory, ByteString::formatted("{}.{}", pid, PerformanceTrace::file_extension));
+
+        auto fd_or_error = System::open(path.string(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+        if (fd_or_error.is_error()) {
+            warnln("Unable to open performance trace file {}: {}", path, fd_or_error.error());
+            return -1;
+        }
+
+        // Name the process in the trace, so that its spans show up as e.g. "WebContent" rather than just a PID.
+        auto process_name = Process::get_name();
+        JsonObject arguments;
+        arguments.set("name"sv, process_name.is_error() ? ByteString("???"sv) : LexicalPath::basename(process_name.value().to_byte_string()));
+
+        JsonObject event;
+        event.set("name"sv, "process_name"sv);
+        event.set("ph"sv, "M"sv);
+        event.set("pid"sv, pid);
+        event.set("args"sv, move(arguments));
+        write_event(fd_or_error.value(), event);
+
+        return fd_or_error.value();
+    }();
+    return fd;
+}
+
+static u32 current_thread_id()
+{
+    static Atomic<u32> s_next_thread_id { 1 };
+    static thread_local u32 s_thread_id = s_next_thread_id.fetch_add(1);
+    return s_thread_id;
+}
+
+bool PerformanceTrace::is_enabled()
+{
+    return trace_file() >= 0;
+}
+
+void PerformanceTrace::record_span(StringView category, StringView name, MonotonicTime start, MonotonicTime end, StringView detail)
+{
+    auto fd = trace_file();
+    if (fd < 0)
+        return;
+
+    // Chrome trace "complete" events, with timestamps and durations in microseconds.
+    JsonObject event;
+    event.set("name"sv, name);
+    event.set("cat"sv, category);
+    event.set("ph"sv, "X"sv);
+    event.set("ts"sv, start.nanoseconds() / 1000);
+    event.set("dur"sv, (end - start).to_microseconds());
+    event.set("pid"sv, Process::current().pid());
+    event.set("tid"sv, current_thread_id());
+
+    if (!detail.is_empty()) {
+        JsonObject arguments;
+        arguments.set("detail"sv, detail);
+        event.set("args"sv, move(arguments));
+    }
+
+    write_event(fd, event);
+}
+
+}
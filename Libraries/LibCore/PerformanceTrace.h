@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+
+namespace Core {
+
+// Records timestamped spans of work for performance traces (see headless-browser's --perf-trace).
+//
+// Tracing is enabled in a process when LADYBIRD_PERF_TRACE_DIRECTORY is set in its environment, which helper
+// processes inherit from the process that spawned them. Each traced process appends its spans, as one Chrome
+// trace event per line, to a file of its own in that directory. Timestamps come from the monotonic clock, so
+// spans from different processes line up with each other.
+class PerformanceTrace {
+public:
+    static constexpr StringView directory_environment_variable = "LADYBIRD_PERF_TRACE_DIRECTORY"sv;
+    static constexpr StringView file_extension = "trace"sv;
+
+    static bool is_enabled();
+
+    // `detail` ends up in the event's arguments, e.g. the URL of a resource fetch.
+    static void record_span(StringView category, StringView name, MonotonicTime start, MonotonicTime end, StringView detail = {});
+};
+
+// Records a span covering its own lifetime.
+class PerformanceTraceSpan {
+    AK_MAKE_NONCOPYABLE(PerformanceTraceSpan);
+    AK_MAKE_NONMOVABLE(PerformanceTraceSpan);
+
+public:
+    PerformanceTraceSpan(StringView category, StringView name, StringView detail = {})
+        : m_category(category)
+        , m_name(name)
+        , m_detail(detail)
+    {
+        if (PerformanceTrace::is_enabled())
+            m_start = MonotonicTime::now();
+    }
+
+    ~PerformanceTraceSpan()
+    {
+        if (m_start.has_value())
+            PerformanceTrace::record_span(m_category, m_name, *m_start, MonotonicTime::now(), m_detail);
+    }
+
+private:
+    StringView m_category;
+    StringView m_name;
+    StringView m_detail;
+    Optional<MonotonicTime> m_start;
+};
+
+}
@@ -6,41 +6,199 @@
  */
 
 #include "UnsignedBigIntegerAlgorithms.h"
+#include <AK/Vector.h>
 
 namespace Crypto {
 
+using AK::Detail::add_words;
+using AK::Detail::sub_words;
+
+// Operands of at least this many native words are split in halves, below it the schoolbook method wins.
+static constexpr size_t karatsuba_threshold = 32;
+
+/**
+ * Complexity: O(N * M)
+ * Computes result[0, size1 + size2) = left[0, size1) * right[0, size2) one native word of `left` at a time.
+ */
+static void schoolbook_multiply(NativeWord const* left, size_t size1, NativeWord const* right, size_t size2, NativeWord* result)
+{
+    __builtin_memset(result, 0, (size1 + size2) * sizeof(NativeWord));
+
+    for (size_t i = 0; i < size1; ++i) {
+        NativeWord carry = 0;
+        auto left_word = left[i];
+        for (size_t j = 0; j < size2; ++j) {
+            // Cannot overflow: (2^w - 1)^2 + 2 * (2^w - 1) == 2^2w - 1.
+            auto product = static_cast<NativeDoubleWord>(left_word) * right[j] + result[i + j] + carry;
+            result[i + j] = static_cast<NativeWord>(product);
+            carry = static_cast<NativeWord>(product >> AK::Detail::native_word_size);
+        }
+        result[i + size2] = carry;
+    }
+}
+
+// Adds addend[0, addend_size) into accumulator[0, size) and returns the carry out of the top word.
+static bool add_in_place(NativeWord* accumulator, size_t size, NativeWord const* addend, size_t addend_size)
+{
+    VERIFY(addend_size <= size);
+
+    bool carry = false;
+    size_t i = 0;
+    for (; i < addend_size; ++i)
+        accumulator[i] = add_words(accumulator[i], addend[i], carry);
+    for (; carry && i < size; ++i)
+        accumulator[i] = add_words<NativeWord>(accumulator[i], 0, carry);
+    return carry;
+}
+
+// Subtracts subtrahend[0, subtrahend_size) from accumulator[0, size) and returns the borrow out of the top word.
+static bool subtract_in_place(NativeWord* accumulator, size_t size, NativeWord const* subtrahend, size_t subtrahend_size)
+{
+    VERIFY(subtrahend_size <= size);
+
+    bool borrow = false;
+    size_t i = 0;
+    for (; i < subtrahend_size; ++i)
+        accumulator[i] = sub_words(accumulator[i], subtrahend[i], borrow);
+    for (; borrow && i < size; ++i)
+        accumulator[i] = sub_words<NativeWord>(accumulator[i], 0, borrow);
+    return borrow;
+}
+
+static size_t karatsuba_scratch_size(size_t size)
+{
+    if (size < karatsuba_threshold)
+        return 0;
+    auto half = size - size / 2 + 1;
+    return 4 * half + karatsuba_scratch_size(half);
+}
+
+/**
+ * Complexity: O(N^log2(3))
+ * Computes result[0, 2 * size) = left[0, size) * right[0, size), with
+ *     left * right = z2 * B^2 + ((left_low + left_high) * (right_low + right_high) - z2 - z0) * B + z0
+ * where z0 = left_low * right_low and z2 = left_high * right_high.
+ * `scratch` needs room for karatsuba_scratch_size(size) words.
+ */
+static void karatsuba_multiply(NativeWord const* left, NativeWord const* right, size_t size, NativeWord* result, NativeWord* scratch)
+{
+    if (size < karatsuba_threshold) {
+        schoolbook_multiply(left, size, right, size, result);
+        return;
+    }
+
+    auto low_size = size / 2;
+    auto high_size = size - low_size;
+    auto sum_size = high_size + 1;
+
+    // z0 and z2 go straight into the low and high halves of the result.
+    karatsuba_multiply(left, right, low_size, result, scratch);
+    karatsuba_multiply(left + low_size, right + low_size, high_size, result + 2 * low_size, scratch);
+
+    auto* left_sum = scratch;
+    auto* right_sum = left_sum + sum_size;
+    auto* middle = right_sum + sum_size;
+    auto* next_scratch = middle + 2 * sum_size;
+
+    __builtin_memcpy(left_sum, left + low_size, high_size * sizeof(NativeWord));
+    left_sum[high_size] = add_in_place(left_sum, high_size, left, low_size);
+    __builtin_memcpy(right_sum, right + low_size, high_size * sizeof(NativeWord));
+    right_sum[high_size] = add_in_place(right_sum, high_size, right, low_size);
+
+    karatsuba_multiply(left_sum, right_sum, sum_size, middle, next_scratch);
+    subtract_in_place(middle, 2 * sum_size, result, 2 * low_size);
+    subtract_in_place(middle, 2 * sum_size, result + 2 * low_size, 2 * high_size);
+
+    // The middle term is at most 2 * high_size + 1 words long, so it always fits above `low_size`.
+    auto carry = add_in_place(result + low_size, 2 * size - low_size, middle, 2 * sum_size);
+    VERIFY(!carry);
+}
+
+void UnsignedBigIntegerAlgorithms::to_native_words(UnsignedBigInteger const& number, Span<NativeWord> output)
+{
+    output.fill(0);
+    auto length = min(number.length(), output.size() * words_per_native_word);
+    for (size_t i = 0; i < length; ++i)
+        output[i / words_per_native_word] |= static_cast<NativeWord>(number.m_words[i]) << ((i % words_per_native_word) * UnsignedBigInteger::BITS_IN_WORD);
+}
+
+void UnsignedBigIntegerAlgorithms::from_native_words(ReadonlySpan<NativeWord> words, UnsignedBigInteger& output)
+{
+    output.set_to_0();
+    output.m_words.resize_and_keep_capacity(words.size() * words_per_native_word);
+    for (size_t i = 0; i < output.m_words.size(); ++i)
+        output.m_words[i] = static_cast<UnsignedBigInteger::Word>(words[i / words_per_native_word] >> ((i % words_per_native_word) * UnsignedBigInteger::BITS_IN_WORD));
+}
+
+void UnsignedBigIntegerAlgorithms::multiply_native_words(NativeWord const* left, size_t size1, NativeWord const* right, size_t size2, NativeWord* result)
+{
+    if (size1 < size2) {
+        swap(left, right);
+        swap(size1, size2);
+    }
+
+    if (size2 < karatsuba_threshold) {
+        schoolbook_multiply(left, size1, right, size2, result);
+        return;
+    }
+
+    // Multiply `right` by `size2`-sized chunks of `left`, so that Karatsuba always sees balanced operands.
+    Vector<NativeWord> buffer;
+    buffer.resize(size2 + 2 * size2 + karatsuba_scratch_size(size2));
+    auto* padded_chunk = buffer.data();
+    auto* product = padded_chunk + size2;
+    auto* scratch = product + 2 * size2;
+
+    __builtin_memset(result, 0, (size1 + size2) * sizeof(NativeWord));
+    for (size_t offset = 0; offset < size1; offset += size2) {
+        auto chunk_size = min(size2, size1 - offset);
+        auto const* chunk = left + offset;
+        if (chunk_size < size2) {
+            __builtin_memset(padded_chunk, 0, size2 * sizeof(NativeWord));
+            __builtin_memcpy(padded_chunk, chunk, chunk_size * sizeof(NativeWord));
+            chunk = padded_chunk;
+        }
+
+        karatsuba_multiply(chunk, right, size2, product, scratch);
+
+        auto remaining_size = size1 + size2 - offset;
+        auto carry = add_in_place(result + offset, remaining_size, product, min(2 * size2, remaining_size));
+        VERIFY(!carry);
+    }
+}
+
 /**
- * Complexity: O(N^2) where N is the number of words in the larger number
+ * Complexity: O(N * M) for small operands, O(N^log2(3)) once both operands reach the Karatsuba threshold.
  * Multiplication method:
- * An integer is equal to the sum of the powers of two
- * according to the indices of its 'on' bits.
- * So to multiple x*y, we go over each '1' bit in x (say the i'th bit),
- * and add y<<i to the result.
+ * The operands are repacked into native (64-bit where available) words, multiplied with full double-word
+ * products, and the result is unpacked back into our 32-bit words.
  */
 FLATTEN void UnsignedBigIntegerAlgorithms::multiply_without_allocation(
     UnsignedBigInteger const& left,
     UnsignedBigInteger const& right,
-    UnsignedBigInteger& temp_shift_result,
-    UnsignedBigInteger& temp_shift_plus,
-    UnsignedBigInteger& temp_shift,
     UnsignedBigInteger& output)
 {
-    output.set_to_0();
+    auto left_length = left.trimmed_length();
+    auto right_length = right.trimmed_length();
+    if (left_length == 0 || right_length == 0) {
+        output.set_to_0();
+        return;
+    }
 
-    // iterate all bits
-    for (size_t word_index = 0; word_index < left.length(); ++word_index) {
-        for (size_t bit_index = 0; bit_index < UnsignedBigInteger::BITS_IN_WORD; ++bit_index) {
-            // If the bit is off - skip over it
-            if (!(left.m_words[word_index] & (1 << bit_index)))
-                continue;
+    auto size1 = native_length(left_length);
+    auto size2 = native_length(right_length);
 
-            size_t shift_amount = word_index * UnsignedBigInteger::BITS_IN_WORD + bit_index;
+    Vector<NativeWord, 3 * STARTING_WORD_SIZE> buffer;
+    buffer.resize(size1 + size2 + (size1 + size2));
+    auto* left_words = buffer.data();
+    auto* right_words = left_words + size1;
+    auto* result_words = right_words + size2;
 
-            // output += (right << shift_amount);
-            shift_left_without_allocation(right, shift_amount, temp_shift_result, temp_shift_plus, temp_shift);
-            add_into_accumulator_without_allocation(output, temp_shift);
-        }
-    }
+    to_native_words(left, { left_words, size1 });
+    to_native_words(right, { right_words, size2 });
+    multiply_native_words(left_words, size1, right_words, size2, result_words);
+    from_native_words({ result_words, size1 + size2 }, output);
+    output.clamp_to_trimmed_length();
 }
 
 }
@@ -4,10 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CPUFeatures.h>
 #include <AK/StringBuilder.h>
 #include <LibCrypto/Cipher/AES.h>
 #include <LibCrypto/Cipher/AESTables.h>
 
+#if ARCH(X86_64)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Cipher {
 
 template<typename T>
@@ -23,6 +28,60 @@ constexpr void swap_keys(u32* keys, size_t i, size_t j)
     keys[j] = temp;
 }
 
+#if ARCH(X86_64)
+// The round keys are stored as host-order words of the big-endian key schedule, while AES-NI expects them in memory order.
+__attribute__((target("ssse3"))) static inline __m128i load_round_key(u32 const* round_key)
+{
+    auto const byte_swap_words = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(round_key)), byte_swap_words);
+}
+
+__attribute__((target("aes,ssse3"))) static void aesni_encrypt_blocks(AESCipherKey const& key, u8 const* in, u8* out, size_t count)
+{
+    auto rounds = key.rounds();
+    __m128i round_keys[15];
+    for (size_t i = 0; i <= rounds; ++i)
+        round_keys[i] = load_round_key(key.round_keys() + i * 4);
+
+    // Interleave four independent blocks to hide the latency of AESENC.
+    for (; count >= 4; count -= 4, in += 64, out += 64) {
+        auto b0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + 0)), round_keys[0]);
+        auto b1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + 16)), round_keys[0]);
+        auto b2 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + 32)), round_keys[0]);
+        auto b3 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + 48)), round_keys[0]);
+        for (size_t round = 1; round < rounds; ++round) {
+            b0 = _mm_aesenc_si128(b0, round_keys[round]);
+            b1 = _mm_aesenc_si128(b1, round_keys[round]);
+            b2 = _mm_aesenc_si128(b2, round_keys[round]);
+            b3 = _mm_aesenc_si128(b3, round_keys[round]);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0), _mm_aesenclast_si128(b0, round_keys[rounds]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_aesenclast_si128(b1, round_keys[rounds]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 32), _mm_aesenclast_si128(b2, round_keys[rounds]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 48), _mm_aesenclast_si128(b3, round_keys[rounds]));
+    }
+
+    for (; count > 0; --count, in += 16, out += 16) {
+        auto block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in)), round_keys[0]);
+        for (size_t round = 1; round < rounds; ++round)
+            block = _mm_aesenc_si128(block, round_keys[round]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_aesenclast_si128(block, round_keys[rounds]));
+    }
+}
+
+// The decryption key schedule is already reversed and run through InvMixColumns, which is exactly what AESDEC expects.
+__attribute__((target("aes,ssse3"))) static void aesni_decrypt_block(AESCipherKey const& key, u8 const* in, u8* out)
+{
+    auto rounds = key.rounds();
+    auto const* round_keys = key.round_keys();
+
+    auto block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in)), load_round_key(round_keys));
+    for (size_t round = 1; round < rounds; ++round)
+        block = _mm_aesdec_si128(block, load_round_key(round_keys + round * 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_aesdeclast_si128(block, load_round_key(round_keys + rounds * 4)));
+}
+#endif
+
 ByteString AESCipherBlock::to_byte_string() const
 {
     StringBuilder builder;
@@ -196,6 +255,13 @@ void AESCipherKey::expand_decrypt_key(ReadonlyBytes user_key, size_t bits)
 
 void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64)
+    if (cpu_features().aes) {
+        aesni_encrypt_blocks(key(), in.bytes().data(), out.bytes().data(), 1);
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -285,6 +351,13 @@ void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 
 void AESCipher::decrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64)
+    if (cpu_features().aes) {
+        aesni_decrypt_block(key(), in.bytes().data(), out.bytes().data());
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -372,6 +445,27 @@ void AESCipher::decrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
     // clang-format on
 }
 
+void AESCipher::encrypt_blocks(ReadonlyBytes in, Bytes out)
+{
+    constexpr auto block_size = AESCipherBlock::block_size();
+    VERIFY(in.size() % block_size == 0);
+    VERIFY(out.size() >= in.size());
+
+#if ARCH(X86_64)
+    if (cpu_features().aes) {
+        aesni_encrypt_blocks(key(), in.data(), out.data(), in.size() / block_size);
+        return;
+    }
+#endif
+
+    AESCipherBlock block;
+    for (size_t offset = 0; offset < in.size(); offset += block_size) {
+        block.overwrite(in.slice(offset, block_size));
+        encrypt_block(block, block);
+        block.bytes().copy_to(out.slice(offset));
+    }
+}
+
 void AESCipherBlock::overwrite(ReadonlyBytes bytes)
 {
     auto data = bytes.data();
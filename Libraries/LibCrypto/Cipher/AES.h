@@ -112,6 +112,9 @@ public:
     virtual void encrypt_block(BlockType const& in, BlockType& out) override;
     virtual void decrypt_block(BlockType const& in, BlockType& out) override;
 
+    // Encrypts a run of consecutive blocks, which lets the hardware implementation keep several blocks in flight.
+    void encrypt_blocks(ReadonlyBytes in, Bytes out);
+
     virtual ByteString class_name() const override
     {
         return "AES";
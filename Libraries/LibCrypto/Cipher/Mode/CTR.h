@@ -165,6 +165,33 @@ protected:
         size_t offset { 0 };
         auto block_size = cipher.block_size();
 
+        if constexpr (requires { cipher.encrypt_blocks(ReadonlyBytes {}, Bytes {}); }) {
+            // Ciphers that can encrypt a run of blocks at once get the counters in batches,
+            // only the trailing partial batch goes through the block-by-block loop below.
+            constexpr size_t blocks_per_batch = 8;
+            u8 counters[blocks_per_batch * T::BlockType::block_size()];
+            u8 key_stream[sizeof(counters)];
+
+            while (length >= sizeof(counters)) {
+                for (size_t i = 0; i < blocks_per_batch; ++i) {
+                    __builtin_memcpy(counters + i * block_size, iv.data(), block_size);
+                    increment(iv);
+                }
+                cipher.encrypt_blocks({ counters, sizeof(counters) }, { key_stream, sizeof(key_stream) });
+
+                VERIFY(offset + sizeof(key_stream) <= out.size());
+                if (in) {
+                    for (size_t i = 0; i < sizeof(key_stream); ++i)
+                        out[offset + i] = key_stream[i] ^ (*in)[offset + i];
+                } else {
+                    __builtin_memcpy(out.offset(offset), key_stream, sizeof(key_stream));
+                }
+
+                length -= sizeof(key_stream);
+                offset += sizeof(key_stream);
+            }
+        }
+
         while (length > 0) {
             m_cipher_block.overwrite(iv.slice(0, block_size));
 
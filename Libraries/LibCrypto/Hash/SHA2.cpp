@@ -5,9 +5,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CPUFeatures.h>
 #include <AK/Types.h>
 #include <LibCrypto/Hash/SHA2.h>
 
+#if ARCH(X86_64)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Hash {
 constexpr static auto ROTRIGHT(u32 a, size_t b) { return (a >> b) | (a << (32 - b)); }
 constexpr static auto CH(u32 x, u32 y, u32 z) { return (x & y) ^ (z & ~x); }
@@ -25,8 +30,68 @@ constexpr static auto EP1(u64 x) { return ROTRIGHT(x, 14) ^ ROTRIGHT(x, 18) ^ RO
 constexpr static auto SIGN0(u64 x) { return ROTRIGHT(x, 1) ^ ROTRIGHT(x, 8) ^ (x >> 7); }
 constexpr static auto SIGN1(u64 x) { return ROTRIGHT(x, 19) ^ ROTRIGHT(x, 61) ^ (x >> 6); }
 
+#if ARCH(X86_64)
+// Based on the SHA extensions reference flow from Intel's "New Instructions Supporting the Secure Hash Algorithm
+// on Intel Architecture Processors". SHA256RNDS2 wants the state split into ABEF and CDGH halves, and performs
+// two rounds at a time using the low two words of the message + round constant vector.
+__attribute__((target("sha,sse4.1"))) static void sha256_transform_shani(u32 (&state)[8], u8 const* data)
+{
+    auto const byte_swap_words = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    auto dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[0])), 0xB1);
+    auto hgfe = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[4])), 0x1B);
+    auto abef = _mm_alignr_epi8(dcba, hgfe, 8);
+    auto cdgh = _mm_blend_epi16(hgfe, dcba, 0xF0);
+
+    auto const abef_saved = abef;
+    auto const cdgh_saved = cdgh;
+
+    // Each message vector holds four schedule words; the vector for group g + 1 is finished (SHA256MSG2) while
+    // group g is being hashed, and the one for group g + 3 is started (SHA256MSG1).
+    __m128i message[4];
+#    pragma GCC unroll 16
+    for (size_t group = 0; group < 16; ++group) {
+        auto& current = message[group % 4];
+        if (group < 4)
+            current = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + group * 16)), byte_swap_words);
+
+        auto words = _mm_add_epi32(current, _mm_loadu_si128(reinterpret_cast<__m128i const*>(&SHA256Constants::RoundConstants[group * 4])));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, words);
+
+        if (group >= 3 && group < 15) {
+            auto& next = message[(group + 1) % 4];
+            next = _mm_add_epi32(next, _mm_alignr_epi8(current, message[(group + 3) % 4], 4));
+            next = _mm_sha256msg2_epu32(next, current);
+        }
+
+        words = _mm_shuffle_epi32(words, 0x0E);
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, words);
+
+        if (group >= 1 && group < 13) {
+            auto& previous = message[(group + 3) % 4];
+            previous = _mm_sha256msg1_epu32(previous, current);
+        }
+    }
+
+    abef = _mm_add_epi32(abef, abef_saved);
+    cdgh = _mm_add_epi32(cdgh, cdgh_saved);
+
+    auto feba = _mm_shuffle_epi32(abef, 0x1B);
+    auto dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+}
+#endif
+
 inline void SHA256::transform(u8 const* data)
 {
+#if ARCH(X86_64)
+    if (cpu_features().sha && cpu_features().sse41) {
+        sha256_transform_shani(m_state, data);
+        return;
+    }
+#endif
+
     u32 m[64];
 
     size_t i = 0;
@@ -70,13 +135,21 @@ template<size_t BlockSize, typename Callback>
 void update_buffer(u8* buffer, u8 const* input, size_t length, size_t& data_length, Callback callback)
 {
     while (length > 0) {
+        // Whole blocks are hashed straight from the input, only partial blocks go through the buffer.
+        if (data_length == 0 && length >= BlockSize) {
+            callback(input);
+            input += BlockSize;
+            length -= BlockSize;
+            continue;
+        }
+
         size_t copy_bytes = AK::min(length, BlockSize - data_length);
         __builtin_memcpy(buffer + data_length, input, copy_bytes);
         input += copy_bytes;
         length -= copy_bytes;
         data_length += copy_bytes;
         if (data_length == BlockSize) {
-            callback();
+            callback(buffer);
             data_length = 0;
         }
     }
@@ -84,8 +157,8 @@ void update_buffer(u8* buffer, u8 const* input, size_t length, size_t& data_leng
 
 void SHA256::update(u8 const* message, size_t length)
 {
-    update_buffer<BlockSize>(m_data_buffer, message, length, m_data_length, [&]() {
-        transform(m_data_buffer);
+    update_buffer<BlockSize>(m_data_buffer, message, length, m_data_length, [&](u8 const* block) {
+        transform(block);
         m_bit_length += BlockSize * 8;
     });
 }
@@ -146,25 +219,77 @@ SHA256::DigestType SHA256::peek()
     return digest;
 }
 
-inline void SHA384::transform(u8 const* data)
+#if ARCH(X86_64)
+// AVX2 has no 64-bit rotate, so the rotations of the message schedule are made of two shifts.
+__attribute__((target("avx2"))) static inline __m256i rotate_right_epi64(__m256i x, int bits)
 {
-    u64 m[80];
+    return _mm256_or_si256(_mm256_srli_epi64(x, bits), _mm256_slli_epi64(x, 64 - bits));
+}
+
+__attribute__((target("avx2"))) static inline __m256i sign0_epi64(__m256i x)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(rotate_right_epi64(x, 1), rotate_right_epi64(x, 8)), _mm256_srli_epi64(x, 7));
+}
+
+__attribute__((target("avx2"))) static inline __m256i sign1_epi64(__m256i x)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(rotate_right_epi64(x, 19), rotate_right_epi64(x, 61)), _mm256_srli_epi64(x, 6));
+}
+
+// Computes four schedule words per step. The W[i - 16], W[i - 15] and W[i - 7] terms of all four words are already
+// known, but SIGN1 depends on W[i - 2], so the upper two words have to wait for the lower two to be finished.
+__attribute__((target("avx2"))) static void sha512_message_schedule_avx2(u64 (&m)[80], u8 const* data)
+{
+    auto const byte_swap_words = _mm256_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+    for (size_t i = 0; i < 16; i += 4) {
+        auto words = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + i * 8)), byte_swap_words);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&m[i]), words);
+    }
+
+    for (size_t i = 16; i < 80; i += 4) {
+        auto words = _mm256_add_epi64(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(&m[i - 16])), sign0_epi64(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(&m[i - 15]))));
+        words = _mm256_add_epi64(words, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&m[i - 7])));
+
+        // SIGN1(0) is 0, so the lanes that aren't finished yet are left alone.
+        auto previous_words = _mm256_inserti128_si256(_mm256_setzero_si256(), _mm_loadu_si128(reinterpret_cast<__m128i const*>(&m[i - 2])), 0);
+        words = _mm256_add_epi64(words, sign1_epi64(previous_words));
+        words = _mm256_add_epi64(words, sign1_epi64(_mm256_permute2x128_si256(words, words, 0x08)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&m[i]), words);
+    }
+}
+#endif
+
+static void sha512_message_schedule(u64 (&m)[80], u8 const* data)
+{
+#if ARCH(X86_64)
+    if (cpu_features().avx2) {
+        sha512_message_schedule_avx2(m, data);
+        return;
+    }
+#endif
 
     size_t i = 0;
     for (size_t j = 0; i < 16; ++i, j += 8) {
         m[i] = ((u64)data[j] << 56) | ((u64)data[j + 1] << 48) | ((u64)data[j + 2] << 40) | ((u64)data[j + 3] << 32) | ((u64)data[j + 4] << 24) | ((u64)data[j + 5] << 16) | ((u64)data[j + 6] << 8) | (u64)data[j + 7];
     }
 
-    for (; i < Rounds; ++i) {
+    for (; i < 80; ++i) {
         m[i] = SIGN1(m[i - 2]) + m[i - 7] + SIGN0(m[i - 15]) + m[i - 16];
     }
+}
+
+inline void SHA384::transform(u8 const* data)
+{
+    u64 m[80];
+    sha512_message_schedule(m, data);
 
     auto a = m_state[0], b = m_state[1],
          c = m_state[2], d = m_state[3],
          e = m_state[4], f = m_state[5],
          g = m_state[6], h = m_state[7];
 
-    for (i = 0; i < Rounds; ++i) {
+    for (size_t i = 0; i < Rounds; ++i) {
         // Note : SHA384 uses the SHA512 constants.
         auto temp0 = h + EP1(e) + CH(e, f, g) + SHA512Constants::RoundConstants[i] + m[i];
         auto temp1 = EP0(a) + MAJ(a, b, c);
@@ -190,8 +315,8 @@ inline void SHA384::transform(u8 const* data)
 
 void SHA384::update(u8 const* message, size_t length)
 {
-    update_buffer<BlockSize>(m_data_buffer, message, length, m_data_length, [&]() {
-        transform(m_data_buffer);
+    update_buffer<BlockSize>(m_data_buffer, message, length, m_data_length, [&](u8 const* block) {
+        transform(block);
         m_bit_length += BlockSize * 8;
     });
 }
@@ -262,22 +387,14 @@ SHA384::DigestType SHA384::peek()
 inline void SHA512::transform(u8 const* data)
 {
     u64 m[80];
-
-    size_t i = 0;
-    for (size_t j = 0; i < 16; ++i, j += 8) {
-        m[i] = ((u64)data[j] << 56) | ((u64)data[j + 1] << 48) | ((u64)data[j + 2] << 40) | ((u64)data[j + 3] << 32) | ((u64)data[j + 4] << 24) | ((u64)data[j + 5] << 16) | ((u64)data[j + 6] << 8) | (u64)data[j + 7];
-    }
-
-    for (; i < Rounds; ++i) {
-        m[i] = SIGN1(m[i - 2]) + m[i - 7] + SIGN0(m[i - 15]) + m[i - 16];
-    }
+    sha512_message_schedule(m, data);
 
     auto a = m_state[0], b = m_state[1],
          c = m_state[2], d = m_state[3],
          e = m_state[4], f = m_state[5],
          g = m_state[6], h = m_state[7];
 
-    for (i = 0; i < Rounds; ++i) {
+    for (size_t i = 0; i < Rounds; ++i) {
         auto temp0 = h + EP1(e) + CH(e, f, g) + SHA512Constants::RoundConstants[i] + m[i];
         auto temp1 = EP0(a) + MAJ(a, b, c);
         h = g;
@@ -302,8 +419,8 @@ inline void SHA512::transform(u8 const* data)
 
 void SHA512::update(u8 const* message, size_t length)
 {
-    update_buffer<BlockSize>(m_data_buffer, message, length, m_data_length, [&]() {
-        transform(m_data_buffer);
+    update_buffer<BlockSize>(m_data_buffer, message, length, m_data_length, [&](u8 const* block) {
+        transform(block);
         m_bit_length += BlockSize * 8;
     });
 }
@@ -31,8 +31,11 @@ static IntegerType Power(IntegerType const& b, IntegerType const& e)
 
         // ep = ep / 2;
         ep.set_to(ep.shift_right(1));
+        if (ep < IntegerType { 1 })
+            break;
 
         // base = base * base
+        // Note: The last squaring would be the most expensive one, and its result is never used.
         base.set_to(base.multiplied_by(base));
     }
 
@@ -15,6 +15,7 @@
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/PerformanceTrace.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
@@ -241,6 +242,8 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     VERIFY(!m_collecting_garbage);
     TemporaryChange change(m_collecting_garbage, true);
 
+    Core::PerformanceTraceSpan trace_span("gc"sv, "gc"sv);
+
     Core::ElapsedTimer collection_measurement_timer;
     if (print_report)
         collection_measurement_timer.start();
@@ -7,6 +7,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PaintingSurface.h>
+#include <LibGfx/PremultipliedAlpha.h>
 #include <LibGfx/SkiaUtils.h>
 
 #include <core/SkColorSpace.h>
@@ -78,22 +79,52 @@ PaintingSurface::PaintingSurface(NonnullOwnPtr<Impl>&& impl)
 
 PaintingSurface::~PaintingSurface() = default;
 
-void PaintingSurface::read_into_bitmap(Gfx::Bitmap& bitmap)
+static bool is_canvas_to_image_data_conversion(Bitmap const& surface_bitmap, Bitmap const& bitmap)
 {
+    return surface_bitmap.format() == BitmapFormat::BGRA8888 && surface_bitmap.alpha_type() == AlphaType::Premultiplied
+        && bitmap.format() == BitmapFormat::RGBA8888 && bitmap.alpha_type() == AlphaType::Unpremultiplied;
+}
+
+void PaintingSurface::read_into_bitmap(Gfx::Bitmap& bitmap, IntPoint source_position) const
+{
+    // Raster surfaces in the canvas format are converted straight out of their pixel memory.
+    if (m_impl->bitmap && is_canvas_to_image_data_conversion(*m_impl->bitmap, bitmap)) {
+        auto source_rect = IntRect { source_position, bitmap.size() }.intersected(rect());
+        for (int y = source_rect.top(); y < source_rect.bottom(); ++y) {
+            auto const* source = m_impl->bitmap->scanline(y) + source_rect.left();
+            auto* destination = bitmap.scanline(y - source_position.y()) + (source_rect.left() - source_position.x());
+            unpremultiply_bgra8888_to_rgba8888(source, destination, source_rect.width());
+        }
+        return;
+    }
+
     auto color_type = to_skia_color_type(bitmap.format());
     auto alpha_type = bitmap.alpha_type() == Gfx::AlphaType::Premultiplied ? kPremul_SkAlphaType : kUnpremul_SkAlphaType;
     auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type);
     SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
-    m_impl->surface->readPixels(pixmap, 0, 0);
+    m_impl->surface->readPixels(pixmap, source_position.x(), source_position.y());
 }
 
-void PaintingSurface::write_from_bitmap(Gfx::Bitmap& bitmap)
+void PaintingSurface::write_from_bitmap(Gfx::Bitmap const& bitmap, IntPoint destination_position)
 {
+    if (m_impl->bitmap && is_canvas_to_image_data_conversion(*m_impl->bitmap, bitmap)) {
+        // Any snapshot of the surface has to keep the old pixels, so let Skia copy them away first if needed.
+        m_impl->surface->notifyContentWillChange(SkSurface::kRetain_ContentChangeMode);
+
+        auto destination_rect = IntRect { destination_position, bitmap.size() }.intersected(rect());
+        for (int y = destination_rect.top(); y < destination_rect.bottom(); ++y) {
+            auto const* source = bitmap.scanline(y - destination_position.y()) + (destination_rect.left() - destination_position.x());
+            auto* destination = m_impl->bitmap->scanline(y) + destination_rect.left();
+            premultiply_rgba8888_to_bgra8888(source, destination, destination_rect.width());
+        }
+        return;
+    }
+
     auto color_type = to_skia_color_type(bitmap.format());
     auto alpha_type = bitmap.alpha_type() == Gfx::AlphaType::Premultiplied ? kPremul_SkAlphaType : kUnpremul_SkAlphaType;
     auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type);
     SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
-    m_impl->surface->writePixels(pixmap, 0, 0);
+    m_impl->surface->writePixels(pixmap, destination_position.x(), destination_position.y());
 }
 
 IntSize PaintingSurface::size() const
@@ -10,6 +10,7 @@
 #include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Point.h>
 #include <LibGfx/Size.h>
 #include <LibGfx/SkiaBackendContext.h>
 
@@ -31,8 +32,10 @@ public:
     static NonnullRefPtr<PaintingSurface> wrap_metal_surface(Gfx::MetalTexture&, RefPtr<SkiaBackendContext>);
 #endif
 
-    void read_into_bitmap(Bitmap&);
-    void write_from_bitmap(Bitmap&);
+    // Copies the pixels between the surface and a bitmap, with the bitmap's top-left corner at the given surface position.
+    // Pixels outside the surface are left untouched.
+    void read_into_bitmap(Bitmap&, IntPoint source_position = {}) const;
+    void write_from_bitmap(Bitmap const&, IntPoint destination_position = {});
 
     IntSize size() const;
     IntRect rect() const;
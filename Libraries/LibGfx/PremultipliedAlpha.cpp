@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibGfx/PremultipliedAlpha.h>
+
+namespace Gfx {
+
+using AK::SIMD::f32x4;
+using AK::SIMD::u32x4;
+
+// Both kernels handle four pixels at a time with the compiler's portable vector types, which lower to SSE2 on
+// x86-64 and NEON on AArch64. The scalar tails mirror the vector arithmetic step by step.
+
+ALWAYS_INLINE static u32x4 swap_red_and_blue(u32x4 pixels)
+{
+    return (pixels & 0xff00ff00) | ((pixels >> 16) & 0xff) | ((pixels & 0xff) << 16);
+}
+
+ALWAYS_INLINE static u32x4 unpremultiply_channel(u32x4 channel, f32x4 alpha)
+{
+    // channel * 255 is exact in a float, so dividing (rather than multiplying by 255 / alpha) rounds halfway cases correctly.
+    // Valid premultiplied data never has a color channel above its alpha, but garbage in must not wrap around.
+    auto value = AK::SIMD::to_u32x4(AK::SIMD::to_f32x4(channel * 255u) / alpha + 0.5f);
+    return (value | AK::SIMD::to_u32x4(value > 255u)) & 0xff;
+}
+
+void unpremultiply_bgra8888_to_rgba8888(u32 const* source, u32* destination, size_t pixel_count)
+{
+    size_t i = 0;
+    for (; i + 4 <= pixel_count; i += 4) {
+        auto pixels = AK::SIMD::load_unaligned<u32x4>(source + i);
+        auto alpha = pixels >> 24;
+
+        // Opaque pixels only need their red and blue channels swapped.
+        if (AK::SIMD::all(alpha == 255u)) {
+            AK::SIMD::store_unaligned(destination + i, swap_red_and_blue(pixels));
+            continue;
+        }
+
+        // Fully transparent pixels have nothing to scale, dividing by one instead keeps them at zero.
+        auto divisor = AK::SIMD::to_f32x4(alpha + (AK::SIMD::to_u32x4(alpha == 0u) & 1u));
+
+        auto blue = unpremultiply_channel(pixels & 0xff, divisor);
+        auto green = unpremultiply_channel((pixels >> 8) & 0xff, divisor);
+        auto red = unpremultiply_channel((pixels >> 16) & 0xff, divisor);
+
+        AK::SIMD::store_unaligned(destination + i, red | (green << 8) | (blue << 16) | (alpha << 24));
+    }
+
+    for (; i < pixel_count; ++i) {
+        auto pixel = source[i];
+        u32 alpha = pixel >> 24;
+        auto divisor = static_cast<float>(alpha != 0 ? alpha : 1);
+        auto channel = [&](u32 shift) {
+            auto value = static_cast<u32>(static_cast<float>(((pixel >> shift) & 0xff) * 255) / divisor + 0.5f);
+            return min(value, 255u);
+        };
+        destination[i] = channel(16) | (channel(8) << 8) | (channel(0) << 16) | (alpha << 24);
+    }
+}
+
+template<typename T>
+ALWAYS_INLINE static T premultiply_channel(T channel, T alpha)
+{
+    // Exact round(channel * alpha / 255) without a division.
+    auto product = channel * alpha + 128;
+    return (product + (product >> 8)) >> 8;
+}
+
+void premultiply_rgba8888_to_bgra8888(u32 const* source, u32* destination, size_t pixel_count)
+{
+    size_t i = 0;
+    for (; i + 4 <= pixel_count; i += 4) {
+        auto pixels = AK::SIMD::load_unaligned<u32x4>(source + i);
+        u32x4 alpha = pixels >> 24;
+
+        if (AK::SIMD::all(alpha == 255u)) {
+            AK::SIMD::store_unaligned(destination + i, swap_red_and_blue(pixels));
+            continue;
+        }
+
+        auto red = premultiply_channel<u32x4>(pixels & 0xff, alpha);
+        auto green = premultiply_channel<u32x4>((pixels >> 8) & 0xff, alpha);
+        auto blue = premultiply_channel<u32x4>((pixels >> 16) & 0xff, alpha);
+
+        AK::SIMD::store_unaligned(destination + i, blue | (green << 8) | (red << 16) | (alpha << 24));
+    }
+
+    for (; i < pixel_count; ++i) {
+        auto pixel = source[i];
+        u32 alpha = pixel >> 24;
+        auto red = premultiply_channel<u32>(pixel & 0xff, alpha);
+        auto green = premultiply_channel<u32>((pixel >> 8) & 0xff, alpha);
+        auto blue = premultiply_channel<u32>((pixel >> 16) & 0xff, alpha);
+        destination[i] = blue | (green << 8) | (red << 16) | (alpha << 24);
+    }
+}
+
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Gfx {
+
+// Converts premultiplied BGRA8888 pixels into unpremultiplied RGBA8888 pixels, rounding to the nearest value.
+void unpremultiply_bgra8888_to_rgba8888(u32 const* source, u32* destination, size_t pixel_count);
+
+// Converts unpremultiplied RGBA8888 pixels into premultiplied BGRA8888 pixels, rounding to the nearest value.
+void premultiply_rgba8888_to_bgra8888(u32 const* source, u32* destination, size_t pixel_count);
+
+}
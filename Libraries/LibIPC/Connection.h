@@ -10,6 +10,7 @@
 #include <AK/Forward.h>
 #include <AK/Queue.h>
 #include <LibCore/EventReceiver.h>
+#include <LibCore/PerformanceTrace.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Forward.h>
 #include <LibIPC/Transport.h>
@@ -90,7 +91,10 @@ public:
     template<typename RequestType, typename... Args>
     NonnullOwnPtr<typename RequestType::ResponseType> send_sync(Args&&... args)
     {
-        MUST(post_message(RequestType(forward<Args>(args)...)));
+        RequestType request(forward<Args>(args)...);
+        Core::PerformanceTraceSpan trace_span("ipc"sv, "ipc-sync"sv, StringView { request.message_name(), __builtin_strlen(request.message_name()) });
+
+        MUST(post_message(request));
         auto response = wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
         VERIFY(response);
         return response.release_nonnull();
@@ -99,7 +103,10 @@ public:
     template<typename RequestType, typename... Args>
     OwnPtr<typename RequestType::ResponseType> send_sync_but_allow_failure(Args&&... args)
     {
-        if (post_message(RequestType(forward<Args>(args)...)).is_error())
+        RequestType request(forward<Args>(args)...);
+        Core::PerformanceTraceSpan trace_span("ipc"sv, "ipc-sync"sv, StringView { request.message_name(), __builtin_strlen(request.message_name()) });
+
+        if (post_message(request).is_error())
             return nullptr;
         return wait_for_specific_endpoint_message<typename RequestType::ResponseType, PeerEndpoint>();
     }
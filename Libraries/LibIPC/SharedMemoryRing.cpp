@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <AK/StdLibExtras.h>
+#include <LibCore/System.h>
+#include <LibIPC/SharedMemoryRing.h>
+
+namespace IPC {
+
+ErrorOr<SharedMemoryRing> SharedMemoryRing::create(size_t capacity)
+{
+    VERIFY(is_power_of_two(capacity));
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(sizeof(Header) + capacity));
+    new (buffer.data<void>()) Header;
+
+    return SharedMemoryRing { move(buffer), capacity };
+}
+
+ErrorOr<SharedMemoryRing> SharedMemoryRing::attach(int fd, size_t size)
+{
+    ArmedScopeGuard close_fd { [&] { (void)Core::System::close(fd); } };
+
+    if (size <= sizeof(Header) || !is_power_of_two(size - sizeof(Header)))
+        return Error::from_string_literal("Invalid shared memory ring size");
+
+    auto stat = TRY(Core::System::fstat(fd));
+    if (static_cast<size_t>(stat.st_size) < size)
+        return Error::from_string_literal("Shared memory ring is smaller than its size");
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(fd, size));
+    close_fd.disarm();
+
+    return SharedMemoryRing { move(buffer), size - sizeof(Header) };
+}
+
+SharedMemoryRing::SharedMemoryRing(Core::AnonymousBuffer buffer, size_t capacity)
+    : m_buffer(move(buffer))
+    , m_capacity(capacity)
+{
+}
+
+size_t SharedMemoryRing::write_some(ReadonlyBytes bytes)
+{
+    auto& header = this->header();
+
+    auto write_offset = header.write_offset.load(AK::MemoryOrder::memory_order_relaxed);
+    auto read_offset = header.read_offset.load(AK::MemoryOrder::memory_order_acquire);
+
+    // NOTE: The consumer is not necessarily trustworthy, so don't assume that it left the read offset in a sane state.
+    auto used = write_offset - read_offset;
+    if (used >= m_capacity)
+        return 0;
+
+    auto count = min(bytes.size(), m_capacity - static_cast<size_t>(used));
+    auto index = static_cast<size_t>(write_offset & (m_capacity - 1));
+    auto count_until_end = min(count, m_capacity - index);
+
+    memcpy(ring() + index, bytes.data(), count_until_end);
+    memcpy(ring(), bytes.data() + count_until_end, count - count_until_end);
+
+    // NOTE: This has to be sequentially consistent with the load in prepare_to_wait(), so that we either see that the
+    //       consumer is waiting in consumer_needs_wakeup(), or the consumer sees what we wrote before going to sleep.
+    header.write_offset.store(write_offset + count);
+    return count;
+}
+
+bool SharedMemoryRing::consumer_needs_wakeup()
+{
+    return header().consumer_is_waiting.exchange(false);
+}
+
+u64 SharedMemoryRing::write_offset() const
+{
+    return header().write_offset.load(AK::MemoryOrder::memory_order_acquire);
+}
+
+ErrorOr<void> SharedMemoryRing::read_until(u64 write_offset, Vector<u8>& bytes)
+{
+    auto& header = this->header();
+
+    auto read_offset = header.read_offset.load(AK::MemoryOrder::memory_order_relaxed);
+    if (write_offset - read_offset > m_capacity)
+        return Error::from_string_literal("Shared memory ring has been corrupted");
+
+    auto count = static_cast<size_t>(write_offset - read_offset);
+    if (count == 0)
+        return {};
+
+    auto index = static_cast<size_t>(read_offset & (m_capacity - 1));
+    auto count_until_end = min(count, m_capacity - index);
+
+    TRY(bytes.try_ensure_capacity(bytes.size() + count));
+    bytes.unchecked_append(ring() + index, count_until_end);
+    bytes.unchecked_append(ring(), count - count_until_end);
+
+    header.read_offset.store(write_offset, AK::MemoryOrder::memory_order_release);
+    return {};
+}
+
+bool SharedMemoryRing::prepare_to_wait()
+{
+    auto& header = this->header();
+    header.consumer_is_waiting.store(true);
+
+    return header.write_offset.load() != header.read_offset.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+}
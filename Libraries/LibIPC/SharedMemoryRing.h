@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Error.h>
+#include <AK/Platform.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
+
+namespace IPC {
+
+// A ring of bytes in shared memory, written by exactly one process and read by exactly one other.
+//
+// Unlike Core::SharedSingleProducerCircularQueue, which holds fixed-size elements, the ring holds an arbitrary stream
+// of bytes, so that IPC messages of any size can be written into it back to back, and a message larger than the ring
+// can be written piecemeal while the consumer reads it.
+//
+// Both offsets only ever grow, and are reduced modulo the (power of two) capacity to index into the ring. The producer
+// only ever modifies the write offset, and the consumer only ever modifies the read offset.
+class SharedMemoryRing {
+public:
+    static constexpr size_t default_capacity = 256 * KiB;
+
+    static ErrorOr<SharedMemoryRing> create(size_t capacity = default_capacity);
+
+    // Attaches to a ring created by another process. As the other process might not be trustworthy, this fails rather
+    // than crashes if the buffer is not large enough to be a ring.
+    static ErrorOr<SharedMemoryRing> attach(int fd, size_t size);
+
+    int fd() const { return m_buffer.fd(); }
+    size_t size() const { return m_buffer.size(); }
+
+    // Producer side.
+
+    // Writes as many of the given bytes as currently fit into the ring, and returns how many that was.
+    size_t write_some(ReadonlyBytes);
+
+    // Returns whether the consumer has gone to sleep and has to be woken up to notice newly written bytes. Only the
+    // first call after the consumer went to sleep returns true.
+    bool consumer_needs_wakeup();
+
+    // Consumer side.
+
+    // The offset up to which the producer has written so far.
+    u64 write_offset() const;
+
+    // Appends all bytes from the current read offset up to the given write offset to the given buffer.
+    ErrorOr<void> read_until(u64 write_offset, Vector<u8>&);
+
+    // Lets the producer know that it has to wake us up the next time it writes to the ring. Returns whether there is
+    // anything left to read already, in which case we should do so rather than go to sleep.
+    [[nodiscard]] bool prepare_to_wait();
+
+private:
+    struct Header {
+        AK_CACHE_ALIGNED Atomic<u64> write_offset { 0 };
+        AK_CACHE_ALIGNED Atomic<u64> read_offset { 0 };
+        AK_CACHE_ALIGNED Atomic<bool> consumer_is_waiting { true };
+    };
+
+    SharedMemoryRing(Core::AnonymousBuffer, size_t capacity);
+
+    Header& header() const { return *reinterpret_cast<Header*>(const_cast<void*>(m_buffer.data<void>())); }
+    u8* ring() { return reinterpret_cast<u8*>(m_buffer.data<void>()) + sizeof(Header); }
+
+    Core::AnonymousBuffer m_buffer;
+    size_t m_capacity { 0 };
+};
+
+}
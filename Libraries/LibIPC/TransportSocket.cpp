@@ -5,6 +5,7 @@
  */
 
 #include <AK/NonnullOwnPtr.h>
+#include <AK/Time.h>
 #include <LibCore/Socket.h>
 #include <LibCore/System.h>
 #include <LibIPC/File.h>
@@ -12,6 +13,17 @@
 
 namespace IPC {
 
+// The first thing sent through the socket by a transport that sends its messages through shared memory, along with the
+// file descriptor of its ring. No message is ever empty, so this can't be mistaken for the size of the first message.
+struct SharedMemoryRingAnnouncement {
+    u32 zero { 0 };
+    u32 ring_size { 0 };
+};
+
+// Sent through the socket of a transport that sends its messages through shared memory to wake up its peer, or to
+// carry the file descriptors of a message.
+static constexpr u8 wakeup_byte = 0;
+
 TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
     : m_socket(move(socket))
 {
@@ -22,6 +34,19 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
 
 TransportSocket::~TransportSocket() = default;
 
+ErrorOr<void> TransportSocket::send_messages_through_shared_memory()
+{
+    VERIFY(!m_outgoing_ring.has_value());
+
+    auto ring = TRY(SharedMemoryRing::create());
+
+    SharedMemoryRingAnnouncement announcement { .ring_size = static_cast<u32>(ring.size()) };
+    TRY(transfer_through_socket({ reinterpret_cast<u8 const*>(&announcement), sizeof(announcement) }, { ring.fd() }));
+
+    m_outgoing_ring = move(ring);
+    return {};
+}
+
 void TransportSocket::set_up_read_hook(Function<void()> hook)
 {
     VERIFY(m_socket->is_open());
@@ -51,6 +76,13 @@ void TransportSocket::wait_until_readable()
 }
 
 ErrorOr<void> TransportSocket::transfer(ReadonlyBytes bytes_to_write, Vector<int, 1> const& unowned_fds)
+{
+    if (m_outgoing_ring.has_value())
+        return transfer_through_shared_memory(bytes_to_write, unowned_fds);
+    return transfer_through_socket(bytes_to_write, unowned_fds);
+}
+
+ErrorOr<void> TransportSocket::transfer_through_socket(ReadonlyBytes bytes_to_write, Vector<int, 1> const& unowned_fds)
 {
     auto num_fds_to_transfer = unowned_fds.size();
     while (!bytes_to_write.is_empty()) {
@@ -99,13 +131,120 @@ ErrorOr<void> TransportSocket::transfer(ReadonlyBytes bytes_to_write, Vector<int
     return {};
 }
 
-TransportSocket::ReadResult TransportSocket::read_as_much_as_possible_without_blocking(Function<void()> schedule_shutdown)
+ErrorOr<void> TransportSocket::transfer_through_shared_memory(ReadonlyBytes bytes_to_write, Vector<int, 1> const& unowned_fds)
 {
-    u8 buffer[4096];
+    // NOTE: The file descriptors of a message have to be in the socket before the message is in the ring, see
+    //       read_as_much_as_possible_without_blocking().
+    if (!unowned_fds.is_empty())
+        TRY(transfer_through_socket({ &wakeup_byte, sizeof(wakeup_byte) }, unowned_fds));
+
+    // NOTE: Like writing to the socket, we give up if our peer doesn't make any room for a while. Otherwise two peers
+    //       that fill up each other's rings while sending on the thread that would read from them would wait forever.
+    static constexpr auto timeout = AK::Duration::from_milliseconds(100);
+    auto deadline = MonotonicTime::now_coarse() + timeout;
+
+    while (true) {
+        auto nwritten = m_outgoing_ring->write_some(bytes_to_write);
+        bytes_to_write = bytes_to_write.slice(nwritten);
+
+        if (nwritten > 0 && m_outgoing_ring->consumer_needs_wakeup())
+            TRY(wake_up_peer());
+
+        if (bytes_to_write.is_empty())
+            break;
 
+        if (nwritten > 0)
+            deadline = MonotonicTime::now_coarse() + timeout;
+        else if (MonotonicTime::now_coarse() >= deadline)
+            return Error::from_string_literal("IPC::transfer_message: Timed out waiting for room in the shared memory ring");
+
+        // The ring is full, so we have to wait for our peer to make room. Keep an eye on the socket in the meantime, so
+        // that we notice if our peer goes away instead.
+        Vector<struct pollfd, 1> pollfds;
+        pollfds.append({ .fd = m_socket->fd().value(), .events = 0, .revents = 0 });
+
+        constexpr u32 POLL_TIMEOUT_MS = 1;
+        auto result = Core::System::poll(pollfds, POLL_TIMEOUT_MS);
+
+        if (!is_open() || (!result.is_error() && (pollfds[0].revents & (POLLHUP | POLLERR)) != 0))
+            return Error::from_string_literal("IPC::transfer_message: Disconnected from peer");
+    }
+
+    return {};
+}
+
+ErrorOr<void> TransportSocket::wake_up_peer()
+{
+    auto result = m_socket->send_message({ &wakeup_byte, sizeof(wakeup_byte) }, MSG_DONTWAIT);
+    if (!result.is_error())
+        return {};
+
+    auto error = result.release_error();
+
+    // If the socket is full, our peer has plenty of unread wakeups already.
+    if (error.is_errno() && (error.code() == EAGAIN || error.code() == EWOULDBLOCK))
+        return {};
+    if (error.is_errno() && error.code() == EPIPE)
+        return Error::from_string_literal("IPC::transfer_message: Disconnected from peer");
+    return error;
+}
+
+TransportSocket::ReadResult TransportSocket::read_as_much_as_possible_without_blocking(Function<void()> schedule_shutdown)
+{
     ReadResult result;
+
+    while (true) {
+        // NOTE: A peer that sends its messages through shared memory sends their file descriptors through the socket
+        //       before writing the messages to the ring. So by looking at how far the ring has been written before we
+        //       read from the socket, we are sure to have received the file descriptors of every message we read.
+        Optional<u64> ring_write_offset;
+        if (m_incoming_ring.has_value())
+            ring_write_offset = m_incoming_ring->write_offset();
+
+        Vector<u8> bytes;
+        auto peer_is_connected = read_from_socket(bytes, result.fds);
+
+        if (m_incoming_stream == IncomingStream::Unknown) {
+            if (auto identified = identify_incoming_stream(bytes, result.fds); identified.is_error()) {
+                dbgln("TransportSocket::read_as_much_as_possible_without_blocking: {}", identified.error());
+                peer_is_connected = false;
+            }
+        }
+
+        if (m_incoming_stream != IncomingStream::SharedMemory) {
+            result.bytes.extend(move(bytes));
+
+            if (!peer_is_connected)
+                schedule_shutdown();
+            break;
+        }
+
+        // Anything our peer sent through the socket was only meant to wake us up, the messages themselves are in the ring.
+        if (ring_write_offset.has_value()) {
+            if (auto read = m_incoming_ring->read_until(*ring_write_offset, result.bytes); read.is_error()) {
+                dbgln("TransportSocket::read_as_much_as_possible_without_blocking: {}", read.error());
+                peer_is_connected = false;
+            }
+        }
+
+        if (!peer_is_connected) {
+            schedule_shutdown();
+            break;
+        }
+
+        // If our peer wrote more in the meantime, it might not have woken us up for it, so keep going until we are sure
+        // that it will.
+        if (!m_incoming_ring->prepare_to_wait())
+            break;
+    }
+
+    return result;
+}
+
+bool TransportSocket::read_from_socket(Vector<u8>& bytes, Vector<int>& fds)
+{
+    u8 buffer[4096];
     auto received_fds = Vector<int> {};
-    auto& bytes = result.bytes;
 
     while (is_open()) {
         auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
@@ -116,8 +255,7 @@ TransportSocket::ReadResult TransportSocket::read_as_much_as_possible_without_bl
             }
 
             if (error.is_syscall() && error.code() == ECONNRESET) {
-                schedule_shutdown();
-                break;
+                return false;
             }
 
             dbgln("TransportSocket::read_as_much_as_possible_without_blocking: {}", error);
@@ -127,24 +265,56 @@ TransportSocket::ReadResult TransportSocket::read_as_much_as_possible_without_bl
 
         auto bytes_read = maybe_bytes_read.release_value();
         if (bytes_read.is_empty()) {
-            schedule_shutdown();
-            break;
+            return false;
         }
 
         bytes.append(bytes_read.data(), bytes_read.size());
-        result.fds.append(received_fds.data(), received_fds.size());
+        fds.append(received_fds.data(), received_fds.size());
     }
 
-    return result;
+    return true;
+}
+
+ErrorOr<void> TransportSocket::identify_incoming_stream(Vector<u8>& bytes, Vector<int>& fds)
+{
+    m_incoming_stream_header.extend(move(bytes));
+    bytes.clear();
+
+    SharedMemoryRingAnnouncement announcement;
+    if (m_incoming_stream_header.size() < sizeof(announcement.zero))
+        return {};
+
+    memcpy(&announcement.zero, m_incoming_stream_header.data(), sizeof(announcement.zero));
+    if (announcement.zero != 0) {
+        m_incoming_stream = IncomingStream::Socket;
+        bytes = move(m_incoming_stream_header);
+        return {};
+    }
+
+    if (m_incoming_stream_header.size() < sizeof(announcement))
+        return {};
+    if (fds.is_empty())
+        return Error::from_string_literal("Shared memory ring was announced without a file descriptor");
+
+    memcpy(&announcement, m_incoming_stream_header.data(), sizeof(announcement));
+    m_incoming_ring = TRY(SharedMemoryRing::attach(fds.take_first(), announcement.ring_size));
+    m_incoming_stream = IncomingStream::SharedMemory;
+
+    // Anything that came after the announcement was only meant to wake us up.
+    m_incoming_stream_header.clear();
+    return {};
 }
 
 ErrorOr<int> TransportSocket::release_underlying_transport_for_transfer()
 {
+    // The peer of the socket would not know about our rings.
+    VERIFY(!m_outgoing_ring.has_value() && !m_incoming_ring.has_value());
     return m_socket->release_fd();
 }
 
 ErrorOr<IPC::File> TransportSocket::clone_for_transfer()
 {
+    VERIFY(!m_outgoing_ring.has_value() && !m_incoming_ring.has_value());
     return IPC::File::clone_fd(m_socket->fd().value());
 }
 
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/Optional.h>
 #include <LibCore/File.h>
+#include <LibIPC/SharedMemoryRing.h>
 
 namespace IPC {
 
@@ -18,6 +20,15 @@ public:
     explicit TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket);
     ~TransportSocket();
 
+    // Sends all further messages through a ring buffer in shared memory rather than through the socket itself, which is
+    // then only used to pass file descriptors, and to wake up the peer when it has gone to sleep waiting for messages.
+    // Only one wakeup is needed for however many messages we send until the peer gets around to reading them, so this
+    // saves a great deal of syscalls on connections that carry many small messages.
+    //
+    // This only affects messages sent by us. The peer finds out about the ring when it reads from the socket, and does
+    // not have to opt in itself. This has to be called before anything else is sent through the transport.
+    ErrorOr<void> send_messages_through_shared_memory();
+
     void set_up_read_hook(Function<void()>);
     bool is_open() const;
     void close();
@@ -38,7 +49,26 @@ public:
     ErrorOr<IPC::File> clone_for_transfer();
 
 private:
+    ErrorOr<void> transfer_through_socket(ReadonlyBytes, Vector<int, 1> const& unowned_fds);
+    ErrorOr<void> transfer_through_shared_memory(ReadonlyBytes, Vector<int, 1> const& unowned_fds);
+    ErrorOr<void> wake_up_peer();
+
+    // Returns false if our peer has closed the connection.
+    bool read_from_socket(Vector<u8>& bytes, Vector<int>& fds);
+    ErrorOr<void> identify_incoming_stream(Vector<u8>& bytes, Vector<int>& fds);
+
     NonnullOwnPtr<Core::LocalSocket> m_socket;
+
+    Optional<SharedMemoryRing> m_outgoing_ring;
+    Optional<SharedMemoryRing> m_incoming_ring;
+
+    enum class IncomingStream : u8 {
+        Unknown,
+        Socket,
+        SharedMemory,
+    };
+    IncomingStream m_incoming_stream { IncomingStream::Unknown };
+    Vector<u8> m_incoming_stream_header;
 };
 
 }
@@ -8,6 +8,8 @@
 
 #include <AK/Array.h>
 #include <AK/Function.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <LibGfx/Color.h>
 #include <LibGfx/Matrix4x4.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
@@ -154,96 +156,146 @@ public:
     template<MatrixCoefficients MC, VideoFullRangeFlag FR, Unsigned T>
     static ALWAYS_INLINE Gfx::Color convert_simple_yuv_to_rgb(T y_in, T u_in, T v_in)
     {
-        static constexpr i32 bit_depth = 8;
-        static constexpr i32 maximum_value = (1 << bit_depth) - 1;
-        static constexpr i32 one = 1 << 14;
-        static constexpr auto fraction = [](i32 numerator, i32 denominator) constexpr {
-            auto temp = static_cast<i64>(numerator) * one;
-            return static_cast<i32>(temp / denominator);
-        };
-        static constexpr auto coef = [](i32 hundred_thousandths) constexpr {
-            return fraction(hundred_thousandths, 100'000);
-        };
-        static constexpr auto multiply = [](i32 a, i32 b) constexpr {
-            return (a * b) / one;
-        };
+        constexpr auto coefficients = simple_yuv_to_rgb_coefficients<MC, FR>();
+
+        i32 y = y_in + coefficients.y_offset;
+        i32 u = u_in + coefficients.uv_offset;
+        i32 v = v_in + coefficients.uv_offset;
+
+        i32 red = y * coefficients.y_scale + v * coefficients.v_to_red;
+        i32 green = y * coefficients.y_scale + u * coefficients.u_to_green + v * coefficients.v_to_green;
+        i32 blue = y * coefficients.y_scale + u * coefficients.u_to_blue;
+
+        red = clamp(red, 0, coefficients.maximum);
+        green = clamp(green, 0, coefficients.maximum);
+        blue = clamp(blue, 0, coefficients.maximum);
+
+        // This compiles down to a bit shift if maximum_value == 255
+        red /= coefficients.divisor;
+        green /= coefficients.divisor;
+        blue /= coefficients.divisor;
 
-        struct RangeFactors {
-            i32 y_offset, y_scale;
-            i32 uv_offset, uv_scale;
+        return Gfx::Color(u8(red), u8(green), u8(blue));
+    }
+
+    // Converts a row of 8-bit YUV to full-range RGB, producing exactly the same colors as convert_simple_yuv_to_rgb(),
+    // but several pixels at a time.
+    template<MatrixCoefficients MC, VideoFullRangeFlag FR>
+    static void convert_simple_yuv_to_rgb_row(u8 const* y_row, u8 const* u_row, u8 const* v_row, Gfx::ARGB32* output, size_t width)
+    {
+        using namespace AK::SIMD;
+
+        constexpr auto coefficients = simple_yuv_to_rgb_coefficients<MC, FR>();
+        static_assert(coefficients.divisor == 1 << 14);
+
+        auto load = [](u8 const* data, i32 offset) {
+            return __builtin_convertvector(load_unaligned<u8x4>(data), i32x4) + offset;
+        };
+        auto clamp_and_scale = [&](i32x4 value) {
+            value &= value > 0;
+            auto too_large = value > coefficients.maximum;
+            value = (value & ~too_large) | (coefficients.maximum & too_large);
+            return __builtin_convertvector(value >> 14, u32x4);
         };
 
-        constexpr auto range_factors = [] {
-            RangeFactors range_factors;
+        size_t column = 0;
+        for (; column + 4 <= width; column += 4) {
+            auto y = load(y_row + column, coefficients.y_offset) * coefficients.y_scale;
+            auto u = load(u_row + column, coefficients.uv_offset);
+            auto v = load(v_row + column, coefficients.uv_offset);
 
-            i32 min = 0;
-            i32 y_max = 255;
-            i32 uv_max = 255;
+            auto red = clamp_and_scale(y + v * coefficients.v_to_red);
+            auto green = clamp_and_scale(y + u * coefficients.u_to_green + v * coefficients.v_to_green);
+            auto blue = clamp_and_scale(y + u * coefficients.u_to_blue);
 
-            if constexpr (FR == VideoFullRangeFlag::Studio) {
-                min = 16;
-                y_max = 235;
-                uv_max = 240;
-            }
+            store_unaligned(output + column, 0xff000000u | (red << 16) | (green << 8) | blue);
+        }
 
-            range_factors.y_offset = -min * maximum_value / 255;
-            range_factors.y_scale = fraction(255, y_max - min);
-            range_factors.uv_offset = -((min + uv_max) * maximum_value) / (255 * 2);
-            range_factors.uv_scale = fraction(255, uv_max - min) * 2;
+        for (; column < width; column++)
+            output[column] = convert_simple_yuv_to_rgb<MC, FR>(y_row[column], u_row[column], v_row[column]).value();
+    }
 
-            range_factors.y_scale = multiply(range_factors.y_scale, fraction(255, maximum_value));
-            range_factors.uv_scale = multiply(range_factors.uv_scale, fraction(255, maximum_value));
+private:
+    // The fixed-point factors for convert_simple_yuv_to_rgb(), with 14 fractional bits.
+    struct SimpleYUVToRGBCoefficients {
+        i32 y_offset { 0 };
+        i32 uv_offset { 0 };
+        i32 y_scale { 0 };
+        i32 v_to_red { 0 };
+        i32 u_to_green { 0 };
+        i32 v_to_green { 0 };
+        i32 u_to_blue { 0 };
+        i32 maximum { 0 };
+        i32 divisor { 0 };
+    };
+
+    template<MatrixCoefficients MC, VideoFullRangeFlag FR>
+    static constexpr SimpleYUVToRGBCoefficients simple_yuv_to_rgb_coefficients()
+    {
+        constexpr i32 bit_depth = 8;
+        constexpr i32 maximum_value = (1 << bit_depth) - 1;
+        constexpr i32 one = 1 << 14;
+        constexpr auto fraction = [](i32 numerator, i32 denominator) constexpr {
+            auto temp = static_cast<i64>(numerator) * one;
+            return static_cast<i32>(temp / denominator);
+        };
+        constexpr auto coef = [](i32 hundred_thousandths) constexpr {
+            return static_cast<i32>(static_cast<i64>(hundred_thousandths) * one / 100'000);
+        };
+        constexpr auto multiply = [](i32 a, i32 b) constexpr {
+            return (a * b) / one;
+        };
 
-            return range_factors;
-        }();
+        i32 min = 0;
+        i32 y_max = 255;
+        i32 uv_max = 255;
 
-        i32 y = y_in + range_factors.y_offset;
-        i32 u = u_in + range_factors.uv_offset;
-        i32 v = v_in + range_factors.uv_offset;
+        if constexpr (FR == VideoFullRangeFlag::Studio) {
+            min = 16;
+            y_max = 235;
+            uv_max = 240;
+        }
 
-        i32 red;
-        i32 green;
-        i32 blue;
+        SimpleYUVToRGBCoefficients coefficients;
+        coefficients.y_offset = -min * maximum_value / 255;
+        coefficients.uv_offset = -((min + uv_max) * maximum_value) / (255 * 2);
 
-        constexpr i32 y_scale = range_factors.y_scale;
-        constexpr i32 uv_scale = range_factors.uv_scale;
+        i32 y_scale = fraction(255, y_max - min);
+        i32 uv_scale = fraction(255, uv_max - min) * 2;
+        y_scale = multiply(y_scale, fraction(255, maximum_value));
+        uv_scale = multiply(uv_scale, fraction(255, maximum_value));
 
-        // The equations below will have the following effects:
+        // These factors will have the following effects:
         //  - Scale the Y, U and V values into the range 0...maximum_value*one for these fixed-point operations.
         //  - Scale the values by the color range defined by VideoFullRangeFlag.
         //  - Scale the U and V values by 2 to put them in the actual YCbCr coordinate space.
         //  - Multiply by the YCbCr coefficients to convert to RGB.
-        if constexpr (MC == MatrixCoefficients::BT709) {
-            red = y * y_scale + v * multiply(coef(78740), uv_scale);
-            green = y * y_scale + u * multiply(coef(-9366), uv_scale) + v * multiply(coef(-23406), uv_scale);
-            blue = y * y_scale + u * multiply(coef(92780), uv_scale);
-        }
-
-        if constexpr (MC == MatrixCoefficients::BT601) {
-            red = y * y_scale + v * multiply(coef(70100), uv_scale);
-            green = y * y_scale + u * multiply(coef(-17207), uv_scale) + v * multiply(coef(-35707), uv_scale);
-            blue = y * y_scale + u * multiply(coef(88600), uv_scale);
-        }
+        coefficients.y_scale = y_scale;
 
-        if constexpr (MC == MatrixCoefficients::BT2020ConstantLuminance) {
-            red = y * y_scale + v * multiply(coef(73730), uv_scale);
-            green = y * y_scale + u * multiply(coef(-8228), uv_scale) + v * multiply(coef(-28568), uv_scale);
-            blue = y * y_scale + u * multiply(coef(94070), uv_scale);
+        if constexpr (MC == MatrixCoefficients::BT709) {
+            coefficients.v_to_red = multiply(coef(78740), uv_scale);
+            coefficients.u_to_green = multiply(coef(-9366), uv_scale);
+            coefficients.v_to_green = multiply(coef(-23406), uv_scale);
+            coefficients.u_to_blue = multiply(coef(92780), uv_scale);
+        } else if constexpr (MC == MatrixCoefficients::BT601) {
+            coefficients.v_to_red = multiply(coef(70100), uv_scale);
+            coefficients.u_to_green = multiply(coef(-17207), uv_scale);
+            coefficients.v_to_green = multiply(coef(-35707), uv_scale);
+            coefficients.u_to_blue = multiply(coef(88600), uv_scale);
+        } else if constexpr (MC == MatrixCoefficients::BT2020ConstantLuminance) {
+            coefficients.v_to_red = multiply(coef(73730), uv_scale);
+            coefficients.u_to_green = multiply(coef(-8228), uv_scale);
+            coefficients.v_to_green = multiply(coef(-28568), uv_scale);
+            coefficients.u_to_blue = multiply(coef(94070), uv_scale);
+        } else {
+            VERIFY_NOT_REACHED();
         }
 
-        red = clamp(red, 0, maximum_value * one);
-        green = clamp(green, 0, maximum_value * one);
-        blue = clamp(blue, 0, maximum_value * one);
-
-        // This compiles down to a bit shift if maximum_value == 255
-        red /= fraction(maximum_value, 255);
-        green /= fraction(maximum_value, 255);
-        blue /= fraction(maximum_value, 255);
-
-        return Gfx::Color(u8(red), u8(green), u8(blue));
+        coefficients.maximum = maximum_value * one;
+        coefficients.divisor = fraction(maximum_value, 255);
+        return coefficients;
     }
 
-private:
     static constexpr size_t to_linear_size = 64;
     static constexpr size_t to_non_linear_size = 64;
 
@@ -139,8 +139,7 @@ DecoderErrorOr<Optional<AK::Duration>> MatroskaDemuxer::seek_to_most_recent_keyf
 
 DecoderErrorOr<Sample> MatroskaDemuxer::get_next_sample_for_track(Track track)
 {
-    // FIXME: This makes a copy of the sample, which shouldn't be necessary.
-    //        Matroska should make a RefPtr<ByteBuffer>, probably.
+    // NOTE: The sample's data is a view into the mapped file, so the reader must outlive it.
     auto& status = *TRY(get_track_status(track));
 
     if (!status.block.has_value() || status.frame_index >= status.block->frame_count()) {
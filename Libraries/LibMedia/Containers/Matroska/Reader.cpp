@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <AK/Function.h>
+#include <AK/InsertionSort.h>
 #include <AK/Math.h>
 #include <AK/Optional.h>
 #include <AK/Time.h>
@@ -299,7 +300,9 @@ DecoderErrorOr<Optional<size_t>> Reader::find_first_top_level_element_with_id([[
 
         m_last_top_level_element_position = streamer.position();
 
-        DECODER_TRY_ALLOC(m_seek_entries.try_set(found_element_id, found_element_position));
+        // Only remember the first element with each ID, as there are usually many clusters.
+        if (!m_seek_entries.contains(found_element_id))
+            DECODER_TRY_ALLOC(m_seek_entries.try_set(found_element_id, found_element_position));
 
         if (found_element_id == element_id) {
             position = found_element_position;
@@ -792,9 +795,6 @@ DecoderErrorOr<void> Reader::parse_cues(Streamer& streamer)
         case CUE_POINT_ID: {
             auto cue_point = TRY(parse_cue_point(streamer, TRY(segment_information()).timestamp_scale()));
 
-            // FIXME: Verify that these are already in order of timestamp. If they are not, return a corrupted error for now,
-            //        but if it turns out that Matroska files with out-of-order cue points are valid, sort them instead.
-
             for (auto track_position_entry : cue_point.track_positions()) {
                 if (!m_cues.contains(track_position_entry.key))
                     DECODER_TRY_ALLOC(m_cues.try_set(track_position_entry.key, Vector<CuePoint>()));
@@ -810,6 +810,14 @@ DecoderErrorOr<void> Reader::parse_cues(Streamer& streamer)
         return IterationDecision::Continue;
     }));
 
+    // Seeking binary searches the cue points, so make sure that they are in order. They almost always are already, in
+    // which case this doesn't need to move anything.
+    for (auto& cue_points_for_track : m_cues) {
+        insertion_sort(cue_points_for_track.value, [](auto const& a, auto const& b) {
+            return a.timestamp() < b.timestamp();
+        });
+    }
+
     return {};
 }
 
@@ -818,8 +826,11 @@ DecoderErrorOr<void> Reader::ensure_cues_are_parsed()
     if (m_cues_have_been_parsed)
         return {};
     auto position = TRY(find_first_top_level_element_with_id("Cues"sv, CUES_ID));
-    if (!position.has_value())
-        return DecoderError::corrupted("No Tracks element found"sv);
+    if (!position.has_value()) {
+        // Cues are optional, in which case we seek using the cluster index instead.
+        m_cues_have_been_parsed = true;
+        return {};
+    }
     Streamer streamer { m_data };
     TRY_READ(streamer.seek_to_position(position.release_value()));
     TRY(parse_cues(streamer));
@@ -827,55 +838,110 @@ DecoderErrorOr<void> Reader::ensure_cues_are_parsed()
     return {};
 }
 
+// Returns the index of the last entry with a timestamp at or before the given one, or the first entry if there is none.
+template<typename T, typename GetTimestamp>
+static size_t find_last_entry_at_or_before(Vector<T> const& entries, AK::Duration const& timestamp, GetTimestamp get_timestamp)
+{
+    VERIFY(!entries.is_empty());
+
+    size_t begin = 0;
+    size_t end = entries.size();
+    while (begin < end) {
+        auto middle = begin + (end - begin) / 2;
+        if (get_timestamp(entries[middle]) <= timestamp)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+
+    return begin > 0 ? begin - 1 : 0;
+}
+
 DecoderErrorOr<void> Reader::seek_to_cue_for_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
 {
     auto const& cue_points = MUST(cue_points_for_track(iterator.m_track->track_number())).release_value();
 
-    // Take a guess at where in the cues the timestamp will be and correct from there.
-    auto duration = TRY(segment_information()).duration();
-    size_t index = 0;
-    if (duration.has_value())
-        index = clamp(((timestamp.to_nanoseconds() * cue_points.size()) / TRY(segment_information()).duration()->to_nanoseconds()), 0, cue_points.size() - 1);
+    auto const& cue_point = cue_points[find_last_entry_at_or_before(cue_points, timestamp, [](auto const& cue_point) { return cue_point.timestamp(); })];
+    dbgln_if(MATROSKA_DEBUG, "Found Matroska cue point at {}ms for timestamp {}ms", cue_point.timestamp().to_milliseconds(), timestamp.to_milliseconds());
 
-    CuePoint const* prev_cue_point = &cue_points[index];
-    dbgln_if(MATROSKA_DEBUG, "Finding Matroska cue points for timestamp {}ms starting from cue at {}ms", timestamp.to_milliseconds(), prev_cue_point->timestamp().to_milliseconds());
+    TRY(iterator.seek_to_cue_point(cue_point));
+    return {};
+}
 
-    if (prev_cue_point->timestamp() == timestamp) {
-        TRY(iterator.seek_to_cue_point(*prev_cue_point));
+DecoderErrorOr<void> Reader::ensure_cluster_index_is_built()
+{
+    if (m_cluster_index_has_been_built)
         return {};
-    }
+    m_cluster_index_has_been_built = true;
 
-    if (prev_cue_point->timestamp() > timestamp) {
-        while (index > 0 && prev_cue_point->timestamp() > timestamp) {
-            prev_cue_point = &cue_points[--index];
-            dbgln_if(MATROSKA_DEBUG, "Checking previous cue point {}ms", prev_cue_point->timestamp().to_milliseconds());
-        }
-        TRY(iterator.seek_to_cue_point(*prev_cue_point));
+    auto first_cluster_position = TRY(find_first_top_level_element_with_id("Cluster"sv, CLUSTER_ELEMENT_ID));
+    if (!first_cluster_position.has_value())
         return {};
-    }
 
-    while (++index < cue_points.size()) {
-        auto const& cue_point = cue_points[index];
-        dbgln_if(MATROSKA_DEBUG, "Checking future cue point {}ms", cue_point.timestamp().to_milliseconds());
-        if (cue_point.timestamp() > timestamp)
+    auto timestamp_scale = TRY(segment_information()).timestamp_scale();
+    Streamer streamer { m_data.slice(m_segment_contents_position, m_segment_contents_size) };
+    TRY_READ(streamer.seek_to_position(first_cluster_position.value() - get_element_id_size(CLUSTER_ELEMENT_ID) - m_segment_contents_position));
+
+    // NOTE: This only reads the header of each cluster and skips over its blocks, so it touches very little of the file.
+    Vector<ClusterIndexEntry> cluster_index;
+
+    while (streamer.has_octet()) {
+        auto element_position = streamer.position();
+        auto element_id = TRY_READ(streamer.read_variable_size_integer(false));
+        auto element_size_position = streamer.position();
+        auto element_size = TRY_READ(streamer.read_variable_size_integer());
+
+        // A cluster whose size is unknown (or corrupted) can't be skipped without parsing it, so give up on indexing.
+        if (element_size > streamer.remaining()) {
+            dbgln_if(MATROSKA_DEBUG, "Element at {} extends past the end of the segment, not indexing clusters", element_position);
+            return {};
+        }
+
+        auto element_end = streamer.position() + element_size;
+
+        if (element_id == CLUSTER_ELEMENT_ID) {
+            TRY_READ(streamer.seek_to_position(element_size_position));
+            auto cluster = TRY(parse_cluster(streamer, timestamp_scale));
+
+            if (!cluster_index.is_empty() && cluster.timestamp() < cluster_index.last().timestamp) {
+                dbgln_if(MATROSKA_DEBUG, "Cluster at {} is out of order, not indexing clusters", element_position);
+                return {};
+            }
+            DECODER_TRY_ALLOC(cluster_index.try_append({ cluster.timestamp(), element_position }));
+        }
+
+        if (element_end >= m_segment_contents_size)
             break;
-        prev_cue_point = &cue_point;
+        TRY_READ(streamer.seek_to_position(element_end));
     }
 
-    TRY(iterator.seek_to_cue_point(*prev_cue_point));
+    dbgln_if(MATROSKA_DEBUG, "Indexed {} clusters", cluster_index.size());
+    m_cluster_index = move(cluster_index);
     return {};
 }
 
-static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+// Searches for the last keyframe at or before the given timestamp, starting from the iterator's position. If one is
+// found, the iterator is left pointing at it, otherwise it is left where it was.
+static DecoderErrorOr<bool> search_clusters_for_keyframe_before_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
 {
 #if MATROSKA_DEBUG
     size_t inter_frames_count;
 #endif
     Optional<SampleIterator> last_keyframe;
+    auto search_iterator = iterator;
 
     while (true) {
-        SampleIterator rewind_iterator = iterator;
-        auto block = TRY(iterator.next_block());
+        SampleIterator rewind_iterator = search_iterator;
+        auto block_or_error = search_iterator.next_block();
+        if (block_or_error.is_error()) {
+            if (block_or_error.error().category() == DecoderErrorCategory::EndOfStream)
+                break;
+            return block_or_error.release_error();
+        }
+        auto block = block_or_error.release_value();
+
+        if (block.timestamp() > timestamp)
+            break;
 
         if (block.only_keyframes()) {
             last_keyframe.emplace(rewind_iterator);
@@ -884,22 +950,37 @@ static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(Sample
 #endif
         }
 
-        if (block.timestamp() > timestamp)
-            break;
-
 #if MATROSKA_DEBUG
         inter_frames_count++;
 #endif
     }
 
-    if (last_keyframe.has_value()) {
+    if (!last_keyframe.has_value())
+        return false;
+
 #if MATROSKA_DEBUG
-        dbgln("Seeked to a keyframe with {} inter frames to skip", inter_frames_count);
+    dbgln("Seeked to a keyframe with {} inter frames to skip", inter_frames_count);
 #endif
-        iterator = last_keyframe.release_value();
-    }
+    iterator = last_keyframe.release_value();
+    return true;
+}
 
-    return {};
+DecoderErrorOr<void> Reader::seek_to_cluster_for_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+{
+    VERIFY(!m_cluster_index.is_empty());
+
+    // The keyframe we're looking for is usually in the last cluster that starts before the timestamp, but if that
+    // cluster has no keyframes in our track, we have to look in the ones before it. If even the first cluster has none
+    // before the timestamp, we start decoding from the beginning of the first cluster.
+    auto index = find_last_entry_at_or_before(m_cluster_index, timestamp, [](auto const& entry) { return entry.timestamp; });
+    while (true) {
+        dbgln_if(MATROSKA_DEBUG, "Searching cluster at {}ms for a keyframe before {}ms", m_cluster_index[index].timestamp.to_milliseconds(), timestamp.to_milliseconds());
+        TRY(iterator.seek_to_cluster(m_cluster_index[index].position));
+
+        if (TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp)) || index == 0)
+            return {};
+        index--;
+    }
 }
 
 DecoderErrorOr<bool> Reader::has_cues_for_track(u64 track_number)
@@ -916,11 +997,15 @@ DecoderErrorOr<SampleIterator> Reader::seek_to_random_access_point(SampleIterato
         return iterator;
     }
 
+    TRY(ensure_cluster_index_is_built());
+    if (!m_cluster_index.is_empty()) {
+        TRY(seek_to_cluster_for_timestamp(iterator, timestamp));
+        return iterator;
+    }
+
     if (!iterator.last_timestamp().has_value() || timestamp < iterator.last_timestamp().value()) {
         // If the timestamp is before the iterator's current position, then we need to start from the beginning of the Segment.
         iterator = TRY(create_sample_iterator(iterator.m_track->track_number()));
-        TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp));
-        return iterator;
     }
 
     TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp));
@@ -976,21 +1061,30 @@ DecoderErrorOr<Block> SampleIterator::next_block()
     return DecoderError::with_description(DecoderErrorCategory::EndOfStream, "End of stream"sv);
 }
 
-DecoderErrorOr<void> SampleIterator::seek_to_cue_point(CuePoint const& cue_point)
+DecoderErrorOr<void> SampleIterator::seek_to_cluster(size_t position)
 {
-    // This is a private function. The position getter can return optional, but the caller should already know that this track has a position.
-    auto const& cue_position = cue_point.position_for_track(m_track->track_number()).release_value();
     Streamer streamer { m_data };
-    TRY_READ(streamer.seek_to_position(cue_position.cluster_position()));
+    TRY_READ(streamer.seek_to_position(position));
 
     auto element_id = TRY_READ(streamer.read_variable_size_integer(false));
     if (element_id != CLUSTER_ELEMENT_ID)
-        return DecoderError::corrupted("Cue point's cluster position didn't point to a cluster"sv);
+        return DecoderError::corrupted("Cluster position didn't point to a cluster"sv);
 
     m_current_cluster = TRY(parse_cluster(streamer, m_segment_timestamp_scale));
-    dbgln_if(MATROSKA_DEBUG, "SampleIterator set to cue point at timestamp {}ms", m_current_cluster->timestamp().to_milliseconds());
+    dbgln_if(MATROSKA_DEBUG, "SampleIterator set to cluster at timestamp {}ms", m_current_cluster->timestamp().to_milliseconds());
+
+    m_position = streamer.position();
+    m_last_timestamp = m_current_cluster->timestamp();
+    return {};
+}
+
+DecoderErrorOr<void> SampleIterator::seek_to_cue_point(CuePoint const& cue_point)
+{
+    // This is a private function. The position getter can return optional, but the caller should already know that this track has a position.
+    auto const& cue_position = cue_point.position_for_track(m_track->track_number()).release_value();
+    TRY(seek_to_cluster(cue_position.cluster_position()));
 
-    m_position = streamer.position() + cue_position.block_offset();
+    m_position += cue_position.block_offset();
     m_last_timestamp = cue_point.timestamp();
     return {};
 }
@@ -60,6 +60,9 @@ private:
     DecoderErrorOr<void> ensure_cues_are_parsed();
     DecoderErrorOr<void> seek_to_cue_for_timestamp(SampleIterator&, AK::Duration const&);
 
+    DecoderErrorOr<void> ensure_cluster_index_is_built();
+    DecoderErrorOr<void> seek_to_cluster_for_timestamp(SampleIterator&, AK::Duration const&);
+
     RefPtr<Core::SharedMappedFile> m_mapped_file;
     ReadonlyBytes m_data;
 
@@ -78,6 +81,16 @@ private:
     // The vectors must be sorted by timestamp at all times.
     HashMap<u64, Vector<CuePoint>> m_cues;
     bool m_cues_have_been_parsed { false };
+
+    struct ClusterIndexEntry {
+        AK::Duration timestamp;
+        size_t position { 0 };
+    };
+
+    // The timestamps and positions within the segment of all clusters, used to seek in tracks that have no cues. This
+    // is sorted by timestamp, and empty if the clusters can't be indexed, e.g. because their size is unknown.
+    Vector<ClusterIndexEntry> m_cluster_index;
+    bool m_cluster_index_has_been_built { false };
 };
 
 class SampleIterator {
@@ -99,6 +112,7 @@ private:
     {
     }
 
+    DecoderErrorOr<void> seek_to_cluster(size_t position);
     DecoderErrorOr<void> seek_to_cue_point(CuePoint const& cue_point);
 
     RefPtr<Core::SharedMappedFile> m_file;
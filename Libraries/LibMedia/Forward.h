@@ -15,5 +15,6 @@ class Sample;
 class Track;
 class VideoDecoder;
 class VideoFrame;
+class VideoFramePool;
 
 }
@@ -44,10 +44,11 @@ DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> PlaybackManager::from_data(Readon
     return create(move(demuxer));
 }
 
-PlaybackManager::PlaybackManager(NonnullOwnPtr<Demuxer>& demuxer, Track video_track, NonnullOwnPtr<VideoDecoder>&& decoder, VideoFrameQueue&& frame_queue)
+PlaybackManager::PlaybackManager(NonnullOwnPtr<Demuxer>& demuxer, Track video_track, NonnullOwnPtr<VideoDecoder>&& decoder, VideoFrameQueue&& frame_queue, NonnullRefPtr<VideoFramePool> frame_pool)
     : m_demuxer(move(demuxer))
     , m_selected_video_track(video_track)
     , m_frame_queue(move(frame_queue))
+    , m_frame_pool(move(frame_pool))
     , m_decoder(move(decoder))
     , m_decode_wait_condition(m_decode_wait_mutex)
 {
@@ -132,8 +133,10 @@ void PlaybackManager::dispatch_decoder_error(DecoderError error)
     }
 }
 
-void PlaybackManager::dispatch_new_frame(RefPtr<Gfx::Bitmap> frame)
+void PlaybackManager::dispatch_new_frame(NonnullRefPtr<VideoFramePool::Surface> frame)
 {
+    m_frame_pool->present(frame);
+
     if (on_video_frame)
         on_video_frame(move(frame));
 }
@@ -146,7 +149,7 @@ bool PlaybackManager::dispatch_frame_queue_item(FrameQueueItem&& item)
     }
 
     dbgln_if(PLAYBACK_MANAGER_DEBUG, "Sent frame for presentation with timestamp {}ms, late by {}ms", item.timestamp().to_milliseconds(), (current_playback_time() - item.timestamp()).to_milliseconds());
-    dispatch_new_frame(item.bitmap());
+    dispatch_new_frame(item.surface());
     return false;
 }
 
@@ -267,12 +270,18 @@ void PlaybackManager::decode_and_queue_one_sample()
                 break;
             }
 
-            auto bitmap_result = decoded_frame->to_bitmap();
+            auto convert_frame = [&]() -> DecoderErrorOr<NonnullRefPtr<VideoFramePool::Surface>> {
+                auto surface = TRY(m_frame_pool->acquire_surface(decoded_frame->size().to_type<int>()));
+                TRY(decoded_frame->output_to_bitmap(surface->bitmap()));
+                return surface;
+            };
+
+            auto surface_result = convert_frame();
 
-            if (bitmap_result.is_error())
-                item_to_enqueue = FrameQueueItem::error_marker(bitmap_result.release_error(), decoded_frame->timestamp());
+            if (surface_result.is_error())
+                item_to_enqueue = FrameQueueItem::error_marker(surface_result.release_error(), decoded_frame->timestamp());
             else
-                item_to_enqueue = FrameQueueItem::frame(bitmap_result.release_value(), decoded_frame->timestamp());
+                item_to_enqueue = FrameQueueItem::frame(surface_result.release_value(), decoded_frame->timestamp());
             break;
         }
     }
@@ -712,7 +721,8 @@ DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> PlaybackManager::create(NonnullOw
     auto codec_initialization_data = TRY(demuxer->get_codec_initialization_data_for_track(track));
     NonnullOwnPtr<VideoDecoder> decoder = TRY(FFmpeg::FFmpegVideoDecoder::try_create(codec_id, codec_initialization_data));
     auto frame_queue = DECODER_TRY_ALLOC(VideoFrameQueue::create());
-    auto playback_manager = DECODER_TRY_ALLOC(try_make<PlaybackManager>(demuxer, track, move(decoder), move(frame_queue)));
+    auto frame_pool = DECODER_TRY_ALLOC(VideoFramePool::create());
+    auto playback_manager = DECODER_TRY_ALLOC(try_make<PlaybackManager>(demuxer, track, move(decoder), move(frame_queue), move(frame_pool)));
 
     playback_manager->m_state_update_timer = Core::Timer::create_single_shot(0, [&self = *playback_manager] { self.timer_callback(); });
 
@@ -12,9 +12,9 @@
 #include <AK/Queue.h>
 #include <AK/Time.h>
 #include <LibCore/SharedCircularQueue.h>
-#include <LibGfx/Bitmap.h>
 #include <LibMedia/Containers/Matroska/Document.h>
 #include <LibMedia/Demuxer.h>
+#include <LibMedia/VideoFramePool.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
@@ -38,9 +38,9 @@ public:
         Error,
     };
 
-    static FrameQueueItem frame(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
+    static FrameQueueItem frame(NonnullRefPtr<VideoFramePool::Surface> surface, AK::Duration timestamp)
     {
-        return FrameQueueItem(move(bitmap), timestamp);
+        return FrameQueueItem(move(surface), timestamp);
     }
 
     static FrameQueueItem error_marker(DecoderError&& error, AK::Duration timestamp)
@@ -48,8 +48,8 @@ public:
         return FrameQueueItem(move(error), timestamp);
     }
 
-    bool is_frame() const { return m_data.has<RefPtr<Gfx::Bitmap>>(); }
-    RefPtr<Gfx::Bitmap> bitmap() const { return m_data.get<RefPtr<Gfx::Bitmap>>(); }
+    bool is_frame() const { return m_data.has<NonnullRefPtr<VideoFramePool::Surface>>(); }
+    NonnullRefPtr<VideoFramePool::Surface> surface() const { return m_data.get<NonnullRefPtr<VideoFramePool::Surface>>(); }
     AK::Duration timestamp() const { return m_timestamp; }
 
     bool is_error() const { return m_data.has<DecoderError>(); }
@@ -71,8 +71,8 @@ public:
     }
 
 private:
-    FrameQueueItem(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
-        : m_data(move(bitmap))
+    FrameQueueItem(NonnullRefPtr<VideoFramePool::Surface> surface, AK::Duration timestamp)
+        : m_data(move(surface))
         , m_timestamp(timestamp)
     {
         VERIFY(m_timestamp != no_timestamp);
@@ -84,7 +84,7 @@ private:
     {
     }
 
-    Variant<Empty, RefPtr<Gfx::Bitmap>, DecoderError> m_data { Empty() };
+    Variant<Empty, NonnullRefPtr<VideoFramePool::Surface>, DecoderError> m_data { Empty() };
     AK::Duration m_timestamp { no_timestamp };
 };
 
@@ -116,7 +116,7 @@ public:
 
     static DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> from_data(ReadonlyBytes data);
 
-    PlaybackManager(NonnullOwnPtr<Demuxer>& demuxer, Track video_track, NonnullOwnPtr<VideoDecoder>&& decoder, VideoFrameQueue&& frame_queue);
+    PlaybackManager(NonnullOwnPtr<Demuxer>& demuxer, Track video_track, NonnullOwnPtr<VideoDecoder>&& decoder, VideoFrameQueue&& frame_queue, NonnullRefPtr<VideoFramePool> frame_pool);
     ~PlaybackManager();
 
     void resume_playback();
@@ -138,7 +138,10 @@ public:
     AK::Duration current_playback_time();
     AK::Duration duration();
 
-    Function<void(RefPtr<Gfx::Bitmap>)> on_video_frame;
+    // The frame pool that decoded frames are converted into. The surface passed to on_video_frame is its presented surface.
+    VideoFramePool& frame_pool() { return m_frame_pool; }
+
+    Function<void(NonnullRefPtr<VideoFramePool::Surface>)> on_video_frame;
     Function<void()> on_playback_state_change;
     Function<void(DecoderError)> on_decoder_error;
     Function<void(Error)> on_fatal_playback_error;
@@ -167,7 +170,7 @@ private:
     void decode_and_queue_one_sample();
 
     void dispatch_decoder_error(DecoderError error);
-    void dispatch_new_frame(RefPtr<Gfx::Bitmap> frame);
+    void dispatch_new_frame(NonnullRefPtr<VideoFramePool::Surface> frame);
     // Returns whether we changed playback states. If so, any PlaybackStateHandler processing must cease.
     [[nodiscard]] bool dispatch_frame_queue_item(FrameQueueItem&&);
     void dispatch_state_change();
@@ -180,6 +183,7 @@ private:
     Track m_selected_video_track;
 
     VideoFrameQueue m_frame_queue;
+    NonnullRefPtr<VideoFramePool> m_frame_pool;
 
     RefPtr<Core::Timer> m_state_update_timer;
     unsigned m_decoding_buffer_time_ms = 16;
@@ -6,7 +6,9 @@
 
 #include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
+#include <LibCore/System.h>
 #include <LibMedia/Color/ColorConverter.h>
+#include <LibThreading/WorkerThread.h>
 
 #include "VideoFrame.h"
 
@@ -102,76 +104,135 @@ ALWAYS_INLINE void interpolate_row(u32 const row, u32 const width, T const* plan
     }
 }
 
-template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T, typename Convert>
-ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
+// Converts the rows of the bitmap from first_row up to (but not including) end_row. If the chroma planes are subsampled
+// vertically, first_row must be even.
+template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T, typename ConvertRow>
+static DecoderErrorOr<void> convert_rows_to_bitmap_subsampled(ConvertRow const& convert_row, u32 const width, u32 const first_row, u32 const end_row, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
 {
-    VERIFY(bitmap.width() >= 0);
-    VERIFY(bitmap.height() >= 0);
-    VERIFY(static_cast<u32>(bitmap.width()) == width);
-    VERIFY(static_cast<u32>(bitmap.height()) == height);
+    VERIFY(subsampling_vertical == 0 || (first_row & 1) == 0);
 
-    auto temporary_buffer = DECODER_TRY_ALLOC(FixedArray<T>::create(static_cast<size_t>(width) * 4));
+    auto temporary_buffer = DECODER_TRY_ALLOC(FixedArray<T>::create(static_cast<size_t>(width) * 6));
+    auto row_buffer = [&](size_t index) { return temporary_buffer.span().slice(static_cast<size_t>(width) * index, width).data(); };
 
     // Above rows
-    auto* u_row_a = temporary_buffer.span().slice(static_cast<size_t>(width) * 0, width).data();
-    auto* v_row_a = temporary_buffer.span().slice(static_cast<size_t>(width) * 1, width).data();
+    auto* u_row_a = row_buffer(0);
+    auto* v_row_a = row_buffer(1);
 
     // Below rows
-    auto* u_row_b = temporary_buffer.span().slice(static_cast<size_t>(width) * 2, width).data();
-    auto* v_row_b = temporary_buffer.span().slice(static_cast<size_t>(width) * 3, width).data();
+    auto* u_row_b = row_buffer(2);
+    auto* v_row_b = row_buffer(3);
 
-    u32 const vertical_step = 1 << subsampling_vertical;
+    // Rows interpolated between the above and below rows
+    auto* u_row_middle = row_buffer(4);
+    auto* v_row_middle = row_buffer(5);
 
-    interpolate_row<subsampling_horizontal>(0, width, plane_u, plane_v, u_row_a, v_row_a);
+    auto convert_luma_row = [&](u32 row, T const* u_row, T const* v_row) {
+        auto const* y_row = &plane_y[static_cast<size_t>(row) * width];
+        convert_row(y_row, u_row, v_row, bitmap.scanline(static_cast<int>(row)), width);
+    };
 
-    // Do interpolation for all inner rows.
-    u32 const rows_end = height - subsampling_vertical;
-    for (u32 row = 0; row < rows_end; row += vertical_step) {
+    if constexpr (subsampling_vertical == 0) {
+        for (u32 row = first_row; row < end_row; row++) {
+            interpolate_row<subsampling_horizontal>(row, width, plane_u, plane_v, u_row_b, v_row_b);
+            convert_luma_row(row, u_row_b, v_row_b);
+        }
+        return {};
+    }
+
+    // Each pair of rows shares a chroma row. The first row of a pair sits between its chroma row and the one above it,
+    // so it is interpolated between the two. The second row of a pair uses its chroma row as is.
+    u32 uv_row = first_row >> subsampling_vertical;
+    if (uv_row > 0)
+        interpolate_row<subsampling_horizontal>(uv_row - 1, width, plane_u, plane_v, u_row_a, v_row_a);
+
+    for (u32 row = first_row; row < end_row; row += 2, uv_row++) {
         // Horizontally scale the row if subsampled.
-        auto uv_row = row >> subsampling_vertical;
         interpolate_row<subsampling_horizontal>(uv_row, width, plane_u, plane_v, u_row_b, v_row_b);
 
-        // If subsampled vertically, vertically interpolate the middle row between the above and below rows.
-        if constexpr (subsampling_vertical != 0) {
+        if (uv_row == 0) {
+            convert_luma_row(row, u_row_b, v_row_b);
+        } else {
             // OPTIMIZATION: Splitting these two lines into separate loops enables vectorization.
             for (u32 column = 0; column < width; column++) {
-                u_row_a[column] = (u_row_a[column] + u_row_b[column]) >> 1;
+                u_row_middle[column] = (u_row_a[column] + u_row_b[column]) >> 1;
             }
             for (u32 column = 0; column < width; column++) {
-                v_row_a[column] = (v_row_a[column] + v_row_b[column]) >> 1;
+                v_row_middle[column] = (v_row_a[column] + v_row_b[column]) >> 1;
             }
+            convert_luma_row(row, u_row_middle, v_row_middle);
         }
 
-        auto const* y_row_a = &plane_y[static_cast<size_t>(row) * width];
-        auto* scan_line_a = bitmap.scanline(static_cast<int>(row));
+        if (row + 1 < end_row)
+            convert_luma_row(row + 1, u_row_b, v_row_b);
 
-        for (size_t column = 0; column < width; column++) {
-            scan_line_a[column] = convert(y_row_a[column], u_row_a[column], v_row_a[column]).value();
-        }
-        if constexpr (subsampling_vertical != 0) {
-            auto const* y_row_b = &plane_y[static_cast<size_t>(row + 1) * width];
-            auto* scan_line_b = bitmap.scanline(static_cast<int>(row + 1));
-            for (size_t column = 0; column < width; column++) {
-                scan_line_b[column] = convert(y_row_b[column], u_row_b[column], v_row_b[column]).value();
-            }
-        }
+        swap(u_row_a, u_row_b);
+        swap(v_row_a, v_row_b);
+    }
+
+    return {};
+}
+
+// Frames with at least this many pixels are split into bands of rows that are converted in parallel.
+static constexpr size_t minimum_pixels_per_band = 256 * 1024;
+
+static constexpr size_t maximum_band_count = 8;
+
+using ConversionWorker = Threading::WorkerThread<DecoderError>;
+
+// Each thread that converts frames gets its own workers, so that conversions on different threads never wait for each other.
+static DecoderErrorOr<Span<NonnullOwnPtr<ConversionWorker>>> conversion_workers(size_t count)
+{
+    thread_local Vector<NonnullOwnPtr<ConversionWorker>> workers;
 
-        AK::TypedTransfer<RemoveReference<decltype(*u_row_a)>>::move(u_row_a, u_row_b, width);
-        AK::TypedTransfer<RemoveReference<decltype(*u_row_a)>>::move(v_row_a, v_row_b, width);
+    while (workers.size() < count) {
+        auto worker = DECODER_TRY_ALLOC(ConversionWorker::create("Video Color Conversion"sv));
+        workers.append(move(worker));
     }
 
-    if constexpr (subsampling_vertical != 0) {
-        // If there is a final row that hasn't been set above, convert it now.
-        if ((height & 1) == 0) {
-            auto const* y_row = &plane_y[static_cast<size_t>(height - 1) * width];
-            auto* scan_line = bitmap.scanline(static_cast<int>(height - 1));
-            for (size_t column = 0; column < width; column++) {
-                scan_line[column] = convert(y_row[column], u_row_a[column], v_row_a[column]).value();
-            }
-        }
+    return workers.span().trim(count);
+}
+
+template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T, typename ConvertRow>
+static DecoderErrorOr<void> convert_to_bitmap_subsampled(ConvertRow convert_row, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
+{
+    VERIFY(bitmap.width() >= 0);
+    VERIFY(bitmap.height() >= 0);
+    VERIFY(static_cast<u32>(bitmap.width()) == width);
+    VERIFY(static_cast<u32>(bitmap.height()) == height);
+
+    static size_t const hardware_concurrency = max(Core::System::hardware_concurrency(), 1u);
+
+    auto pixel_count = static_cast<size_t>(width) * height;
+    auto band_count = min(min(pixel_count / minimum_pixels_per_band, hardware_concurrency), maximum_band_count);
+
+    if (band_count <= 1)
+        return convert_rows_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(convert_row, width, 0, height, plane_y, plane_u, plane_v, bitmap);
+
+    // Keep the bands aligned to pairs of rows, so that each band starts with a new chroma row.
+    auto rows_per_band = static_cast<u32>(ceil_div(static_cast<size_t>(height), band_count) + 1) & ~1u;
+    auto convert_band = [&](size_t band) {
+        auto first_row = min(static_cast<u32>(band) * rows_per_band, height);
+        auto end_row = min(first_row + rows_per_band, height);
+        return convert_rows_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(convert_row, width, first_row, end_row, plane_y, plane_u, plane_v, bitmap);
+    };
+
+    // The calling thread converts the first band while the workers convert the rest.
+    auto workers = TRY(conversion_workers(band_count - 1));
+    for (size_t band = 1; band < band_count; band++) {
+        auto started = workers[band - 1]->start_task([&convert_band, band] { return convert_band(band); });
+        VERIFY(started);
     }
 
-    return {};
+    auto result = convert_band(0);
+
+    // NOTE: Wait for every worker even if one failed, as they are all writing into the bitmap.
+    for (size_t band = 1; band < band_count; band++) {
+        auto band_result = workers[band - 1]->wait_until_task_is_finished();
+        if (band_result.is_error() && !result.is_error())
+            result = band_result.release_error();
+    }
+
+    return result;
 }
 
 template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T>
@@ -183,20 +244,26 @@ static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_converter(
 
     constexpr auto output_cicp = CodingIndependentCodePoints(ColorPrimaries::BT709, TransferCharacteristics::SRGB, MatrixCoefficients::BT709, VideoFullRangeFlag::Full);
 
-    if (bit_depth == 8 && cicp.transfer_characteristics() == output_cicp.transfer_characteristics() && cicp.color_primaries() == output_cicp.color_primaries() && cicp.video_full_range_flag() == VideoFullRangeFlag::Studio) {
-        switch (cicp.matrix_coefficients()) {
-        case MatrixCoefficients::BT470BG:
-        case MatrixCoefficients::BT601:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT601, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
-        case MatrixCoefficients::BT709:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
-        default:
-            break;
+    if constexpr (IsSame<T, u8>) {
+        if (bit_depth == 8 && cicp.transfer_characteristics() == output_cicp.transfer_characteristics() && cicp.color_primaries() == output_cicp.color_primaries() && cicp.video_full_range_flag() == VideoFullRangeFlag::Studio) {
+            switch (cicp.matrix_coefficients()) {
+            case MatrixCoefficients::BT470BG:
+            case MatrixCoefficients::BT601:
+                return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(ColorConverter::convert_simple_yuv_to_rgb_row<MatrixCoefficients::BT601, VideoFullRangeFlag::Studio>, width, height, plane_y, plane_u, plane_v, bitmap);
+            case MatrixCoefficients::BT709:
+                return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(ColorConverter::convert_simple_yuv_to_rgb_row<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio>, width, height, plane_y, plane_u, plane_v, bitmap);
+            default:
+                break;
+            }
         }
     }
 
     auto converter = TRY(ColorConverter::create(bit_depth, cicp, output_cicp));
-    return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([&](T y, T u, T v) { return converter.convert_yuv(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+    auto convert_row = [&](T const* y_row, T const* u_row, T const* v_row, Gfx::ARGB32* scan_line, size_t row_width) {
+        for (size_t column = 0; column < row_width; column++)
+            scan_line[column] = converter.convert_yuv(y_row[column], u_row[column], v_row[column]).value();
+    };
+    return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>(convert_row, width, height, plane_y, plane_u, plane_v, bitmap);
 }
 
 template<u32 subsampling_horizontal, u32 subsampling_vertical>
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibMedia/VideoFramePool.h>
+
+namespace Media {
+
+Gfx::ImmutableBitmap& VideoFramePool::Surface::immutable_bitmap()
+{
+    // NOTE: The immutable bitmap wraps our pixels rather than copying them. It is dropped when the surface is reused, so
+    //       that nothing caches a stale copy of our contents under its identity.
+    if (!m_immutable_bitmap)
+        m_immutable_bitmap = Gfx::ImmutableBitmap::create(m_bitmap);
+    return *m_immutable_bitmap;
+}
+
+ErrorOr<NonnullRefPtr<VideoFramePool>> VideoFramePool::create()
+{
+    return adopt_nonnull_ref_or_enomem(new (nothrow) VideoFramePool);
+}
+
+DecoderErrorOr<NonnullRefPtr<VideoFramePool::Surface>> VideoFramePool::acquire_surface(Gfx::IntSize size)
+{
+    RefPtr<Surface> free_surface;
+
+    for (auto& surface : m_surfaces) {
+        // NOTE: As only the pool hands out references to its surfaces, and it only does so on this thread, nobody can
+        //       start referring to a surface once we hold its only reference.
+        if (surface->ref_count() != 1)
+            continue;
+
+        free_surface = surface;
+        if (surface->size() == size)
+            break;
+    }
+
+    if (!free_surface) {
+        auto bitmap = DECODER_TRY_ALLOC(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, size));
+        auto surface = DECODER_TRY_ALLOC(adopt_nonnull_ref_or_enomem(new (nothrow) Surface(move(bitmap))));
+        DECODER_TRY_ALLOC(m_surfaces.try_append(surface));
+        return surface;
+    }
+
+    // Make sure that we see everything the last user of the surface did with it before dropping its reference.
+    AK::atomic_thread_fence(AK::MemoryOrder::memory_order_acquire);
+
+    if (free_surface->size() != size)
+        free_surface->m_bitmap = DECODER_TRY_ALLOC(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, size));
+    free_surface->m_immutable_bitmap = nullptr;
+
+    return free_surface.release_nonnull();
+}
+
+void VideoFramePool::present(NonnullRefPtr<Surface> surface)
+{
+    m_presented_surface = move(surface);
+}
+
+}
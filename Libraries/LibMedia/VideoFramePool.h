@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/Size.h>
+#include <LibMedia/DecoderError.h>
+
+namespace Media {
+
+// A pool of bitmaps that decoded video frames are converted into, so that playing a video doesn't allocate a new
+// bitmap for every frame.
+//
+// The decoder thread acquires surfaces from the pool, and the main thread presents them once it is their frame's turn
+// to be displayed. A surface becomes free for reuse as soon as the pool holds the only reference to it, so anything
+// that holds onto a surface keeps its contents from being overwritten.
+//
+// Painting holds onto the pool rather than onto a surface, and looks up the presented surface when it draws. This way,
+// presenting a new frame doesn't invalidate what has already been recorded for the video.
+class VideoFramePool : public AtomicRefCounted<VideoFramePool> {
+public:
+    class Surface : public AtomicRefCounted<Surface> {
+    public:
+        Gfx::Bitmap& bitmap() { return *m_bitmap; }
+        Gfx::Bitmap const& bitmap() const { return *m_bitmap; }
+        Gfx::IntSize size() const { return m_bitmap->size(); }
+
+        // NOTE: This may only be used on the main thread, while the surface is presented.
+        Gfx::ImmutableBitmap& immutable_bitmap();
+
+    private:
+        friend class VideoFramePool;
+
+        explicit Surface(NonnullRefPtr<Gfx::Bitmap> bitmap)
+            : m_bitmap(move(bitmap))
+        {
+        }
+
+        NonnullRefPtr<Gfx::Bitmap> m_bitmap;
+        RefPtr<Gfx::ImmutableBitmap> m_immutable_bitmap;
+    };
+
+    static ErrorOr<NonnullRefPtr<VideoFramePool>> create();
+
+    // Decoder thread: Returns a surface of the given size that nothing outside the pool refers to, allocating a new one
+    // only if all existing surfaces are still in use.
+    DecoderErrorOr<NonnullRefPtr<Surface>> acquire_surface(Gfx::IntSize);
+
+    // Main thread: Makes the given surface the one to draw, and releases the previously presented surface.
+    void present(NonnullRefPtr<Surface>);
+    RefPtr<Surface> const& presented_surface() const { return m_presented_surface; }
+
+private:
+    VideoFramePool() = default;
+
+    // NOTE: Only the decoder thread accesses the list of surfaces.
+    Vector<NonnullRefPtr<Surface>> m_surfaces;
+
+    // NOTE: Only the main thread accesses the presented surface.
+    RefPtr<Surface> m_presented_surface;
+};
+
+}
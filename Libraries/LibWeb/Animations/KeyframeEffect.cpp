@@ -13,7 +13,9 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/Layout/Node.h>
-#include <LibWeb/Painting/Paintable.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/PaintableBox.h>
+#include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::Animations {
@@ -916,6 +918,38 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(H
     return invalidation;
 }
 
+static bool only_animates_composited_properties(KeyframeEffect::KeyFrameSet const& key_frame_set)
+{
+    for (auto const& keyframe : key_frame_set.keyframes_by_key) {
+        for (auto const& [property_id, _] : keyframe.properties) {
+            if (!first_is_one_of(property_id, CSS::PropertyID::Opacity, CSS::PropertyID::Transform))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Returns whether the new opacity and transform of the target can be shown by updating its stacking context's composited
+// properties, instead of recording the display list again. That is the case as long as the target keeps establishing
+// the same stacking context, and isn't fully transparent before or after, since we don't record transparent ones.
+static bool can_update_composited_properties(Painting::PaintableBox const& paintable_box, CSS::StyleProperties const& style)
+{
+    if (!paintable_box.stacking_context())
+        return false;
+
+    auto const& computed_values = paintable_box.computed_values();
+
+    auto old_opacity = computed_values.opacity();
+    auto new_opacity = style.opacity();
+    if (old_opacity != new_opacity && (old_opacity == 0 || new_opacity == 0 || old_opacity == 1 || new_opacity == 1))
+        return false;
+
+    if (computed_values.transformations().is_empty() != style.transformations().is_empty())
+        return false;
+
+    return true;
+}
+
 void KeyframeEffect::update_style_properties()
 {
     auto target = this->target();
@@ -936,6 +970,20 @@ void KeyframeEffect::update_style_properties()
     auto& document = target->document();
     document.style_computer().collect_animation_into(*target, pseudo_element_type(), *this, *style, CSS::StyleComputer::AnimationRefresh::Yes);
 
+    // OPTIMIZATION: Animations of only opacity and transform don't need to have the display list recorded again, as
+    //               painting can update those on the stacking context in place. Neither of them is inherited, so the
+    //               target's subtree is unaffected as well.
+    if (!pseudo_element_type().has_value() && m_key_frame_set && only_animates_composited_properties(*m_key_frame_set)) {
+        auto* paintable_box = target->paintable_box();
+        if (paintable_box && can_update_composited_properties(*paintable_box, *style)) {
+            target->layout_node()->apply_style(*style);
+            paintable_box->resolve_transform();
+            paintable_box->stacking_context()->update_composited_properties(document.page().client().device_pixels_per_css_pixel());
+            paintable_box->set_needs_display(InvalidateDisplayList::No);
+            return;
+        }
+    }
+
     // Traversal of the subtree is necessary to update the animated properties inherited from the target element.
     target->for_each_in_subtree_of_type<DOM::Element>([&](auto& element) {
         auto element_style = element.computed_css_values();
@@ -965,6 +1013,7 @@ void KeyframeEffect::update_style_properties()
         }
     }
 
+    document.invalidate_display_list();
     if (invalidation.relayout)
         document.set_needs_layout();
     if (invalidation.rebuild_layout_tree)
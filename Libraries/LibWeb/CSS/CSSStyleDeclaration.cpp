@@ -45,6 +45,19 @@ GC::Ref<PropertyOwningCSSStyleDeclaration> PropertyOwningCSSStyleDeclaration::cr
     return realm.create<PropertyOwningCSSStyleDeclaration>(realm, move(properties), move(custom_properties));
 }
 
+struct PropertyOwningCSSStyleDeclaration::UnparsedDeclarations {
+    Parser::ParsingContext context;
+    Vector<Parser::Declaration> declarations;
+};
+
+GC::Ref<PropertyOwningCSSStyleDeclaration> PropertyOwningCSSStyleDeclaration::create_unparsed(JS::Realm& realm, Parser::ParsingContext const& context, Vector<Parser::Declaration> declarations)
+{
+    auto declaration = realm.create<PropertyOwningCSSStyleDeclaration>(realm, Vector<StyleProperty> {}, HashMap<FlyString, StyleProperty> {});
+    if (!declarations.is_empty())
+        declaration->m_unparsed_declarations = make<UnparsedDeclarations>(context, move(declarations));
+    return declaration;
+}
+
 PropertyOwningCSSStyleDeclaration::PropertyOwningCSSStyleDeclaration(JS::Realm& realm, Vector<StyleProperty> properties, HashMap<FlyString, StyleProperty> custom_properties)
     : CSSStyleDeclaration(realm)
     , m_properties(move(properties))
@@ -52,10 +65,23 @@ PropertyOwningCSSStyleDeclaration::PropertyOwningCSSStyleDeclaration(JS::Realm&
 {
 }
 
+PropertyOwningCSSStyleDeclaration::~PropertyOwningCSSStyleDeclaration() = default;
+
+void PropertyOwningCSSStyleDeclaration::parse_declarations() const
+{
+    auto unparsed_declarations = m_unparsed_declarations.release_nonnull();
+
+    auto [properties, custom_properties] = Parser::Parser::parse_declarations(unparsed_declarations->context, unparsed_declarations->declarations);
+    m_properties = move(properties);
+    m_custom_properties = move(custom_properties);
+}
+
 void PropertyOwningCSSStyleDeclaration::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_parent_rule);
+    if (m_unparsed_declarations)
+        m_unparsed_declarations->context.visit_edges(visitor);
     for (auto& property : m_properties) {
         if (property.value->is_image())
             property.value->as_image().visit_edges(visitor);
@@ -64,6 +90,7 @@ void PropertyOwningCSSStyleDeclaration::visit_edges(Cell::Visitor& visitor)
 
 String PropertyOwningCSSStyleDeclaration::item(size_t index) const
 {
+    parse_declarations_if_needed();
     if (index >= m_properties.size())
         return {};
     return CSS::string_from_property_id(m_properties[index].property_id).to_string();
@@ -89,12 +116,12 @@ void ElementInlineCSSStyleDeclaration::visit_edges(Cell::Visitor& visitor)
 
 size_t PropertyOwningCSSStyleDeclaration::length() const
 {
-    return m_properties.size();
+    return properties().size();
 }
 
 Optional<StyleProperty> PropertyOwningCSSStyleDeclaration::property(PropertyID property_id) const
 {
-    for (auto& property : m_properties) {
+    for (auto& property : properties()) {
         if (property.property_id == property_id)
             return property;
     }
@@ -180,6 +207,7 @@ WebIDL::ExceptionOr<String> PropertyOwningCSSStyleDeclaration::remove_property(P
     //           2. Remove that CSS declaration and let removed be true.
 
     // 6. Otherwise, if property is a case-sensitive match for a property name of a CSS declaration in the declarations, remove that CSS declaration and let removed be true.
+    parse_declarations_if_needed();
     removed = m_properties.remove_first_matching([&](auto& entry) { return entry.property_id == property_id; });
 
     // 7. If removed is true, Update style attribute for the CSS declaration block.
@@ -216,6 +244,7 @@ bool PropertyOwningCSSStyleDeclaration::set_a_css_declaration(PropertyID propert
 {
     // FIXME: Handle logical property groups.
 
+    parse_declarations_if_needed();
     for (auto& property : m_properties) {
         if (property.property_id == property_id) {
             if (property.important == important && *property.value == *value)
@@ -375,6 +404,8 @@ String PropertyOwningCSSStyleDeclaration::serialized() const
     // 2. Let already serialized be an empty array.
     HashTable<PropertyID> already_serialized;
 
+    parse_declarations_if_needed();
+
     // NOTE: The spec treats custom properties the same as any other property, and expects the above loop to handle them.
     //       However, our implementation separates them from regular properties, so we need to handle them separately here.
     // FIXME: Is the relative order of custom properties and regular properties supposed to be preserved?
@@ -470,12 +501,14 @@ WebIDL::ExceptionOr<void> PropertyOwningCSSStyleDeclaration::set_css_text(String
 
 void PropertyOwningCSSStyleDeclaration::empty_the_declarations()
 {
+    m_unparsed_declarations = nullptr;
     m_properties.clear();
     m_custom_properties.clear();
 }
 
 void PropertyOwningCSSStyleDeclaration::set_the_declarations(Vector<StyleProperty> properties, HashMap<FlyString, StyleProperty> custom_properties)
 {
+    m_unparsed_declarations = nullptr;
     m_properties = move(properties);
     m_custom_properties = move(custom_properties);
 }
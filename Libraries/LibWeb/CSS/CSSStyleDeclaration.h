@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/OwnPtr.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -69,7 +70,12 @@ public:
     [[nodiscard]] static GC::Ref<PropertyOwningCSSStyleDeclaration>
     create(JS::Realm&, Vector<StyleProperty>, HashMap<FlyString, StyleProperty> custom_properties);
 
-    virtual ~PropertyOwningCSSStyleDeclaration() override = default;
+    // Creates a declaration block whose declarations are only parsed into properties once they are first needed,
+    // as most style rules in large style sheets never match any element.
+    [[nodiscard]] static GC::Ref<PropertyOwningCSSStyleDeclaration>
+    create_unparsed(JS::Realm&, Parser::ParsingContext const&, Vector<Parser::Declaration>);
+
+    virtual ~PropertyOwningCSSStyleDeclaration() override;
 
     virtual size_t length() const override;
     virtual String item(size_t index) const override;
@@ -79,10 +85,18 @@ public:
     virtual WebIDL::ExceptionOr<void> set_property(PropertyID, StringView css_text, StringView priority) override;
     virtual WebIDL::ExceptionOr<String> remove_property(PropertyID) override;
 
-    Vector<StyleProperty> const& properties() const { return m_properties; }
-    HashMap<FlyString, StyleProperty> const& custom_properties() const { return m_custom_properties; }
-    Optional<StyleProperty> custom_property(FlyString const& custom_property_name) const { return m_custom_properties.get(custom_property_name); }
-    size_t custom_property_count() const { return m_custom_properties.size(); }
+    Vector<StyleProperty> const& properties() const
+    {
+        parse_declarations_if_needed();
+        return m_properties;
+    }
+    HashMap<FlyString, StyleProperty> const& custom_properties() const
+    {
+        parse_declarations_if_needed();
+        return m_custom_properties;
+    }
+    Optional<StyleProperty> custom_property(FlyString const& custom_property_name) const { return custom_properties().get(custom_property_name); }
+    size_t custom_property_count() const { return custom_properties().size(); }
 
     virtual String serialized() const final override;
     virtual WebIDL::ExceptionOr<void> set_css_text(StringView) override;
@@ -99,13 +113,25 @@ protected:
     void set_the_declarations(Vector<StyleProperty> properties, HashMap<FlyString, StyleProperty> custom_properties);
 
 private:
+    struct UnparsedDeclarations;
+
     bool set_a_css_declaration(PropertyID, NonnullRefPtr<CSSStyleValue const>, Important);
 
+    void parse_declarations_if_needed() const
+    {
+        if (m_unparsed_declarations) [[unlikely]]
+            parse_declarations();
+    }
+    void parse_declarations() const;
+
     virtual void visit_edges(Cell::Visitor&) override;
 
     GC::Ptr<CSSRule> m_parent_rule;
-    Vector<StyleProperty> m_properties;
-    HashMap<FlyString, StyleProperty> m_custom_properties;
+
+    // NOTE: These are filled in from the unparsed declarations the first time they are needed.
+    mutable Vector<StyleProperty> m_properties;
+    mutable HashMap<FlyString, StyleProperty> m_custom_properties;
+    mutable OwnPtr<UnparsedDeclarations> m_unparsed_declarations;
 };
 
 class ElementInlineCSSStyleDeclaration final : public PropertyOwningCSSStyleDeclaration {
@@ -1686,12 +1686,19 @@ void Parser::extract_property(Declaration const& declaration, PropertiesAndCusto
 
 PropertyOwningCSSStyleDeclaration* Parser::convert_to_style_declaration(Vector<Declaration> const& declarations)
 {
+    // NOTE: The values are only parsed once something asks the declaration block for its properties.
+    //       See parse_declarations() below.
+    return PropertyOwningCSSStyleDeclaration::create_unparsed(m_context.realm(), m_context, declarations);
+}
+
+Parser::PropertiesAndCustomProperties Parser::parse_declarations(ParsingContext const& context, Vector<Declaration> const& declarations)
+{
+    auto parser = Parser::create(context, ""sv);
+
     PropertiesAndCustomProperties properties;
-    PropertiesAndCustomProperties& dest = properties;
-    for (auto const& declaration : declarations) {
-        extract_property(declaration, dest);
-    }
-    return PropertyOwningCSSStyleDeclaration::create(m_context.realm(), move(properties.properties), move(properties.custom_properties));
+    for (auto const& declaration : declarations)
+        parser.extract_property(declaration, properties);
+    return properties;
 }
 
 Optional<StyleProperty> Parser::convert_to_style_property(Declaration const& declaration)
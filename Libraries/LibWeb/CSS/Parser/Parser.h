@@ -71,6 +71,12 @@ public:
 
     static NonnullRefPtr<CSSStyleValue> resolve_unresolved_style_value(ParsingContext const&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, PropertyID, UnresolvedStyleValue const&);
 
+    struct PropertiesAndCustomProperties {
+        Vector<StyleProperty> properties;
+        HashMap<FlyString, StyleProperty> custom_properties;
+    };
+    static PropertiesAndCustomProperties parse_declarations(ParsingContext const&, Vector<Declaration> const&);
+
     [[nodiscard]] LengthOrCalculated parse_as_sizes_attribute(DOM::Element const& element, HTML::HTMLImageElement const* img = nullptr);
 
 private:
@@ -386,11 +392,6 @@ private:
     static bool has_ignored_vendor_prefix(StringView);
     static bool is_generic_font_family(Keyword);
 
-    struct PropertiesAndCustomProperties {
-        Vector<StyleProperty> properties;
-        HashMap<FlyString, StyleProperty> custom_properties;
-    };
-
     PropertiesAndCustomProperties extract_properties(Vector<RuleOrListOfDeclarations> const&);
     void extract_property(Declaration const&, Parser::PropertiesAndCustomProperties&);
 
@@ -61,6 +61,12 @@ URL::URL ParsingContext::complete_url(StringView relative_url) const
     return m_url.complete_url(relative_url);
 }
 
+void ParsingContext::visit_edges(GC::Cell::Visitor& visitor)
+{
+    visitor.visit(m_realm);
+    visitor.visit(m_document);
+}
+
 HTML::Window const* ParsingContext::window() const
 {
     if (!m_document)
@@ -38,6 +38,8 @@ public:
 
     JS::Realm& realm() const { return m_realm; }
 
+    void visit_edges(GC::Cell::Visitor&);
+
 private:
     GC::Ref<JS::Realm> m_realm;
     GC::Ptr<DOM::Document const> m_document;
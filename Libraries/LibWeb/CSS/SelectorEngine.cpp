@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <LibWeb/CSS/Keyword.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
@@ -835,142 +836,185 @@ bool matches(CSS::Selector const& selector, Optional<CSS::CSSStyleSheet const&>
     return matches(selector, style_sheet_for_rule, selector.compound_selectors().size() - 1, element, shadow_host, scope, selector_kind, anchor);
 }
 
-static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host)
+OwnPtr<CompiledSelector> CompiledSelector::compile(CSS::Selector const& selector)
 {
-    switch (simple_selector.type) {
-    case CSS::Selector::SimpleSelector::Type::Universal:
-        return matches_namespace(simple_selector.qualified_name(), element, style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::TagName:
-        if (element.document().document_type() == DOM::Document::Type::HTML) {
-            if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
-                return false;
-        } else if (!Infra::is_ascii_case_insensitive_match(simple_selector.qualified_name().name.name, element.local_name())) {
-            return false;
-        }
-        return matches_namespace(simple_selector.qualified_name(), element, style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::Class: {
-        // Class selectors are matched case insensitively in quirks mode.
-        // See: https://drafts.csswg.org/selectors-4/#class-html
-        auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
-        return element.has_class(simple_selector.name(), case_sensitivity);
-    }
-    case CSS::Selector::SimpleSelector::Type::Id:
-        return simple_selector.name() == element.id();
-    case CSS::Selector::SimpleSelector::Type::Attribute:
-        return matches_attribute(simple_selector.attribute(), style_sheet_for_rule, element);
-    case CSS::Selector::SimpleSelector::Type::PseudoClass:
-        return matches_pseudo_class(simple_selector.pseudo_class(), style_sheet_for_rule, element, shadow_host, nullptr, SelectorKind::Normal);
-    default:
-        VERIFY_NOT_REACHED();
-    }
-}
+    auto compiled_selector = adopt_own(*new CompiledSelector(selector));
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host)
-{
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, style_sheet_for_rule, element, shadow_host))
-            return false;
-    }
-    return true;
-}
+    auto const& compound_selectors = selector.compound_selectors();
+    compiled_selector->m_steps.ensure_capacity(compound_selectors.size());
 
-bool fast_matches(CSS::Selector const& selector, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host)
-{
-    DOM::Element const* current = &element_to_match;
+    // NOTE: The combinator of a compound selector relates it to the one on its left, which is the next one we match.
+    for (ssize_t compound_selector_index = compound_selectors.size() - 1; compound_selector_index >= 0; --compound_selector_index) {
+        auto const& compound_selector = compound_selectors[compound_selector_index];
+        if (compound_selector.combinator == CSS::Selector::Combinator::Column)
+            return nullptr;
 
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+        Step step {
+            .first_check = static_cast<u32>(compiled_selector->m_checks.size()),
+            .check_count = 0,
+            .combinator = compound_selector.combinator,
+        };
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), style_sheet_for_rule, *current, shadow_host))
-        return false;
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            auto append_check = [&](Check::Type type) {
+                compiled_selector->m_checks.append({ type, &simple_selector });
+                ++step.check_count;
+            };
+
+            switch (simple_selector.type) {
+            case CSS::Selector::SimpleSelector::Type::Universal:
+            case CSS::Selector::SimpleSelector::Type::TagName:
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName)
+                    append_check(Check::Type::TagName);
+                if (simple_selector.qualified_name().namespace_type != CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::Any)
+                    append_check(Check::Type::Namespace);
+                break;
+            case CSS::Selector::SimpleSelector::Type::Id:
+                append_check(Check::Type::Id);
+                break;
+            case CSS::Selector::SimpleSelector::Type::Class:
+                append_check(Check::Type::Class);
+                break;
+            case CSS::Selector::SimpleSelector::Type::Attribute:
+                append_check(Check::Type::Attribute);
+                break;
+            case CSS::Selector::SimpleSelector::Type::PseudoClass:
+                append_check(Check::Type::PseudoClass);
+                break;
+            case CSS::Selector::SimpleSelector::Type::PseudoElement:
+                // Pseudo-element matching/not-matching is handled in matches_subject().
+                break;
+            case CSS::Selector::SimpleSelector::Type::Nesting:
+                // Nesting selectors that are left after absolutization behave like :scope.
+                append_check(Check::Type::Scope);
+                break;
+            case CSS::Selector::SimpleSelector::Type::Invalid:
+                return nullptr;
+            }
+        }
 
-    // NOTE: If we fail after following a child combinator, we may need to backtrack
-    //       to the last matched descendant. We store the state here.
-    struct {
-        GC::Ptr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
-    } backtrack_state;
+        auto checks = compiled_selector->m_checks.span().slice(step.first_check, step.check_count);
+        quick_sort(checks, [](auto const& a, auto const& b) { return a.type < b.type; });
 
-    for (;;) {
-        // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
+        compiled_selector->m_steps.append(step);
+    }
 
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
+    return compiled_selector;
+}
 
-        switch (compound_selector->combinator) {
-        case CSS::Selector::Combinator::None:
-            return true;
-        case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
-            for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, style_sheet_for_rule, *current, shadow_host))
-                    break;
-            }
-            if (!current)
+bool CompiledSelector::matches_step(Step const& step, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host) const
+{
+    for (auto const& check : m_checks.span().slice(step.first_check, step.check_count)) {
+        auto const& simple_selector = *check.simple_selector;
+
+        switch (check.type) {
+        case Check::Type::Id:
+            if (simple_selector.name() != element.id())
                 return false;
             break;
-        case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
-            current = current->parent_element();
-            if (!current)
+        case Check::Type::Class: {
+            // Class selectors are matched case insensitively in quirks mode.
+            // See: https://drafts.csswg.org/selectors-4/#class-html
+            auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
+            if (!element.has_class(simple_selector.name(), case_sensitivity))
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, style_sheet_for_rule, *current, shadow_host)) {
-                if (backtrack_state.element) {
-                    current = backtrack_state.element;
-                    compound_selector_index = backtrack_state.compound_selector_index;
-                    continue;
-                }
+            break;
+        }
+        case Check::Type::TagName:
+            // See https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
+            if (element.document().document_type() == DOM::Document::Type::HTML) {
+                if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
+                    return false;
+            } else if (!Infra::is_ascii_case_insensitive_match(simple_selector.qualified_name().name.name, element.local_name())) {
                 return false;
             }
             break;
-        default:
-            VERIFY_NOT_REACHED();
+        case Check::Type::Namespace:
+            if (!matches_namespace(simple_selector.qualified_name(), element, style_sheet_for_rule))
+                return false;
+            break;
+        case Check::Type::Attribute:
+            if (!matches_attribute(simple_selector.attribute(), style_sheet_for_rule, element))
+                return false;
+            break;
+        case Check::Type::PseudoClass:
+            if (!matches_pseudo_class(simple_selector.pseudo_class(), style_sheet_for_rule, element, shadow_host, nullptr, SelectorKind::Normal))
+                return false;
+            break;
+        case Check::Type::Scope:
+            if (!is<HTML::HTMLHtmlElement>(element))
+                return false;
+            break;
         }
     }
+    return true;
 }
 
-bool can_use_fast_matches(CSS::Selector const& selector)
+bool CompiledSelector::matches_subject(Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
 {
-    for (auto const& compound_selector : selector.compound_selectors()) {
-        if (compound_selector.combinator != CSS::Selector::Combinator::None
-            && compound_selector.combinator != CSS::Selector::Combinator::Descendant
-            && compound_selector.combinator != CSS::Selector::Combinator::ImmediateChild) {
-            return false;
-        }
+    auto const& selector_pseudo_element = m_selector->pseudo_element();
+    if (selector_pseudo_element.has_value() && (!pseudo_element.has_value() || selector_pseudo_element->type() != *pseudo_element))
+        return false;
 
-        for (auto const& simple_selector : compound_selector.simple_selectors) {
-            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass) {
-                auto const pseudo_class = simple_selector.pseudo_class().type;
-                if (pseudo_class != CSS::PseudoClass::FirstChild
-                    && pseudo_class != CSS::PseudoClass::LastChild
-                    && pseudo_class != CSS::PseudoClass::OnlyChild
-                    && pseudo_class != CSS::PseudoClass::Hover
-                    && pseudo_class != CSS::PseudoClass::Active
-                    && pseudo_class != CSS::PseudoClass::Focus
-                    && pseudo_class != CSS::PseudoClass::FocusVisible
-                    && pseudo_class != CSS::PseudoClass::FocusWithin
-                    && pseudo_class != CSS::PseudoClass::Link
-                    && pseudo_class != CSS::PseudoClass::AnyLink
-                    && pseudo_class != CSS::PseudoClass::Visited
-                    && pseudo_class != CSS::PseudoClass::LocalLink
-                    && pseudo_class != CSS::PseudoClass::Empty
-                    && pseudo_class != CSS::PseudoClass::Root
-                    && pseudo_class != CSS::PseudoClass::Enabled
-                    && pseudo_class != CSS::PseudoClass::Disabled
-                    && pseudo_class != CSS::PseudoClass::Checked) {
-                    return false;
-                }
-            } else if (simple_selector.type != CSS::Selector::SimpleSelector::Type::TagName
-                && simple_selector.type != CSS::Selector::SimpleSelector::Type::Universal
-                && simple_selector.type != CSS::Selector::SimpleSelector::Type::Class
-                && simple_selector.type != CSS::Selector::SimpleSelector::Type::Id
-                && simple_selector.type != CSS::Selector::SimpleSelector::Type::Attribute) {
-                return false;
-            }
+    return matches_step(m_steps.first(), style_sheet_for_rule, element, shadow_host);
+}
+
+// Matches the compound selectors after the given step against the elements related to the given one by the step's
+// combinator. When that fails, the result says how far off we are, so that callers further out can stop trying
+// candidates that are bound to fail the same way.
+CompiledSelector::CombinatorMatchResult CompiledSelector::match_combinators(size_t step_index, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host) const
+{
+    auto const& step = m_steps[step_index];
+    if (step.combinator == CSS::Selector::Combinator::None)
+        return CombinatorMatchResult::Matches;
+
+    auto match_candidate = [&](DOM::Element const& candidate) {
+        if (!matches_step(m_steps[step_index + 1], style_sheet_for_rule, candidate, shadow_host))
+            return CombinatorMatchResult::FailsLocally;
+        return match_combinators(step_index + 1, style_sheet_for_rule, candidate, shadow_host);
+    };
+
+    switch (step.combinator) {
+    case CSS::Selector::Combinator::Descendant:
+        for (auto ancestor = traverse_up(element, shadow_host); ancestor; ancestor = traverse_up(ancestor, shadow_host)) {
+            if (!is<DOM::Element>(*ancestor))
+                continue;
+            auto result = match_candidate(static_cast<DOM::Element const&>(*ancestor));
+            if (result == CombinatorMatchResult::Matches || result == CombinatorMatchResult::FailsCompletely)
+                return result;
         }
+        // NOTE: Candidates further out for an earlier descendant combinator only have these ancestors left to look at.
+        return CombinatorMatchResult::FailsCompletely;
+    case CSS::Selector::Combinator::ImmediateChild: {
+        auto parent = traverse_up(element, shadow_host);
+        if (!parent || !parent->is_element())
+            return CombinatorMatchResult::FailsLocally;
+        return match_candidate(static_cast<DOM::Element const&>(*parent));
+    }
+    case CSS::Selector::Combinator::NextSibling: {
+        auto const* sibling = element.previous_element_sibling();
+        if (!sibling)
+            return CombinatorMatchResult::FailsAllSiblings;
+        return match_candidate(*sibling);
     }
+    case CSS::Selector::Combinator::SubsequentSibling:
+        for (auto const* sibling = element.previous_element_sibling(); sibling; sibling = sibling->previous_element_sibling()) {
+            auto result = match_candidate(*sibling);
+            if (result != CombinatorMatchResult::FailsLocally)
+                return result;
+        }
+        // NOTE: Candidates further back for an earlier subsequent-sibling combinator only have these siblings left.
+        return CombinatorMatchResult::FailsAllSiblings;
+    case CSS::Selector::Combinator::None:
+    case CSS::Selector::Combinator::Column:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
 
-    return true;
+bool CompiledSelector::matches_combinators(Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host) const
+{
+    return match_combinators(0, style_sheet_for_rule, element, shadow_host) == CombinatorMatchResult::Matches;
 }
 
 }
@@ -18,8 +18,71 @@ enum class SelectorKind {
 
 bool matches(CSS::Selector const&, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, Optional<CSS::Selector::PseudoElement::Type> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
 
-[[nodiscard]] bool fast_matches(CSS::Selector const&, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host);
-[[nodiscard]] bool can_use_fast_matches(CSS::Selector const&);
+// A selector compiled into a flat program of checks, for matching it against many elements during style computation.
+//
+// The compound selectors are laid out from right to left, each with its cheapest checks first, so that most elements
+// are rejected by a few comparisons. When following a combinator fails, we only try other candidates for the earlier
+// combinators that can still lead to a match, so that failing descendant selectors take time linear in the depth of
+// the tree.
+class CompiledSelector {
+public:
+    // Returns nothing for selectors that have to be matched with matches() instead.
+    static OwnPtr<CompiledSelector> compile(CSS::Selector const&);
+
+    // Checks the pseudo-element and the rightmost compound selector, which rejects most elements.
+    [[nodiscard]] bool matches_subject(Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, Optional<CSS::Selector::PseudoElement::Type>) const;
+
+    // Matches the rest of the selector against the ancestors and siblings of an element accepted by matches_subject().
+    [[nodiscard]] bool matches_combinators(Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host) const;
+
+private:
+    struct Check {
+        // Ordered by how cheap they are to perform.
+        enum class Type : u8 {
+            Id,
+            Class,
+            TagName,
+            Namespace,
+            Attribute,
+            PseudoClass,
+            Scope,
+        };
+
+        Type type;
+        CSS::Selector::SimpleSelector const* simple_selector { nullptr };
+    };
+
+    // The checks for one compound selector, and how to find candidates for the next one.
+    struct Step {
+        u32 first_check { 0 };
+        u32 check_count { 0 };
+        CSS::Selector::Combinator combinator { CSS::Selector::Combinator::None };
+    };
+
+    explicit CompiledSelector(CSS::Selector const& selector)
+        : m_selector(selector)
+    {
+    }
+
+    bool matches_step(Step const&, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host) const;
+
+    enum class CombinatorMatchResult : u8 {
+        Matches,
+        // Another candidate for the closest descendant or subsequent-sibling combinator may still match.
+        FailsLocally,
+        // No earlier sibling can match, but the ancestors of an element further out may.
+        FailsAllSiblings,
+        // Nothing further out can match either.
+        FailsCompletely,
+    };
+    CombinatorMatchResult match_combinators(size_t step_index, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host) const;
+
+    // Keeps the simple selectors that the checks point into alive.
+    NonnullRefPtr<CSS::Selector const> m_selector;
+
+    Vector<Check> m_checks;
+    Vector<Step> m_steps;
+};
 
 [[nodiscard]] bool matches_hover_pseudo_class(DOM::Element const&);
 
@@ -501,8 +501,11 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
             continue;
         }
 
+        ++m_selector_matching_counters.candidate_rules;
+
         auto const& selector = rule_to_run.absolutized_selectors()[rule_to_run.selector_index];
         if (should_reject_with_ancestor_filter(*selector)) {
+            ++m_selector_matching_counters.rejected_by_ancestor_filter;
             rule_to_run.skip = true;
             continue;
         }
@@ -528,15 +531,21 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
         if (element.is_shadow_host() && rule_root != element.shadow_root())
             shadow_host_to_use = nullptr;
 
-        auto const& selector = rule_to_run.absolutized_selectors()[rule_to_run.selector_index];
-
-        if (rule_to_run.can_use_fast_matches) {
-            if (!SelectorEngine::fast_matches(selector, *rule_to_run.sheet, element, shadow_host_to_use))
+        if (auto const* compiled_selector = rule_to_run.compiled_selector) {
+            if (!compiled_selector->matches_subject(*rule_to_run.sheet, element, shadow_host_to_use, pseudo_element)) {
+                ++m_selector_matching_counters.rejected_by_subject;
+                continue;
+            }
+            ++m_selector_matching_counters.fully_matched;
+            if (!compiled_selector->matches_combinators(*rule_to_run.sheet, element, shadow_host_to_use))
                 continue;
         } else {
+            ++m_selector_matching_counters.interpreted;
+            auto const& selector = rule_to_run.absolutized_selectors()[rule_to_run.selector_index];
             if (!SelectorEngine::matches(selector, *rule_to_run.sheet, element, shadow_host_to_use, pseudo_element))
                 continue;
         }
+        ++m_selector_matching_counters.matched;
         matching_rules.append(rule_to_run);
     }
     return matching_rules;
@@ -883,7 +892,7 @@ void StyleComputer::for_each_property_expanding_shorthands(PropertyID property_i
 void StyleComputer::set_property_expanding_shorthands(StyleProperties& style, PropertyID property_id, CSSStyleValue const& value, CSSStyleDeclaration const* declaration, StyleProperties const& style_for_revert, StyleProperties const& style_for_revert_layer, Important important)
 {
     auto revert_shorthand = [&](PropertyID shorthand_id, StyleProperties const& style_for_revert) {
-        auto previous_value = style_for_revert.m_data->m_property_values[to_underlying(shorthand_id)];
+        RefPtr<CSSStyleValue const> previous_value = style_for_revert.value(shorthand_id);
         if (!previous_value)
             previous_value = CSSKeywordValue::create(Keyword::Initial);
 
@@ -1558,9 +1567,9 @@ void StyleComputer::compute_cascaded_values(StyleProperties& style, DOM::Element
             // FIXME: This is not very efficient, we should only resolve the custom properties that are actually used.
             for (auto i = to_underlying(CSS::first_property_id); i <= to_underlying(CSS::last_property_id); ++i) {
                 auto property_id = (CSS::PropertyID)i;
-                auto& property = style.m_data->m_property_values[i];
+                auto const* property = style.value(property_id);
                 if (property && property->is_unresolved())
-                    property = Parser::Parser::resolve_unresolved_style_value(Parser::ParsingContext { document() }, element, pseudo_element, property_id, property->as_unresolved());
+                    style.mutable_value(property_id) = Parser::Parser::resolve_unresolved_style_value(Parser::ParsingContext { document() }, element, pseudo_element, property_id, property->as_unresolved());
             }
         }
     }
@@ -1684,8 +1693,8 @@ void StyleComputer::compute_defaulted_property_value(StyleProperties& style, DOM
 {
     // FIXME: If we don't know the correct initial value for a property, we fall back to `initial`.
 
-    auto& value_slot = style.m_data->m_property_values[to_underlying(property_id)];
-    if (!value_slot) {
+    auto const* value = style.value(property_id);
+    if (!value) {
         if (is_inherited_property(property_id)) {
             style.set_property(
                 property_id,
@@ -1698,27 +1707,27 @@ void StyleComputer::compute_defaulted_property_value(StyleProperties& style, DOM
         return;
     }
 
-    if (value_slot->is_initial()) {
-        value_slot = property_initial_value(document().realm(), property_id);
+    if (value->is_initial()) {
+        style.mutable_value(property_id) = property_initial_value(document().realm(), property_id);
         return;
     }
 
-    if (value_slot->is_inherit()) {
-        value_slot = get_inherit_value(document().realm(), property_id, element, pseudo_element);
+    if (value->is_inherit()) {
+        style.mutable_value(property_id) = get_inherit_value(document().realm(), property_id, element, pseudo_element);
         style.set_property_inherited(property_id, StyleProperties::Inherited::Yes);
         return;
     }
 
     // https://www.w3.org/TR/css-cascade-4/#inherit-initial
     // If the cascaded value of a property is the unset keyword,
-    if (value_slot->is_unset()) {
+    if (value->is_unset()) {
         if (is_inherited_property(property_id)) {
             // then if it is an inherited property, this is treated as inherit,
-            value_slot = get_inherit_value(document().realm(), property_id, element, pseudo_element);
+            style.mutable_value(property_id) = get_inherit_value(document().realm(), property_id, element, pseudo_element);
             style.set_property_inherited(property_id, StyleProperties::Inherited::Yes);
         } else {
             // and if it is not, this is treated as initial.
-            value_slot = property_initial_value(document().realm(), property_id);
+            style.mutable_value(property_id) = property_initial_value(document().realm(), property_id);
         }
     }
 }
@@ -2154,24 +2163,31 @@ void StyleComputer::absolutize_values(StyleProperties& style) const
     //       We have to resolve them right away, so that the *computed* line-height is ready for inheritance.
     //       We can't simply absolutize *all* percentage values against the font size,
     //       because most percentages are relative to containing block metrics.
-    auto& line_height_value_slot = style.m_data->m_property_values[to_underlying(CSS::PropertyID::LineHeight)];
-    if (line_height_value_slot && line_height_value_slot->is_percentage()) {
-        line_height_value_slot = LengthStyleValue::create(
-            Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value_slot->as_percentage().percentage().as_fraction()))));
+    auto const* line_height_value = style.value(CSS::PropertyID::LineHeight);
+    if (line_height_value && line_height_value->is_percentage()) {
+        style.mutable_value(CSS::PropertyID::LineHeight) = LengthStyleValue::create(
+            Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value->as_percentage().percentage().as_fraction()))));
     }
 
     auto line_height = style.compute_line_height(viewport_rect(), font_metrics, m_root_element_font_metrics);
     font_metrics.line_height = line_height;
 
     // NOTE: line-height might be using lh which should be resolved against the parent line height (like we did here already)
-    if (line_height_value_slot && line_height_value_slot->is_length())
-        line_height_value_slot = LengthStyleValue::create(Length::make_px(line_height));
+    line_height_value = style.value(CSS::PropertyID::LineHeight);
+    if (line_height_value && line_height_value->is_length())
+        style.mutable_value(CSS::PropertyID::LineHeight) = LengthStyleValue::create(Length::make_px(line_height));
 
-    for (size_t i = 0; i < style.m_data->m_property_values.size(); ++i) {
-        auto& value_slot = style.m_data->m_property_values[i];
-        if (!value_slot)
+    for (auto i = to_underlying(CSS::first_longhand_property_id); i <= to_underlying(CSS::last_longhand_property_id); ++i) {
+        auto property_id = static_cast<CSS::PropertyID>(i);
+        auto const* value = style.value(property_id);
+        if (!value)
             continue;
-        value_slot = value_slot->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
+
+        // NOTE: Only store values that actually changed, so that we don't needlessly copy a group of values that we
+        //       might be sharing with another style.
+        auto absolutized_value = value->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
+        if (absolutized_value.ptr() != value)
+            style.mutable_value(property_id) = move(absolutized_value);
     }
 
     style.set_line_height({}, line_height);
@@ -2425,9 +2441,34 @@ Optional<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& elemen
         start_needed_transitions(*previous_style, style, element, pseudo_element);
     }
 
+    // 10. Share the groups of values that are identical to our parent's or to the initial values, instead of keeping
+    //     our own copies of them.
+    share_identical_style_groups(style, element, pseudo_element);
+
     return style;
 }
 
+StyleProperties const& StyleComputer::initial_values_style() const
+{
+    if (!m_initial_values_style.has_value()) {
+        StyleProperties style;
+        for (auto i = to_underlying(CSS::first_longhand_property_id); i <= to_underlying(CSS::last_longhand_property_id); ++i) {
+            auto property_id = static_cast<CSS::PropertyID>(i);
+            style.set_property(property_id, property_initial_value(document().realm(), property_id));
+        }
+        m_initial_values_style = move(style);
+    }
+    return *m_initial_values_style;
+}
+
+void StyleComputer::share_identical_style_groups(StyleProperties& style, DOM::Element const& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
+{
+    if (auto const* parent_element = element_to_inherit_style_from(&element, pseudo_element); parent_element && parent_element->computed_css_values().has_value())
+        style.share_identical_groups_with(*parent_element->computed_css_values());
+
+    style.share_identical_groups_with(initial_values_style());
+}
+
 void StyleComputer::build_rule_cache_if_needed() const
 {
     if (m_author_rule_cache && m_user_rule_cache && m_user_agent_rule_cache)
@@ -2514,6 +2555,12 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
                 VERIFY_NOT_REACHED();
             }();
             for (CSS::Selector const& selector : absolutized_selectors) {
+                SelectorEngine::CompiledSelector const* compiled_selector = nullptr;
+                if (auto compiled = SelectorEngine::CompiledSelector::compile(selector)) {
+                    compiled_selector = compiled.ptr();
+                    rule_cache->compiled_selectors.append(compiled.release_nonnull());
+                }
+
                 MatchingRule matching_rule {
                     shadow_root,
                     &rule,
@@ -2524,7 +2571,7 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
                     selector.specificity(),
                     cascade_origin,
                     false,
-                    SelectorEngine::can_use_fast_matches(selector),
+                    compiled_selector,
                     false,
                 };
 
@@ -20,6 +20,12 @@
 #include <LibWeb/Forward.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 
+namespace Web::SelectorEngine {
+
+class CompiledSelector;
+
+}
+
 namespace Web::CSS {
 
 // A counting bloom filter with 2 hash functions.
@@ -91,7 +97,7 @@ struct MatchingRule {
     u32 specificity { 0 };
     CascadeOrigin cascade_origin;
     bool contains_pseudo_element { false };
-    bool can_use_fast_matches { false };
+    SelectorEngine::CompiledSelector const* compiled_selector { nullptr };
     bool must_be_hovered { false };
     bool skip { false };
 
@@ -173,6 +179,18 @@ public:
 
     size_t number_of_css_font_faces_with_loading_in_progress() const;
 
+    // How far the candidate rules for each element got while being matched against it.
+    struct SelectorMatchingCounters {
+        size_t candidate_rules { 0 };
+        size_t rejected_by_ancestor_filter { 0 };
+        size_t rejected_by_subject { 0 };
+        size_t fully_matched { 0 };
+        size_t interpreted { 0 };
+        size_t matched { 0 };
+    };
+    SelectorMatchingCounters const& selector_matching_counters() const { return m_selector_matching_counters; }
+    void reset_selector_matching_counters() { m_selector_matching_counters = {}; }
+
 private:
     enum class ComputeStyleMode {
         Normal,
@@ -198,6 +216,9 @@ private:
 
     void compute_defaulted_property_value(StyleProperties&, DOM::Element const*, CSS::PropertyID, Optional<CSS::Selector::PseudoElement::Type>) const;
 
+    StyleProperties const& initial_values_style() const;
+    void share_identical_style_groups(StyleProperties&, DOM::Element const&, Optional<CSS::Selector::PseudoElement::Type>) const;
+
     void set_all_properties(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, StyleProperties&, CSSStyleValue const&, DOM::Document&, CSS::CSSStyleDeclaration const*, StyleProperties const& style_for_revert, StyleProperties const& style_for_revert_layer, Important = Important::No) const;
 
     template<typename Callback>
@@ -239,6 +260,9 @@ private:
 
         HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
+        // The selectors of the rules above, compiled once when the cache is built.
+        Vector<NonnullOwnPtr<SelectorEngine::CompiledSelector>> compiled_selectors;
+
         bool has_has_selectors { false };
     };
 
@@ -260,7 +284,12 @@ private:
 
     CSSPixelRect m_viewport_rect;
 
+    // The initial value of every property, for computed styles to share their groups of values with.
+    mutable Optional<StyleProperties> m_initial_values_style;
+
     CountingBloomFilter<u8, 14> m_ancestor_filter;
+
+    mutable SelectorMatchingCounters m_selector_matching_counters;
 };
 
 class FontLoader : public ResourceClient {
@@ -40,12 +40,22 @@
 
 namespace Web::CSS {
 
+NonnullRefPtr<StyleProperties::StyleGroupValues> StyleProperties::StyleGroupValues::create(StyleGroup group)
+{
+    return adopt_ref(*new StyleGroupValues(MUST(FixedArray<RefPtr<CSSStyleValue const>>::create(style_group_sizes[to_underlying(group)]))));
+}
+
+NonnullRefPtr<StyleProperties::StyleGroupValues> StyleProperties::StyleGroupValues::clone() const
+{
+    return adopt_ref(*new StyleGroupValues(MUST(m_values.clone())));
+}
+
 NonnullRefPtr<StyleProperties::Data> StyleProperties::Data::clone() const
 {
     auto clone = adopt_ref(*new StyleProperties::Data);
     clone->m_animation_name_source = m_animation_name_source;
     clone->m_transition_property_source = m_transition_property_source;
-    clone->m_property_values = m_property_values;
+    clone->m_style_groups = m_style_groups;
     clone->m_property_important = m_property_important;
     clone->m_property_inherited = m_property_inherited;
     clone->m_animated_property_values = m_animated_property_values;
@@ -55,6 +65,31 @@ NonnullRefPtr<StyleProperties::Data> StyleProperties::Data::clone() const
     return clone;
 }
 
+CSSStyleValue const* StyleProperties::value(CSS::PropertyID property_id) const
+{
+    auto slot = style_group_slots[to_underlying(property_id)];
+    if (slot.group == StyleGroup::None)
+        return nullptr;
+
+    auto const& group = m_data->m_style_groups[to_underlying(slot.group)];
+    if (!group)
+        return nullptr;
+    return static_cast<StyleGroupValues const&>(*group).at(slot.index);
+}
+
+RefPtr<CSSStyleValue const>& StyleProperties::mutable_value(CSS::PropertyID property_id)
+{
+    auto slot = style_group_slots[to_underlying(property_id)];
+    VERIFY(slot.group != StyleGroup::None);
+
+    auto& group = m_data->m_style_groups[to_underlying(slot.group)];
+    if (!group)
+        group = StyleGroupValues::create(slot.group);
+    else if (group->ref_count() > 1)
+        group = group->clone();
+    return group->at(slot.index);
+}
+
 bool StyleProperties::is_property_important(CSS::PropertyID property_id) const
 {
     size_t n = to_underlying(property_id);
@@ -87,14 +122,14 @@ void StyleProperties::set_property_inherited(CSS::PropertyID property_id, Inheri
 
 void StyleProperties::set_property(CSS::PropertyID id, NonnullRefPtr<CSSStyleValue const> value, Inherited inherited, Important important)
 {
-    m_data->m_property_values[to_underlying(id)] = move(value);
+    mutable_value(id) = move(value);
     set_property_important(id, important);
     set_property_inherited(id, inherited);
 }
 
 void StyleProperties::revert_property(CSS::PropertyID id, StyleProperties const& style_for_revert)
 {
-    m_data->m_property_values[to_underlying(id)] = style_for_revert.m_data->m_property_values[to_underlying(id)];
+    mutable_value(id) = style_for_revert.value(id);
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -117,14 +152,14 @@ CSSStyleValue const& StyleProperties::property(CSS::PropertyID property_id, With
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_data->m_property_values[to_underlying(property_id)];
+    return *value(property_id);
 }
 
 CSSStyleValue const* StyleProperties::maybe_null_property(CSS::PropertyID property_id) const
 {
     if (auto animated_value = m_data->m_animated_property_values.get(property_id); animated_value.has_value())
         return animated_value.value();
-    return m_data->m_property_values[to_underlying(property_id)];
+    return value(property_id);
 }
 
 Variant<LengthPercentage, NormalGap> StyleProperties::gap_value(CSS::PropertyID id) const
@@ -708,32 +743,47 @@ Optional<CSS::Positioning> StyleProperties::position() const
     return keyword_to_positioning(value.to_keyword());
 }
 
-bool StyleProperties::operator==(StyleProperties const& other) const
+bool StyleProperties::style_groups_are_equal(size_t group_index, StyleGroupValues const* group, StyleGroupValues const* other_group)
 {
-    if (m_data->m_property_values.size() != other.m_data->m_property_values.size())
-        return false;
+    if (group == other_group)
+        return true;
 
-    for (size_t i = 0; i < m_data->m_property_values.size(); ++i) {
-        auto const& my_style = m_data->m_property_values[i];
-        auto const& other_style = other.m_data->m_property_values[i];
-        if (!my_style) {
-            if (other_style)
-                return false;
+    for (size_t i = 0; i < style_group_sizes[group_index]; ++i) {
+        auto const* value = group ? group->at(i) : nullptr;
+        auto const* other_value = other_group ? other_group->at(i) : nullptr;
+        if (value == other_value)
             continue;
-        }
-        if (!other_style)
+        if (!value || !other_value)
             return false;
-        auto const& my_value = *my_style;
-        auto const& other_value = *other_style;
-        if (my_value.type() != other_value.type())
+        if (value->type() != other_value->type())
             return false;
-        if (my_value != other_value)
+        if (*value != *other_value)
             return false;
     }
+    return true;
+}
 
+bool StyleProperties::operator==(StyleProperties const& other) const
+{
+    for (size_t i = 0; i < number_of_style_groups; ++i) {
+        if (!style_groups_are_equal(i, m_data->m_style_groups[i], other.m_data->m_style_groups[i]))
+            return false;
+    }
     return true;
 }
 
+void StyleProperties::share_identical_groups_with(StyleProperties const& other)
+{
+    Data const& data = m_data;
+    for (size_t i = 0; i < number_of_style_groups; ++i) {
+        auto const& other_group = other.m_data->m_style_groups[i];
+        if (!other_group || data.m_style_groups[i] == other_group)
+            continue;
+        if (style_groups_are_equal(i, data.m_style_groups[i], other_group))
+            m_data->m_style_groups[i] = other_group;
+    }
+}
+
 Optional<CSS::TextAnchor> StyleProperties::text_anchor() const
 {
     auto const& value = property(CSS::PropertyID::TextAnchor);
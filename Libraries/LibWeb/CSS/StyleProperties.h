@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/FixedArray.h>
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
 #include <LibGC/Ptr.h>
@@ -24,6 +25,26 @@ public:
     static constexpr size_t number_of_properties = to_underlying(CSS::last_property_id) + 1;
 
 private:
+    // The values of all properties in one StyleGroup. These are shared between elements whose values for the whole
+    // group are identical, e.g. with their parent for inherited groups, or with the initial values for the others.
+    class StyleGroupValues : public RefCounted<StyleGroupValues> {
+    public:
+        static NonnullRefPtr<StyleGroupValues> create(StyleGroup);
+
+        NonnullRefPtr<StyleGroupValues> clone() const;
+
+        RefPtr<CSSStyleValue const>& at(size_t index) { return m_values[index]; }
+        CSSStyleValue const* at(size_t index) const { return m_values[index]; }
+
+    private:
+        explicit StyleGroupValues(FixedArray<RefPtr<CSSStyleValue const>> values)
+            : m_values(move(values))
+        {
+        }
+
+        FixedArray<RefPtr<CSSStyleValue const>> m_values;
+    };
+
     struct Data : public RefCounted<Data> {
         friend class StyleComputer;
 
@@ -33,7 +54,8 @@ private:
         GC::Ptr<CSS::CSSStyleDeclaration const> m_animation_name_source;
         GC::Ptr<CSS::CSSStyleDeclaration const> m_transition_property_source;
 
-        Array<RefPtr<CSSStyleValue const>, number_of_properties> m_property_values;
+        // A missing group means that none of its properties have a value yet.
+        Array<RefPtr<StyleGroupValues>, number_of_style_groups> m_style_groups;
         Array<u8, ceil_div(number_of_properties, 8uz)> m_property_important {};
         Array<u8, ceil_div(number_of_properties, 8uz)> m_property_inherited {};
 
@@ -51,9 +73,9 @@ public:
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_data->m_property_values.size(); ++i) {
-            if (m_data->m_property_values[i])
-                callback((CSS::PropertyID)i, *m_data->m_property_values[i]);
+        for (auto i = to_underlying(CSS::first_longhand_property_id); i <= to_underlying(CSS::last_longhand_property_id); ++i) {
+            if (auto const* value = this->value((CSS::PropertyID)i))
+                callback((CSS::PropertyID)i, *value);
         }
     }
 
@@ -208,6 +230,10 @@ public:
 
     bool operator==(StyleProperties const&) const;
 
+    // Makes us use the other style's groups wherever their values are identical to ours, so that we don't keep a copy
+    // of our own.
+    void share_identical_groups_with(StyleProperties const&);
+
     Optional<CSS::Positioning> position() const;
     Optional<int> z_index() const;
 
@@ -226,6 +252,14 @@ public:
 private:
     friend class StyleComputer;
 
+    // The value stored for a property, without taking animations into account.
+    CSSStyleValue const* value(CSS::PropertyID) const;
+
+    // Gives us our own copy of the property's group first if it is shared with another style.
+    RefPtr<CSSStyleValue const>& mutable_value(CSS::PropertyID);
+
+    static bool style_groups_are_equal(size_t group_index, StyleGroupValues const*, StyleGroupValues const*);
+
     Optional<CSS::Overflow> overflow(CSS::PropertyID) const;
     Vector<CSS::ShadowData> shadow(CSS::PropertyID, Layout::Node const&) const;
 
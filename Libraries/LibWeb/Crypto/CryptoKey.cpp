@@ -156,26 +156,29 @@ WebIDL::ExceptionOr<void> CryptoKey::serialization_steps(HTML::SerializationReco
     return {};
 }
 
-WebIDL::ExceptionOr<void> CryptoKey::deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
+WebIDL::ExceptionOr<void> CryptoKey::deserialization_steps(ReadonlyBytes serialized, size_t& position, HTML::DeserializationMemory& memory)
 {
     auto& vm = this->vm();
     auto& realm = this->realm();
 
     // 1. Initialize the [[type]] internal slot of value to serialized.[[Type]].
-    m_type = static_cast<Bindings::KeyType>(HTML::deserialize_primitive_type<u32>(serialized, position));
+    auto type = TRY(HTML::deserialize_primitive_type<u32>(vm, serialized, position));
+    if (type > to_underlying(Bindings::KeyType::Secret))
+        return HTML::malformed_serialization_record_error(vm);
+    m_type = static_cast<Bindings::KeyType>(type);
 
     // 2. Initialize the [[extractable]] internal slot of value to serialized.[[Extractable]].
-    m_extractable = HTML::deserialize_primitive_type<bool>(serialized, position);
+    m_extractable = TRY(HTML::deserialize_primitive_type<bool>(vm, serialized, position));
 
     // 3. Initialize the [[algorithm]] internal slot of value to the sub-deserialization of serialized.[[Algorithm]].
     auto deserialized_record = TRY(HTML::structured_deserialize_internal(vm, serialized, realm, memory, position));
-    if (deserialized_record.value.has_value())
+    if (deserialized_record.value.has_value() && deserialized_record.value->is_object())
         m_algorithm = deserialized_record.value.release_value().as_object();
     position = deserialized_record.position;
 
     // 4. Initialize the [[usages]] internal slot of value to the sub-deserialization of serialized.[[Usages]].
     deserialized_record = TRY(HTML::structured_deserialize_internal(vm, serialized, realm, memory, position));
-    if (deserialized_record.value.has_value())
+    if (deserialized_record.value.has_value() && deserialized_record.value->is_object())
         m_usages = deserialized_record.value.release_value().as_object();
     position = deserialized_record.position;
 
@@ -14,6 +14,7 @@
 #include <AK/InsertionSort.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
+#include <LibCore/PerformanceTrace.h>
 #include <LibCore/Timer.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
@@ -83,6 +84,7 @@
 #include <LibWeb/HTML/HTMLAreaElement.h>
 #include <LibWeb/HTML/HTMLBaseElement.h>
 #include <LibWeb/HTML/HTMLBodyElement.h>
+#include <LibWeb/HTML/HTMLCanvasElement.h>
 #include <LibWeb/HTML/HTMLDocument.h>
 #include <LibWeb/HTML/HTMLEmbedElement.h>
 #include <LibWeb/HTML/HTMLFormElement.h>
@@ -122,10 +124,13 @@
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/IntersectionObserver/IntersectionObserver.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
+#include <LibWeb/Layout/LayoutState.h>
 #include <LibWeb/Layout/TreeBuilder.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayListOptimizer.h>
+#include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
@@ -510,6 +515,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_shared_resource_requests);
 
     visitor.visit(m_associated_animation_timelines);
+    visitor.visit(m_canvases_with_pending_drawing_commands);
     visitor.visit(m_list_of_available_images);
 
     for (auto* form_associated_element : m_form_associated_elements_with_form_attribute)
@@ -983,6 +989,7 @@ void Document::tear_down_layout_tree()
 {
     m_layout_root = nullptr;
     m_paintable = nullptr;
+    m_previous_layout_state = nullptr;
 }
 
 Color Document::background_color() const
@@ -1082,6 +1089,14 @@ URL::URL Document::parse_url(StringView url) const
 }
 
 void Document::set_needs_layout()
+{
+    m_needs_full_layout = true;
+    set_needs_incremental_layout();
+}
+
+// NOTE: Unlike set_needs_layout(), this expects the changed layout nodes to have been marked with
+//       Layout::Node::set_needs_layout(), so that layout can skip over the parts of the tree that didn't change.
+void Document::set_needs_incremental_layout()
 {
     if (m_needs_layout)
         return;
@@ -1156,6 +1171,8 @@ void Document::update_layout()
     if (m_created_for_appropriate_template_contents)
         return;
 
+    Core::PerformanceTraceSpan trace_span("rendering"sv, "layout"sv);
+
     invalidate_display_list();
 
     auto* document_element = this->document_element();
@@ -1195,18 +1212,28 @@ void Document::update_layout()
         return TraversalDecision::Continue;
     });
 
-    Layout::LayoutState layout_state;
+    auto layout_state = make<Layout::LayoutState>();
+    if (!m_needs_full_layout) {
+        layout_state->m_previous_layout = m_previous_layout_state.ptr();
+        m_layout_root->clear_cached_intrinsic_sizes_in_subtrees_that_need_layout();
+    } else {
+        // NOTE: Whatever caused a full layout may have affected intrinsic sizes anywhere in the tree.
+        m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([](auto& box) {
+            box.clear_cached_intrinsic_sizes();
+            return TraversalDecision::Continue;
+        });
+    }
 
     {
-        Layout::BlockFormattingContext root_formatting_context(layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
+        Layout::BlockFormattingContext root_formatting_context(*layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
 
         auto& viewport = static_cast<Layout::Viewport&>(*m_layout_root);
-        auto& viewport_state = layout_state.get_mutable(viewport);
+        auto& viewport_state = layout_state->get_mutable(viewport);
         viewport_state.set_content_width(viewport_rect.width());
         viewport_state.set_content_height(viewport_rect.height());
 
         if (document_element && document_element->layout_node()) {
-            auto& icb_state = layout_state.get_mutable(verify_cast<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
+            auto& icb_state = layout_state->get_mutable(verify_cast<Layout::NodeWithStyleAndBoxModelMetrics>(*document_element->layout_node()));
             icb_state.set_content_width(viewport_rect.width());
         }
 
@@ -1216,7 +1243,15 @@ void Document::update_layout()
                 Layout::AvailableSize::make_definite(viewport_rect.height())));
     }
 
-    layout_state.commit(*m_layout_root);
+    layout_state->commit(*m_layout_root);
+
+    auto const& intrinsic_sizing_statistics = layout_state->intrinsic_sizing_statistics;
+    dbgln_if(LIBWEB_CSS_DEBUG, "Layout: {} intrinsic sizing layouts (nested up to {} deep), {} intrinsic size cache hits",
+        intrinsic_sizing_statistics.layouts, intrinsic_sizing_statistics.max_depth, intrinsic_sizing_statistics.cache_hits);
+
+    layout_state->m_previous_layout = nullptr;
+    m_previous_layout_state = move(layout_state);
+    m_layout_root->clear_needs_layout_in_subtree();
 
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     inform_all_viewport_clients_about_the_current_viewport_rect();
@@ -1239,6 +1274,7 @@ void Document::update_layout()
     }
 
     m_needs_layout = false;
+    m_needs_full_layout = false;
 
     // Scrolling by zero offset will clamp scroll offset back to valid range if it was out of bounds
     // after the viewport size change.
@@ -1314,22 +1350,33 @@ void Document::update_style()
     if (m_created_for_appropriate_template_contents)
         return;
 
+    Core::PerformanceTraceSpan trace_span("rendering"sv, "style"sv);
+
     // Fetch the viewport rect once, instead of repeatedly, during style computation.
     style_computer().set_viewport_rect({}, viewport_rect());
 
     evaluate_media_rules();
 
     style_computer().reset_ancestor_filter();
+    style_computer().reset_selector_matching_counters();
 
     auto invalidation = update_style_recursively(*this, style_computer());
-    if (!invalidation.is_none()) {
+
+    auto const& selector_matching_counters = style_computer().selector_matching_counters();
+    dbgln_if(LIBWEB_CSS_DEBUG, "Style: {} candidate rules, {} rejected by the ancestor filter, {} rejected by their subject, {} fully matched, {} interpreted, {} matched",
+        selector_matching_counters.candidate_rules, selector_matching_counters.rejected_by_ancestor_filter, selector_matching_counters.rejected_by_subject,
+        selector_matching_counters.fully_matched, selector_matching_counters.interpreted, selector_matching_counters.matched);
+    // NOTE: Elements whose style changed in a way that only requires a repaint have invalidated the display lists of
+    //       their stacking contexts in recompute_style().
+    if (invalidation.rebuild_layout_tree || invalidation.relayout || invalidation.rebuild_stacking_context_tree) {
         invalidate_display_list();
     }
     if (invalidation.rebuild_layout_tree) {
         invalidate_layout_tree();
     } else {
+        // NOTE: The layout nodes whose style changed in a way that affects layout have been marked by recompute_style().
         if (invalidation.relayout)
-            set_needs_layout();
+            set_needs_incremental_layout();
         if (invalidation.rebuild_stacking_context_tree)
             invalidate_stacking_context_tree();
     }
@@ -1341,7 +1388,7 @@ void Document::update_animated_style_if_needed()
     if (!m_needs_animated_style_update)
         return;
 
-    invalidate_display_list();
+    // NOTE: Each effect invalidates the display list if it changed anything that painting can't update in place.
 
     for (auto& timeline : m_associated_animation_timelines) {
         for (auto& animation : timeline->associated_animations()) {
@@ -5640,10 +5687,27 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
     }
 }
 
+void Document::did_record_canvas_drawing_commands(HTML::HTMLCanvasElement& canvas)
+{
+    m_canvases_with_pending_drawing_commands.set(canvas);
+}
+
+// The display list only references the painting surfaces of canvases, so it can be played again as is once the
+// recorded drawing commands have reached them.
+void Document::flush_pending_canvas_drawing_commands()
+{
+    auto canvases = move(m_canvases_with_pending_drawing_commands);
+    for (auto& canvas : canvases)
+        canvas->flush_pending_drawing_commands();
+}
+
 void Document::invalidate_display_list()
 {
     m_cached_display_list.clear();
 
+    if (auto* viewport_paintable = paintable(); viewport_paintable && viewport_paintable->stacking_context())
+        viewport_paintable->stacking_context()->invalidate_display_lists_of_subtree();
+
     auto navigable = this->navigable();
     if (!navigable)
         return;
@@ -5653,11 +5717,38 @@ void Document::invalidate_display_list()
     }
 }
 
+// Invalidates the display list of a single stacking context, such that the display lists of the other stacking contexts
+// are reused the next time this document is painted.
+void Document::invalidate_display_list(Painting::StackingContext& stacking_context)
+{
+    m_cached_display_list.clear();
+    stacking_context.invalidate_display_list();
+
+    auto navigable = this->navigable();
+    if (!navigable)
+        return;
+
+    if (auto container = navigable->container()) {
+        if (auto* container_paintable = container->paintable())
+            container_paintable->invalidate_display_list();
+        else
+            container->document().invalidate_display_list();
+    }
+}
+
 RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
 {
     if (m_cached_display_list && m_cached_display_list_paint_config == config)
         return m_cached_display_list;
 
+    // NOTE: The display lists of the stacking contexts have been recorded with the previous paint config.
+    if (m_cached_display_list_paint_config != config) {
+        if (auto* viewport_paintable = paintable(); viewport_paintable && viewport_paintable->stacking_context())
+            viewport_paintable->stacking_context()->invalidate_display_lists_of_subtree();
+    }
+
+    Core::PerformanceTraceSpan trace_span("rendering"sv, "paint"sv);
+
     auto display_list = Painting::DisplayList::create();
     Painting::DisplayListRecorder display_list_recorder(display_list);
 
@@ -5687,6 +5778,14 @@ RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
 
     viewport_paintable.paint_all_phases(context);
 
+    if constexpr (LIBWEB_DISPLAY_LIST_DEBUG) {
+        Painting::DisplayListOptimizationStatistics optimization_statistics;
+        Painting::optimize_display_list(*display_list, &optimization_statistics);
+        dbgln("Optimized display list of {}: {}", url(), optimization_statistics);
+    } else {
+        Painting::optimize_display_list(*display_list);
+    }
+
     display_list->set_device_pixels_per_css_pixel(page().client().device_pixels_per_css_pixel());
     display_list->set_scroll_state(viewport_paintable.scroll_state());
 
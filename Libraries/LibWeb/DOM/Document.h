@@ -245,6 +245,7 @@ public:
     void update_animated_style_if_needed();
 
     void set_needs_layout();
+    void set_needs_incremental_layout();
 
     void invalidate_layout_tree();
     void invalidate_stacking_context_tree();
@@ -717,6 +718,9 @@ public:
     void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
+    void did_record_canvas_drawing_commands(HTML::HTMLCanvasElement&);
+    void flush_pending_canvas_drawing_commands();
+
     struct PaintConfig {
         bool paint_overlay { false };
         bool should_show_line_box_borders { false };
@@ -728,6 +732,7 @@ public:
     RefPtr<Painting::DisplayList> record_display_list(PaintConfig);
 
     void invalidate_display_list();
+    void invalidate_display_list(Painting::StackingContext&);
 
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
@@ -789,6 +794,9 @@ private:
 
     GC::Ptr<Layout::Viewport> m_layout_root;
 
+    // The result of the last layout, kept around so that unchanged layout boundaries can skip the next one.
+    OwnPtr<Layout::LayoutState> m_previous_layout_state;
+
     Optional<Color> m_normal_link_color;
     Optional<Color> m_active_link_color;
     Optional<Color> m_visited_link_color;
@@ -871,6 +879,7 @@ private:
     Vector<WeakPtr<CSS::MediaQueryList>> m_media_query_lists;
 
     bool m_needs_layout { false };
+    bool m_needs_full_layout { true };
 
     bool m_needs_full_style_update { false };
 
@@ -1023,6 +1032,9 @@ private:
 
     bool m_needs_repaint { false };
 
+    // Canvases whose drawing commands haven't been played back into their painting surface yet.
+    HashTable<GC::Ref<HTML::HTMLCanvasElement>> m_canvases_with_pending_drawing_commands;
+
     bool m_enable_cookies_on_file_domains { false };
 
     Optional<PaintConfig> m_cached_display_list_paint_config;
@@ -109,7 +109,7 @@ WebIDL::ExceptionOr<void> File::serialization_steps(HTML::SerializationRecord& r
     return {};
 }
 
-WebIDL::ExceptionOr<void> File::deserialization_steps(ReadonlySpan<u32> const& record, size_t& position, HTML::DeserializationMemory&)
+WebIDL::ExceptionOr<void> File::deserialization_steps(ReadonlyBytes record, size_t& position, HTML::DeserializationMemory&)
 {
     auto& vm = this->vm();
 
@@ -126,7 +126,7 @@ WebIDL::ExceptionOr<void> File::deserialization_steps(ReadonlySpan<u32> const& r
     m_name = TRY(HTML::deserialize_string(vm, record, position));
 
     // 4. Initialize the value of value’s lastModified attribute to serialized.[[LastModified]].
-    m_last_modified = HTML::deserialize_primitive_type<i64>(record, position);
+    m_last_modified = TRY(HTML::deserialize_primitive_type<i64>(vm, record, position));
 
     return {};
 }
@@ -60,16 +60,16 @@ WebIDL::ExceptionOr<void> FileList::serialization_steps(HTML::SerializationRecor
     return {};
 }
 
-WebIDL::ExceptionOr<void> FileList::deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
+WebIDL::ExceptionOr<void> FileList::deserialization_steps(ReadonlyBytes serialized, size_t& position, HTML::DeserializationMemory& memory)
 {
     auto& vm = this->vm();
     auto& realm = *vm.current_realm();
 
     // 1. For each file of serialized.[[Files]], add the sub-deserialization of file to value.
-    auto size = HTML::deserialize_primitive_type<size_t>(serialized, position);
+    auto size = TRY(HTML::deserialize_primitive_type<size_t>(vm, serialized, position));
     for (size_t i = 0; i < size; ++i) {
         auto deserialized_record = TRY(HTML::structured_deserialize_internal(vm, serialized, realm, memory, position));
-        if (deserialized_record.value.has_value() && is<File>(deserialized_record.value.value().as_object()))
+        if (deserialized_record.value.has_value() && deserialized_record.value->is_object() && is<File>(deserialized_record.value->as_object()))
             m_files.append(dynamic_cast<File&>(deserialized_record.value.release_value().as_object()));
         position = deserialized_record.position;
     }
@@ -47,7 +47,7 @@ public:
 
     virtual StringView interface_name() const override { return "FileList"sv; }
     virtual WebIDL::ExceptionOr<void> serialization_steps(HTML::SerializationRecord& serialized, bool for_storage, HTML::SerializationMemory&) override;
-    virtual WebIDL::ExceptionOr<void> deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory&) override;
+    virtual WebIDL::ExceptionOr<void> deserialization_steps(ReadonlyBytes serialized, size_t& position, HTML::DeserializationMemory&) override;
 
 private:
     explicit FileList(JS::Realm&);
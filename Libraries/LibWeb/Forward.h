@@ -78,6 +78,7 @@ enum class RequestPriority;
 enum class RequestRedirect;
 enum class ResizeObserverBoxOptions;
 enum class ResponseType;
+enum class TaskPriority;
 enum class TextTrackKind;
 enum class XMLHttpRequestResponseType;
 }
@@ -243,6 +244,7 @@ struct StyleSheetIdentifier;
 namespace Web::CSS::Parser {
 class ComponentValue;
 class Parser;
+class ParsingContext;
 class Token;
 class Tokenizer;
 
@@ -704,6 +706,11 @@ namespace Web::ResizeObserver {
 class ResizeObserver;
 }
 
+namespace Web::Scheduling {
+class Scheduler;
+struct SchedulerPostTaskOptions;
+}
+
 namespace Web::Selection {
 class Selection;
 }
@@ -762,21 +762,21 @@ WebIDL::ExceptionOr<void> DOMMatrixReadOnly::serialization_steps(HTML::Serializa
 }
 
 // https://drafts.fxtf.org/geometry/#structured-serialization
-WebIDL::ExceptionOr<void> DOMMatrixReadOnly::deserialization_steps(ReadonlySpan<u32> const& record, size_t& position, HTML::DeserializationMemory&)
+WebIDL::ExceptionOr<void> DOMMatrixReadOnly::deserialization_steps(ReadonlyBytes record, size_t& position, HTML::DeserializationMemory&)
 {
-    bool is_2d = HTML::deserialize_primitive_type<bool>(record, position);
+    bool is_2d = TRY(HTML::deserialize_primitive_type<bool>(vm(), record, position));
     // 1. If serialized.[[Is2D]] is true:
     if (is_2d) {
         // 1. Set value’s m11 element to serialized.[[M11]].
-        double m11 = HTML::deserialize_primitive_type<double>(record, position);
+        double m11 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 2. Set value’s m12 element to serialized.[[M12]].
-        double m12 = HTML::deserialize_primitive_type<double>(record, position);
+        double m12 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 3. Set value’s m13 element to 0.
         // 4. Set value’s m14 element to 0.
         // 5. Set value’s m21 element to serialized.[[M21]].
-        double m21 = HTML::deserialize_primitive_type<double>(record, position);
+        double m21 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 6. Set value’s m22 element to serialized.[[M22]].
-        double m22 = HTML::deserialize_primitive_type<double>(record, position);
+        double m22 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 7. Set value’s m23 element to 0.
         // 8. Set value’s m24 element to 0.
         // 9. Set value’s m31 element to 0.
@@ -784,9 +784,9 @@ WebIDL::ExceptionOr<void> DOMMatrixReadOnly::deserialization_steps(ReadonlySpan<
         // 11. Set value’s m33 element to 1.
         // 12. Set value’s m34 element to 0.
         // 13. Set value’s m41 element to serialized.[[M41]].
-        double m41 = HTML::deserialize_primitive_type<double>(record, position);
+        double m41 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 14 Set value’s m42 element to serialized.[[M42]].
-        double m42 = HTML::deserialize_primitive_type<double>(record, position);
+        double m42 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 15. Set value’s m43 element to 0.
         // 16. Set value’s m44 element to 1.
         // 17. Set value’s is 2D to true.
@@ -796,37 +796,37 @@ WebIDL::ExceptionOr<void> DOMMatrixReadOnly::deserialization_steps(ReadonlySpan<
     // 2. Otherwise:
     else {
         // 1. Set value’s m11 element to serialized.[[M11]].
-        double m11 = HTML::deserialize_primitive_type<double>(record, position);
+        double m11 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 2. Set value’s m12 element to serialized.[[M12]].
-        double m12 = HTML::deserialize_primitive_type<double>(record, position);
+        double m12 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 3. Set value’s m13 element to serialized.[[M13]].
-        double m13 = HTML::deserialize_primitive_type<double>(record, position);
+        double m13 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 4. Set value’s m14 element to serialized.[[M14]].
-        double m14 = HTML::deserialize_primitive_type<double>(record, position);
+        double m14 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 5. Set value’s m21 element to serialized.[[M21]].
-        double m21 = HTML::deserialize_primitive_type<double>(record, position);
+        double m21 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 6. Set value’s m22 element to serialized.[[M22]].
-        double m22 = HTML::deserialize_primitive_type<double>(record, position);
+        double m22 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 7. Set value’s m23 element to serialized.[[M23]].
-        double m23 = HTML::deserialize_primitive_type<double>(record, position);
+        double m23 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 8. Set value’s m24 element to serialized.[[M24]].
-        double m24 = HTML::deserialize_primitive_type<double>(record, position);
+        double m24 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 9. Set value’s m31 element to serialized.[[M31]].
-        double m31 = HTML::deserialize_primitive_type<double>(record, position);
+        double m31 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 10. Set value’s m32 element to serialized.[[M32]].
-        double m32 = HTML::deserialize_primitive_type<double>(record, position);
+        double m32 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 11. Set value’s m33 element to serialized.[[M33]].
-        double m33 = HTML::deserialize_primitive_type<double>(record, position);
+        double m33 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 12. Set value’s m34 element to serialized.[[M34]].
-        double m34 = HTML::deserialize_primitive_type<double>(record, position);
+        double m34 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 13. Set value’s m41 element to serialized.[[M41]].
-        double m41 = HTML::deserialize_primitive_type<double>(record, position);
+        double m41 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 14. Set value’s m42 element to serialized.[[M42]].
-        double m42 = HTML::deserialize_primitive_type<double>(record, position);
+        double m42 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 15. Set value’s m43 element to serialized.[[M43]].
-        double m43 = HTML::deserialize_primitive_type<double>(record, position);
+        double m43 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 16. Set value’s m44 element to serialized.[[M44]].
-        double m44 = HTML::deserialize_primitive_type<double>(record, position);
+        double m44 = TRY(HTML::deserialize_primitive_type<double>(vm(), record, position));
         // 17. Set value’s is 2D to false.
 
         initialize_from_create_3d_matrix(m11, m12, m13, m14, m21, m22, m23, m24, m31, m32, m33, m34, m41, m42, m43, m44);
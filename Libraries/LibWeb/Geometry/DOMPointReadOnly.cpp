@@ -80,16 +80,16 @@ WebIDL::ExceptionOr<void> DOMPointReadOnly::serialization_steps(HTML::Serializat
     return {};
 }
 
-WebIDL::ExceptionOr<void> DOMPointReadOnly::deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory&)
+WebIDL::ExceptionOr<void> DOMPointReadOnly::deserialization_steps(ReadonlyBytes serialized, size_t& position, HTML::DeserializationMemory&)
 {
     // 1. Set value’s x coordinate to serialized.[[X]].
-    m_x = HTML::deserialize_primitive_type<double>(serialized, position);
+    m_x = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
     // 2. Set value’s y coordinate to serialized.[[Y]].
-    m_y = HTML::deserialize_primitive_type<double>(serialized, position);
+    m_y = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
     // 3. Set value’s z coordinate to serialized.[[Z]].
-    m_z = HTML::deserialize_primitive_type<double>(serialized, position);
+    m_z = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
     // 4. Set value’s w coordinate to serialized.[[W]].
-    m_w = HTML::deserialize_primitive_type<double>(serialized, position);
+    m_w = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
     return {};
 }
 
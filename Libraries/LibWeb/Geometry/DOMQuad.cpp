@@ -118,30 +118,30 @@ WebIDL::ExceptionOr<void> DOMQuad::serialization_steps(HTML::SerializationRecord
 }
 
 // https://drafts.fxtf.org/geometry/#structured-serialization
-WebIDL::ExceptionOr<void> DOMQuad::deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
+WebIDL::ExceptionOr<void> DOMQuad::deserialization_steps(ReadonlyBytes serialized, size_t& position, HTML::DeserializationMemory& memory)
 {
     auto& realm = this->realm();
     // 1. Set value’s point 1 to the sub-deserialization of serialized.[[P1]].
     auto deserialized_record = TRY(HTML::structured_deserialize_internal(vm(), serialized, realm, memory, position));
-    if (deserialized_record.value.has_value() && is<DOMPoint>(deserialized_record.value.value().as_object()))
+    if (deserialized_record.value.has_value() && deserialized_record.value->is_object() && is<DOMPoint>(deserialized_record.value->as_object()))
         m_p1 = dynamic_cast<DOMPoint&>(deserialized_record.value.release_value().as_object());
     position = deserialized_record.position;
 
     // 2. Set value’s point 2 to the sub-deserialization of serialized.[[P2]].
     deserialized_record = TRY(HTML::structured_deserialize_internal(vm(), serialized, realm, memory, position));
-    if (deserialized_record.value.has_value() && is<DOMPoint>(deserialized_record.value.value().as_object()))
+    if (deserialized_record.value.has_value() && deserialized_record.value->is_object() && is<DOMPoint>(deserialized_record.value->as_object()))
         m_p2 = dynamic_cast<DOMPoint&>(deserialized_record.value.release_value().as_object());
     position = deserialized_record.position;
 
     // 3. Set value’s point 3 to the sub-deserialization of serialized.[[P3]].
     deserialized_record = TRY(HTML::structured_deserialize_internal(vm(), serialized, realm, memory, position));
-    if (deserialized_record.value.has_value() && is<DOMPoint>(deserialized_record.value.value().as_object()))
+    if (deserialized_record.value.has_value() && deserialized_record.value->is_object() && is<DOMPoint>(deserialized_record.value->as_object()))
         m_p3 = dynamic_cast<DOMPoint&>(deserialized_record.value.release_value().as_object());
     position = deserialized_record.position;
 
     // 4. Set value’s point 4 to the sub-deserialization of serialized.[[P4]].
     deserialized_record = TRY(HTML::structured_deserialize_internal(vm(), serialized, realm, memory, position));
-    if (deserialized_record.value.has_value() && is<DOMPoint>(deserialized_record.value.value().as_object()))
+    if (deserialized_record.value.has_value() && deserialized_record.value->is_object() && is<DOMPoint>(deserialized_record.value->as_object()))
         m_p4 = dynamic_cast<DOMPoint&>(deserialized_record.value.release_value().as_object());
     position = deserialized_record.position;
 
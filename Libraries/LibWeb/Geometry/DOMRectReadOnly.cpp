@@ -66,16 +66,16 @@ WebIDL::ExceptionOr<void> DOMRectReadOnly::serialization_steps(HTML::Serializati
 }
 
 // https://drafts.fxtf.org/geometry/#structured-serialization
-WebIDL::ExceptionOr<void> DOMRectReadOnly::deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory&)
+WebIDL::ExceptionOr<void> DOMRectReadOnly::deserialization_steps(ReadonlyBytes serialized, size_t& position, HTML::DeserializationMemory&)
 {
     // 1. Set value’s x coordinate to serialized.[[X]].
-    auto x = HTML::deserialize_primitive_type<double>(serialized, position);
+    auto x = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
     // 2. Set value’s y coordinate to serialized.[[Y]].
-    auto y = HTML::deserialize_primitive_type<double>(serialized, position);
+    auto y = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
     // 3. Set value’s width to serialized.[[Width]].
-    auto width = HTML::deserialize_primitive_type<double>(serialized, position);
+    auto width = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
     // 4. Set value’s height to serialized.[[Height]].
-    auto height = HTML::deserialize_primitive_type<double>(serialized, position);
+    auto height = TRY(HTML::deserialize_primitive_type<double>(vm(), serialized, position));
 
     m_rect = { x, y, width, height };
 
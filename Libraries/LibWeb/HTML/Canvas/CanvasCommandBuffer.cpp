@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/HTML/Canvas/CanvasCommandBuffer.h>
+
+namespace Web::HTML {
+
+NonnullOwnPtr<CanvasCommandBuffer> CanvasCommandBuffer::create(NonnullOwnPtr<Gfx::Painter> target)
+{
+    return adopt_own(*new CanvasCommandBuffer(move(target)));
+}
+
+CanvasCommandBuffer::CanvasCommandBuffer(NonnullOwnPtr<Gfx::Painter> target)
+    : m_target(move(target))
+{
+}
+
+CanvasCommandBuffer::~CanvasCommandBuffer() = default;
+
+void CanvasCommandBuffer::append(Command&& command)
+{
+    if (m_commands.size() >= max_pending_commands)
+        flush();
+    m_commands.append(move(command));
+}
+
+void CanvasCommandBuffer::clear_rect(Gfx::FloatRect const& rect, Gfx::Color color)
+{
+    append(ClearRect { rect, color });
+}
+
+// NOTE: The canvas only ever paints with source-over compositing, so anything drawn fully transparent
+//       leaves the pixels untouched and is not worth recording.
+
+void CanvasCommandBuffer::fill_rect(Gfx::FloatRect const& rect, Gfx::Color color)
+{
+    if (color.alpha() == 0)
+        return;
+    append(FillRect { rect, color });
+}
+
+void CanvasCommandBuffer::draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode, float global_alpha)
+{
+    if (global_alpha <= 0.0f)
+        return;
+    append(DrawBitmap { dst_rect, src_bitmap, src_rect, scaling_mode, global_alpha });
+}
+
+void CanvasCommandBuffer::stroke_path(Gfx::Path const& path, Gfx::Color color, float thickness)
+{
+    if (path.is_empty() || thickness == 0.0f || color.alpha() == 0)
+        return;
+    append(StrokePath { path, color, thickness });
+}
+
+void CanvasCommandBuffer::fill_path(Gfx::Path const& path, Gfx::Color color, Gfx::WindingRule winding_rule)
+{
+    if (path.is_empty() || color.alpha() == 0)
+        return;
+    append(FillPath { path, color, winding_rule });
+}
+
+// Gradients and patterns stay mutable from script after they have been used (e.g. addColorStop()), so painting
+// with them can't be deferred. Everything recorded so far is played back first to keep the painting order intact.
+
+void CanvasCommandBuffer::stroke_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, float thickness, float global_alpha)
+{
+    flush();
+    m_target->stroke_path(path, paint_style, thickness, global_alpha);
+}
+
+void CanvasCommandBuffer::fill_path(Gfx::Path const& path, Gfx::PaintStyle const& paint_style, float global_alpha, Gfx::WindingRule winding_rule)
+{
+    flush();
+    m_target->fill_path(path, paint_style, global_alpha, winding_rule);
+}
+
+void CanvasCommandBuffer::set_transform(Gfx::AffineTransform const& transform)
+{
+    // Only the last of several consecutive transform changes can affect anything.
+    if (!m_commands.is_empty()) {
+        if (auto* last_transform = m_commands.last().get_pointer<SetTransform>()) {
+            last_transform->transform = transform;
+            return;
+        }
+    }
+    append(SetTransform { transform });
+}
+
+void CanvasCommandBuffer::save()
+{
+    append(Save {});
+}
+
+void CanvasCommandBuffer::restore()
+{
+    // A save/restore pair that only wraps state changes has no visible effect, so the whole group is dropped.
+    for (size_t i = m_commands.size(); i > 0; --i) {
+        auto const& command = m_commands[i - 1];
+        if (command.has<Save>()) {
+            m_commands.shrink(i - 1);
+            return;
+        }
+        if (!command.has<SetTransform>() && !command.has<Clip>())
+            break;
+    }
+    append(Restore {});
+}
+
+void CanvasCommandBuffer::clip(Gfx::Path const& path, Gfx::WindingRule winding_rule)
+{
+    append(Clip { path, winding_rule });
+}
+
+void CanvasCommandBuffer::flush()
+{
+    for (auto const& command : m_commands) {
+        command.visit(
+            [&](ClearRect const& command) { m_target->clear_rect(command.rect, command.color); },
+            [&](FillRect const& command) { m_target->fill_rect(command.rect, command.color); },
+            [&](DrawBitmap const& command) { m_target->draw_bitmap(command.dst_rect, command.bitmap, command.src_rect, command.scaling_mode, command.global_alpha); },
+            [&](StrokePath const& command) { m_target->stroke_path(command.path, command.color, command.thickness); },
+            [&](FillPath const& command) { m_target->fill_path(command.path, command.color, command.winding_rule); },
+            [&](SetTransform const& command) { m_target->set_transform(command.transform); },
+            [&](Save const&) { m_target->save(); },
+            [&](Restore const&) { m_target->restore(); },
+            [&](Clip const& command) { m_target->clip(command.path, command.winding_rule); });
+    }
+    m_commands.clear_with_capacity();
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibGfx/AffineTransform.h>
+#include <LibGfx/Color.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/Path.h>
+#include <LibGfx/Rect.h>
+
+namespace Web::HTML {
+
+// A painter that records the drawing operations of a 2D canvas context instead of running them right away.
+// The recorded commands are played back into the real painter in one go, once something needs the pixels
+// of the canvas (presenting it, reading it back, or using it as an image source).
+class CanvasCommandBuffer final : public Gfx::Painter {
+public:
+    static NonnullOwnPtr<CanvasCommandBuffer> create(NonnullOwnPtr<Gfx::Painter>);
+
+    virtual ~CanvasCommandBuffer() override;
+
+    virtual void clear_rect(Gfx::FloatRect const&, Gfx::Color) override;
+    virtual void fill_rect(Gfx::FloatRect const&, Gfx::Color) override;
+    virtual void draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode, float global_alpha) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::Color, float thickness) override;
+    virtual void stroke_path(Gfx::Path const&, Gfx::PaintStyle const&, float thickness, float global_alpha) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::Color, Gfx::WindingRule) override;
+    virtual void fill_path(Gfx::Path const&, Gfx::PaintStyle const&, float global_alpha, Gfx::WindingRule) override;
+    virtual void set_transform(Gfx::AffineTransform const&) override;
+    virtual void save() override;
+    virtual void restore() override;
+    virtual void clip(Gfx::Path const&, Gfx::WindingRule) override;
+
+    bool has_pending_commands() const { return !m_commands.is_empty(); }
+
+    // Plays back all recorded commands into the target painter.
+    void flush();
+
+private:
+    explicit CanvasCommandBuffer(NonnullOwnPtr<Gfx::Painter>);
+
+    struct ClearRect {
+        Gfx::FloatRect rect;
+        Gfx::Color color;
+    };
+
+    struct FillRect {
+        Gfx::FloatRect rect;
+        Gfx::Color color;
+    };
+
+    struct DrawBitmap {
+        Gfx::FloatRect dst_rect;
+        NonnullRefPtr<Gfx::ImmutableBitmap const> bitmap;
+        Gfx::IntRect src_rect;
+        Gfx::ScalingMode scaling_mode;
+        float global_alpha;
+    };
+
+    struct StrokePath {
+        Gfx::Path path;
+        Gfx::Color color;
+        float thickness;
+    };
+
+    struct FillPath {
+        Gfx::Path path;
+        Gfx::Color color;
+        Gfx::WindingRule winding_rule;
+    };
+
+    struct SetTransform {
+        Gfx::AffineTransform transform;
+    };
+
+    struct Save { };
+
+    struct Restore { };
+
+    struct Clip {
+        Gfx::Path path;
+        Gfx::WindingRule winding_rule;
+    };
+
+    using Command = Variant<
+        ClearRect,
+        FillRect,
+        DrawBitmap,
+        StrokePath,
+        FillPath,
+        SetTransform,
+        Save,
+        Restore,
+        Clip>;
+
+    // Recording is bounded, so a canvas that is drawn to but never observed does not grow without limit.
+    static constexpr size_t max_pending_commands = 8192;
+
+    void append(Command&&);
+
+    NonnullOwnPtr<Gfx::Painter> m_target;
+    Vector<Command> m_commands;
+};
+
+}
@@ -131,6 +131,7 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::draw_image_internal(CanvasIm
             return source->current_image_bitmap();
         },
         [](GC::Root<HTMLCanvasElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> {
+            source->flush_pending_drawing_commands();
             auto surface = source->surface();
             if (!surface)
                 return {};
@@ -193,6 +194,9 @@ void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
     // FIXME: Make use of the rect to reduce the invalidated area when possible.
     if (!canvas_element().paintable())
         return;
+    // The display list doesn't need to be recorded again, since it only references the canvas' painting surface. The
+    // drawing commands are played back into the surface before the next frame is painted.
+    canvas_element().document().did_record_canvas_drawing_commands(canvas_element());
     canvas_element().paintable()->set_needs_display(InvalidateDisplayList::No);
 }
 
@@ -202,11 +206,19 @@ Gfx::Painter* CanvasRenderingContext2D::painter()
         if (!canvas_element().allocate_painting_surface())
             return nullptr;
         canvas_element().document().invalidate_display_list();
-        m_painter = make<Gfx::PainterSkia>(*canvas_element().surface());
+        m_painter = nullptr;
     }
+    if (!m_painter)
+        m_painter = CanvasCommandBuffer::create(make<Gfx::PainterSkia>(*canvas_element().surface()));
     return m_painter.ptr();
 }
 
+void CanvasRenderingContext2D::flush_pending_drawing_commands() const
+{
+    if (m_painter)
+        m_painter->flush();
+}
+
 Gfx::Path CanvasRenderingContext2D::text_path(StringView text, float x, float y, Optional<double> max_width)
 {
     if (max_width.has_value() && max_width.value() <= 0)
@@ -399,9 +411,10 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = canvas_element().surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
+    flush_pending_drawing_commands();
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -412,17 +425,14 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    ASSERT(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
+    // NOTE: The pixels are converted straight from the surface into imageData's buffer, without an intermediate bitmap.
     ASSERT(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
-
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, drawing_state().global_alpha);
+    surface->read_into_bitmap(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
     // NOTE: No-op, already done during creation.
@@ -431,13 +441,19 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     return image_data;
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-putimagedata
 void CanvasRenderingContext2D::put_image_data(ImageData const& image_data, float x, float y)
 {
-    if (auto* painter = this->painter()) {
-        auto dst_rect = Gfx::FloatRect(x, y, image_data.width(), image_data.height());
-        painter->draw_bitmap(dst_rect, Gfx::ImmutableBitmap::create(image_data.bitmap()), image_data.bitmap().rect(), Gfx::ScalingMode::NearestNeighbor, 1.0f);
-        did_draw(dst_rect);
-    }
+    if (!painter())
+        return;
+
+    // NOTE: putImageData() replaces pixels directly, unaffected by the current transform, clip, global alpha and compositing.
+    //       Anything recorded before it has to land in the surface first.
+    flush_pending_drawing_commands();
+
+    auto destination = Gfx::IntPoint(x, y);
+    canvas_element().surface()->write_from_bitmap(image_data.bitmap(), destination);
+    did_draw(Gfx::FloatRect(destination.to_type<float>(), image_data.bitmap().size().to_type<float>()));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
@@ -448,6 +464,9 @@ void CanvasRenderingContext2D::reset_to_default_state()
     // 1. Clear canvas's bitmap to transparent black.
     if (surface) {
         painter()->clear_rect(surface->rect().to_type<float>(), Color::Transparent);
+    } else {
+        // The bitmap has been discarded, so have anything still recorded for it go with it.
+        m_painter = nullptr;
     }
 
     // 2. Empty the list of subpaths in context's current default path.
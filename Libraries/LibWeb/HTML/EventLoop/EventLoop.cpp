@@ -160,6 +160,7 @@ void EventLoop::process()
     // 2. If the event loop has a task queue with at least one runnable task, then:
     if (m_task_queue->has_runnable_tasks()) {
         // 1. Let taskQueue be one such task queue, chosen in an implementation-defined manner.
+        // NOTE: Our task queue keeps tasks of each priority apart, and picks one of them in take_first_runnable().
         auto task_queue = m_task_queue;
 
         // 2. Set taskStartTime to the unsafe shared current time.
@@ -377,6 +378,11 @@ void EventLoop::update_the_rendering()
     // FIXME: 21. For each doc of docs, mark paint timing for doc.
 
     // 22. For each doc of docs, update the rendering or user interface of doc and its node navigable to reflect the current state.
+    // NOTE: Canvas drawing commands are flushed for all documents first, since nested documents are painted along with
+    //       their container document.
+    for (auto& document : docs)
+        document->flush_pending_canvas_drawing_commands();
+
     for (auto& document : docs) {
         document->page().client().process_screenshot_requests();
         auto navigable = document->navigable();
@@ -28,6 +28,7 @@ GC::Ref<Task> Task::create(JS::VM& vm, Source source, GC::Ptr<DOM::Document cons
 Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
     : m_id(allocate_task_id())
     , m_source(source)
+    , m_priority(priority_for_source(source))
     , m_steps(steps)
     , m_document(document)
 {
@@ -35,6 +36,24 @@ Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Fun
 
 Task::~Task() = default;
 
+Task::Priority Task::priority_for_source(Source source)
+{
+    switch (source) {
+    case Source::UserInteraction:
+    case Source::Rendering:
+        return Priority::UserBlocking;
+    case Source::TimerTask:
+    case Source::Networking:
+    case Source::WebSocket:
+    case Source::RemoteEvent:
+        return Priority::Deferrable;
+    case Source::IdleTask:
+        return Priority::Background;
+    default:
+        return Priority::UserVisible;
+    }
+}
+
 void Task::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/DistinctNumeric.h>
+#include <AK/Time.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/Forward.h>
@@ -71,12 +72,33 @@ public:
         // https://websockets.spec.whatwg.org/#websocket-task-source
         WebSocket,
 
+        // https://wicg.github.io/scheduling-apis/#posted-task-task-source
+        PostedTask,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
         UniqueTaskSourceStart
     };
 
+    // The order in which the event loop picks tasks from its task queue. Tasks of a higher priority always run before
+    // tasks of a lower priority, unless the latter have been waiting for too long (see TaskQueue).
+    // NOTE: The first three match the priorities of https://wicg.github.io/scheduling-apis/#sec-task-priorities, and
+    //       all tasks from the same task source have the same priority, so that they still run in the order they were queued.
+    enum class Priority : u8 {
+        // User input and rendering, which the user is waiting on.
+        UserBlocking,
+        // Everything that has not been given a priority of its own.
+        UserVisible,
+        // Timers and networking, which can usually wait a little longer.
+        Deferrable,
+        // Work that was explicitly posted as low priority, e.g. scheduler.postTask() with a "background" priority.
+        Background,
+    };
+    static constexpr size_t priority_count = to_underlying(Priority::Background) + 1;
+
+    static Priority priority_for_source(Source);
+
     static GC::Ref<Task> create(JS::VM&, Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
     virtual ~Task() override;
@@ -85,6 +107,17 @@ public:
     Source source() const { return m_source; }
     void execute();
 
+    Priority priority() const { return m_priority; }
+    void set_priority(Priority priority) { m_priority = priority; }
+
+    // Continuations (see https://wicg.github.io/scheduling-apis/#dom-scheduler-yield) run before the other tasks of
+    // their priority.
+    bool is_continuation() const { return m_is_continuation; }
+    void set_is_continuation(bool is_continuation) { m_is_continuation = is_continuation; }
+
+    MonotonicTime queued_time() const { return m_queued_time; }
+    void set_queued_time(MonotonicTime queued_time) { m_queued_time = queued_time; }
+
     DOM::Document const* document() const;
 
     bool is_runnable() const;
@@ -96,6 +129,9 @@ private:
 
     TaskID m_id {};
     Source m_source { Source::Unspecified };
+    Priority m_priority { Priority::UserVisible };
+    bool m_is_continuation { false };
+    MonotonicTime m_queued_time { MonotonicTime::now_coarse() };
     GC::Ref<GC::Function<void()>> m_steps;
     GC::Ptr<DOM::Document const> m_document;
 };
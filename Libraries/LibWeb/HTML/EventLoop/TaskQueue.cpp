@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
 #include <LibGC/MarkedVector.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventLoop/TaskQueue.h>
@@ -23,23 +26,99 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (auto& tasks : m_tasks)
+        visitor.visit(tasks);
+    visitor.visit(m_last_added_task);
 }
 
 void TaskQueue::add(GC::Ref<Task> task)
 {
-    m_tasks.append(task);
+    auto& tasks = m_tasks[to_underlying(task->priority())];
+    task->set_queued_time(MonotonicTime::now_coarse());
+
+    if (task->is_continuation()) {
+        // Continuations go after the ones that are already queued, but before every other task.
+        auto index = tasks.find_first_index_if([](auto const& queued_task) { return !queued_task->is_continuation(); });
+        tasks.insert(index.value_or(tasks.size()), task);
+    } else {
+        tasks.append(task);
+    }
+
+    ++m_size;
+    m_last_added_task = task;
+
+    auto& statistics = m_statistics[to_underlying(task->priority())];
+    statistics.max_depth = max(statistics.max_depth, tasks.size());
+
     m_event_loop->schedule();
 }
 
+Optional<size_t> TaskQueue::index_of_first_runnable_task(Task::Priority priority) const
+{
+    return m_tasks[to_underlying(priority)].find_first_index_if([](auto const& task) { return task->is_runnable(); });
+}
+
+GC::Ref<Task> TaskQueue::take_task(Task::Priority priority, size_t index)
+{
+    auto task = m_tasks[to_underlying(priority)].take(index);
+    --m_size;
+
+    auto latency = MonotonicTime::now_coarse() - task->queued_time();
+
+    auto& statistics = m_statistics[to_underlying(priority)];
+    ++statistics.tasks_run;
+    statistics.total_latency += latency;
+    statistics.max_latency = max(statistics.max_latency, latency);
+
+    return task;
+}
+
 GC::Ptr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size(); ++i) {
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+    auto now = MonotonicTime::now_coarse();
+
+    Optional<Task::Priority> highest_priority;
+    Optional<size_t> highest_priority_index;
+    Optional<Task::Priority> starved_priority;
+    Optional<size_t> starved_index;
+    AK::Duration longest_wait;
+
+    for (size_t i = 0; i < Task::priority_count; ++i) {
+        auto priority = static_cast<Task::Priority>(i);
+
+        auto index = index_of_first_runnable_task(priority);
+        if (!index.has_value())
+            continue;
+
+        if (!highest_priority.has_value()) {
+            highest_priority = priority;
+            highest_priority_index = index;
+            continue;
+        }
+
+        auto wait = now - m_tasks[i][*index]->queued_time();
+        if (wait > max_task_delay && wait > longest_wait) {
+            starved_priority = priority;
+            starved_index = index;
+            longest_wait = wait;
+        }
+    }
+
+    if (starved_priority.has_value())
+        return take_task(*starved_priority, *starved_index);
+    if (highest_priority.has_value())
+        return take_task(*highest_priority, *highest_priority_index);
+    return nullptr;
+}
+
+GC::Ptr<Task> TaskQueue::dequeue()
+{
+    for (size_t i = 0; i < Task::priority_count; ++i) {
+        if (!m_tasks[i].is_empty())
+            return take_task(static_cast<Task::Priority>(i), 0);
     }
     return nullptr;
 }
@@ -49,8 +128,8 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
-        if (task->is_runnable())
+    for (size_t i = 0; i < Task::priority_count; ++i) {
+        if (index_of_first_runnable_task(static_cast<Task::Priority>(i)).has_value())
             return true;
     }
     return false;
@@ -58,43 +137,66 @@ bool TaskQueue::has_runnable_tasks() const
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
-    m_tasks.remove_all_matching([&](auto& task) {
-        return filter(*task);
-    });
+    for (auto& tasks : m_tasks) {
+        tasks.remove_all_matching([&](auto& task) {
+            if (!filter(*task))
+                return false;
+            --m_size;
+            return true;
+        });
+    }
 }
 
 GC::MarkedVector<GC::Ref<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
     GC::MarkedVector<GC::Ref<Task>> matching_tasks(heap());
 
-    for (size_t i = 0; i < m_tasks.size();) {
-        auto& task = m_tasks.at(i);
-
-        if (filter(*task)) {
-            matching_tasks.append(task);
-            m_tasks.remove(i);
-        } else {
-            ++i;
+    for (auto& tasks : m_tasks) {
+        for (size_t i = 0; i < tasks.size();) {
+            auto& task = tasks.at(i);
+
+            if (filter(*task)) {
+                matching_tasks.append(task);
+                tasks.remove(i);
+                --m_size;
+            } else {
+                ++i;
+            }
         }
     }
 
-    return matching_tasks;
-}
+    // Hand the tasks out in the order they were queued in, regardless of their priority.
+    quick_sort(matching_tasks, [](auto const& a, auto const& b) { return a->id() < b->id(); });
 
-Task const* TaskQueue::last_added_task() const
-{
-    if (m_tasks.is_empty())
-        return nullptr;
-    return m_tasks.last();
+    return matching_tasks;
 }
 
 bool TaskQueue::has_rendering_tasks() const
 {
-    for (auto const& task : m_tasks) {
+    for (auto const& task : m_tasks[to_underlying(Task::priority_for_source(Task::Source::Rendering))]) {
         if (task->source() == Task::Source::Rendering)
             return true;
     }
     return false;
 }
 
+String TaskQueue::dump_statistics() const
+{
+    static constexpr Array priority_names { "user-blocking"sv, "user-visible"sv, "deferrable"sv, "background"sv };
+    static_assert(priority_names.size() == Task::priority_count);
+
+    StringBuilder builder;
+    builder.appendff("{:15} {:>8} {:>10} {:>10} {:>14} {:>14}\n", "priority", "queued", "max queued", "tasks run", "avg latency ms", "max latency ms");
+
+    for (size_t i = 0; i < Task::priority_count; ++i) {
+        auto const& statistics = m_statistics[i];
+        auto average_latency = statistics.tasks_run == 0 ? 0.0 : static_cast<double>(statistics.total_latency.to_microseconds()) / static_cast<double>(statistics.tasks_run) / 1000.0;
+        auto max_latency = static_cast<double>(statistics.max_latency.to_microseconds()) / 1000.0;
+
+        builder.appendff("{:15} {:>8} {:>10} {:>10} {:>14.2} {:>14.2}\n", priority_names[i], m_tasks[i].size(), statistics.max_depth, statistics.tasks_run, average_latency, max_latency);
+    }
+
+    return MUST(builder.to_string());
+}
+
 }
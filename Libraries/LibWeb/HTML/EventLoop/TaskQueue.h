@@ -6,21 +6,37 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Queue.h>
+#include <AK/Time.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
 namespace Web::HTML {
 
+// Tasks are kept in one queue per priority, and the first runnable task of the highest priority runs next. To keep a
+// constant stream of high priority tasks (e.g. user input) from starving everything else, a task that has been
+// waiting for longer than `max_task_delay` runs next regardless of its priority.
 class TaskQueue : public JS::Cell {
     GC_CELL(TaskQueue, JS::Cell);
     GC_DECLARE_ALLOCATOR(TaskQueue);
 
 public:
+    static constexpr AK::Duration max_task_delay = AK::Duration::from_milliseconds(100);
+
+    struct Statistics {
+        size_t max_depth { 0 };
+        u64 tasks_run { 0 };
+        AK::Duration total_latency;
+        AK::Duration max_latency;
+    };
+
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty(); }
+    bool is_empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+    size_t size(Task::Priority priority) const { return m_tasks[to_underlying(priority)].size(); }
 
     bool has_runnable_tasks() const;
     bool has_rendering_tasks() const;
@@ -29,24 +45,30 @@ public:
     GC::Ptr<HTML::Task> take_first_runnable();
 
     void enqueue(GC::Ref<HTML::Task> task) { add(task); }
-    GC::Ptr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    GC::Ptr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     GC::MarkedVector<GC::Ref<Task>> take_tasks_matching(Function<bool(HTML::Task const&)>);
 
-    Task const* last_added_task() const;
+    Task const* last_added_task() const { return m_last_added_task.ptr(); }
+
+    Statistics const& statistics(Task::Priority priority) const { return m_statistics[to_underlying(priority)]; }
+    String dump_statistics() const;
 
 private:
     virtual void visit_edges(Visitor&) override;
 
+    Optional<size_t> index_of_first_runnable_task(Task::Priority) const;
+    GC::Ref<Task> take_task(Task::Priority, size_t index);
+
     GC::Ref<HTML::EventLoop> m_event_loop;
 
-    Vector<GC::Ref<HTML::Task>> m_tasks;
+    Array<Vector<GC::Ref<HTML::Task>>, Task::priority_count> m_tasks;
+    size_t m_size { 0 };
+
+    GC::Ptr<HTML::Task> m_last_added_task;
+
+    Array<Statistics, Task::priority_count> m_statistics;
 };
 
 }
@@ -275,6 +275,7 @@ String HTMLCanvasElement::to_data_url(StringView type, JS::Value quality)
         return "data:,"_string;
 
     // 3. Let file be a serialization of this canvas element's bitmap as a file, passing type and quality if given.
+    flush_pending_drawing_commands();
     auto snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*m_surface);
     auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, m_surface->size()));
     m_surface->read_into_bitmap(*bitmap);
@@ -310,6 +311,7 @@ WebIDL::ExceptionOr<void> HTMLCanvasElement::to_blob(GC::Ref<WebIDL::CallbackTyp
     // 3. If this canvas element's bitmap has pixels (i.e., neither its horizontal dimension nor its vertical dimension is zero),
     //    then set result to a copy of this canvas element's bitmap.
     if (m_surface) {
+        flush_pending_drawing_commands();
         bitmap_result = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, m_surface->size()));
         m_surface->read_into_bitmap(*bitmap_result);
     }
@@ -344,13 +346,15 @@ WebIDL::ExceptionOr<void> HTMLCanvasElement::to_blob(GC::Ref<WebIDL::CallbackTyp
 
 void HTMLCanvasElement::present()
 {
+    flush_pending_drawing_commands();
+
     if (m_surface) {
         m_surface->flush();
     }
 
     m_context.visit(
         [](GC::Ref<CanvasRenderingContext2D>&) {
-            // Do nothing, CRC2D writes directly to the canvas bitmap.
+            // Do nothing, CRC2D's recorded commands have been played back into the canvas bitmap above.
         },
         [](GC::Ref<WebGL::WebGLRenderingContext>& context) {
             context->present();
@@ -360,4 +364,10 @@ void HTMLCanvasElement::present()
         });
 }
 
+void HTMLCanvasElement::flush_pending_drawing_commands()
+{
+    if (auto* context = m_context.get_pointer<GC::Ref<CanvasRenderingContext2D>>())
+        (*context)->flush_pending_drawing_commands();
+}
+
 }
@@ -40,6 +40,9 @@ public:
 
     void present();
 
+    // Plays back drawing commands that the 2D context has recorded but not yet painted into the surface.
+    void flush_pending_drawing_commands();
+
 private:
     HTMLCanvasElement(DOM::Document&, DOM::QualifiedName);
 
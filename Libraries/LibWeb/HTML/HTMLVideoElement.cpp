@@ -19,7 +19,7 @@
 #include <LibWeb/HTML/VideoTrack.h>
 #include <LibWeb/HTML/VideoTrackList.h>
 #include <LibWeb/Layout/VideoBox.h>
-#include <LibWeb/Painting/Paintable.h>
+#include <LibWeb/Painting/VideoPaintable.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
@@ -118,11 +118,33 @@ void HTMLVideoElement::set_video_track(GC::Ptr<HTML::VideoTrack> video_track)
     m_video_track = video_track;
 }
 
-void HTMLVideoElement::set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, double position)
+void HTMLVideoElement::set_current_frame(Badge<VideoTrack>, NonnullRefPtr<Media::VideoFramePool> frame_pool, NonnullRefPtr<Media::VideoFramePool::Surface> frame, double position)
 {
-    m_current_frame = { move(frame), position };
-    if (paintable())
-        paintable()->set_needs_display();
+    auto* paintable = this->paintable();
+
+    // If the display list draws whatever frame the pool presents, the new frame only has to be painted, not recorded.
+    auto should_invalidate_display_list = InvalidateDisplayList::Yes;
+    if (paintable && is<Painting::VideoPaintable>(*paintable)) {
+        if (static_cast<Painting::VideoPaintable const&>(*paintable).can_present_frame_without_recording(frame_pool, frame->size()))
+            should_invalidate_display_list = InvalidateDisplayList::No;
+    }
+
+    m_current_frame = { move(frame_pool), move(frame), position };
+    m_current_frame_bitmap = nullptr;
+    if (paintable)
+        paintable->set_needs_display(should_invalidate_display_list);
+}
+
+RefPtr<Gfx::Bitmap> HTMLVideoElement::bitmap() const
+{
+    if (!m_current_frame.frame)
+        return nullptr;
+
+    // NOTE: The frame's surface is reused for later frames once we move on from it, so hand out a copy of its contents.
+    //       The copy is made once per frame, however often the frame is drawn to a canvas.
+    if (!m_current_frame_bitmap)
+        m_current_frame_bitmap = m_current_frame.frame->bitmap().clone().release_value_but_fixme_should_propagate_errors();
+    return m_current_frame_bitmap;
 }
 
 void HTMLVideoElement::on_playing()
@@ -8,6 +8,7 @@
 
 #include <AK/Optional.h>
 #include <LibGfx/Forward.h>
+#include <LibMedia/VideoFramePool.h>
 #include <LibWeb/DOM/DocumentLoadEventDelayer.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/HTMLMediaElement.h>
@@ -16,7 +17,8 @@
 namespace Web::HTML {
 
 struct VideoFrame {
-    RefPtr<Gfx::Bitmap> frame;
+    RefPtr<Media::VideoFramePool> frame_pool;
+    RefPtr<Media::VideoFramePool::Surface> frame;
     double position { 0.0 };
 };
 
@@ -38,15 +40,12 @@ public:
 
     void set_video_track(GC::Ptr<VideoTrack>);
 
-    void set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap> frame, double position);
+    void set_current_frame(Badge<VideoTrack>, NonnullRefPtr<Media::VideoFramePool> frame_pool, NonnullRefPtr<Media::VideoFramePool::Surface> frame, double position);
     VideoFrame const& current_frame() const { return m_current_frame; }
     RefPtr<Gfx::Bitmap> const& poster_frame() const { return m_poster_frame; }
 
     // FIXME: This is a hack for images used as CanvasImageSource. Do something more elegant.
-    RefPtr<Gfx::Bitmap> bitmap() const
-    {
-        return current_frame().frame;
-    }
+    RefPtr<Gfx::Bitmap> bitmap() const;
 
 private:
     HTMLVideoElement(DOM::Document&, DOM::QualifiedName);
@@ -71,6 +70,7 @@ private:
 
     GC::Ptr<HTML::VideoTrack> m_video_track;
     VideoFrame m_current_frame;
+    mutable RefPtr<Gfx::Bitmap> m_current_frame_bitmap;
     RefPtr<Gfx::Bitmap> m_poster_frame;
 
     u32 m_video_width { 0 };
@@ -40,10 +40,10 @@ WebIDL::ExceptionOr<void> ImageBitmap::serialization_steps(HTML::SerializationRe
     return {};
 }
 
-WebIDL::ExceptionOr<void> ImageBitmap::deserialization_steps(ReadonlySpan<u32> const&, size_t&, HTML::DeserializationMemory&)
+WebIDL::ExceptionOr<void> ImageBitmap::deserialization_steps(ReadonlyBytes, size_t&, HTML::DeserializationMemory&)
 {
     // FIXME: Implement this
-    dbgln("(STUBBED) ImageBitmap::deserialization_steps(ReadonlySpan<u32> const&, size_t&, HTML::DeserializationMemory&)");
+    dbgln("(STUBBED) ImageBitmap::deserialization_steps(ReadonlyBytes, size_t&, HTML::DeserializationMemory&)");
     return {};
 }
 
@@ -6,6 +6,7 @@
 
 #include <AK/Debug.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/PerformanceTrace.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
@@ -22,6 +23,8 @@ GC_DEFINE_ALLOCATOR(ClassicScript);
 // https://whatpr.org/html/9893/webappapis.html#creating-a-classic-script
 GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView source, JS::Realm& realm, URL::URL base_url, size_t source_line_number, MutedErrors muted_errors)
 {
+    Core::PerformanceTraceSpan trace_span("script"sv, "script-compile"sv);
+
     auto& vm = realm.vm();
 
     // 1. If muted errors is true, then set baseURL to about:blank.
@@ -77,6 +80,8 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
 // https://whatpr.org/html/9893/webappapis.html#run-a-classic-script
 JS::Completion ClassicScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Environment> lexical_environment_override)
 {
+    Core::PerformanceTraceSpan trace_span("script"sv, "script-execute"sv);
+
     // 1. Let realm be the realm of script.
     auto& realm = this->realm();
 
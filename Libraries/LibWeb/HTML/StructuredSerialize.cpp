@@ -10,6 +10,7 @@
 #include <AK/StdLibExtras.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
@@ -55,12 +56,14 @@ namespace Web::HTML {
 // values (noted by their position in the list, one value following another).
 // This list represents the "memory" in the StructuredSerialize algorithm.
 // The first item in the list is the root, i.e., the value of everything.
-// The format is generally u32-aligned (hence this leaking out into the type)
-// Each value has a length based on its type, as defined below.
+// The format is byte-oriented and unaligned. Every value starts with a one-byte tag, and has a length based on its type,
+// as defined below. Lengths and counts are stored as LEB128 varints, so that the many small ones only take up a single
+// byte. Strings that occur more than once in a record (e.g. the property names of an array of similar objects) are only
+// stored the first time, and referred to by their index afterwards.
 //
 // (Should more redundancy be added, e.g., for lengths/positions of values?)
 
-enum ValueTag {
+enum ValueTag : u8 {
     // Unused, for ease of catching bugs.
     Empty,
 
@@ -70,17 +73,17 @@ enum ValueTag {
     // NullPrimitive is serialized indicating that the Type is Null, no value is serialized.
     NullPrimitive,
 
-    // Following u32 is the boolean value.
+    // Following byte is the boolean value.
     BooleanPrimitive,
 
-    // Following two u32s are the double value.
+    // Following eight bytes are the double value.
     NumberPrimitive,
 
     // The BigIntPrimitive is serialized as a string in base 10 representation.
-    // Following two u32s representing the length of the string, then the following u32s, equal to size, is the string representation.
+    // Following varint is the length of the string, then the following bytes, equal to length, are the string representation.
     BigIntPrimitive,
 
-    // Following two u32s representing the length of the string, then the following u32s, equal to size, is the string representation.
+    // Following is a deduplicated string, see Serializer::serialize_deduplicated_string().
     StringPrimitive,
 
     BooleanObject,
@@ -125,7 +128,7 @@ enum ValueTag {
     ValueTagMax,
 };
 
-enum ErrorType {
+enum ErrorType : u8 {
     Error,
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
     ClassName,
@@ -156,14 +159,19 @@ public:
     {
     }
 
+    SerializationRecord take_serialized() { return move(m_serialized); }
+
     // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
     // https://whatpr.org/html/9893/structured-data.html#structuredserializeinternal
-    WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
+    // NOTE: Nested values are serialized by recursing into this function rather than StructuredSerializeInternal, so
+    //       that the entire record is appended to a single buffer instead of being copied into its parent level by level.
+    WebIDL::ExceptionOr<void> serialize(JS::Value value)
     {
         // 2. If memory[value] exists, then return memory[value].
-        if (m_memory.contains(value)) {
-            auto index = m_memory.get(value).value();
-            return Vector<u32> { ValueTag::ObjectReference, index };
+        if (auto index = m_memory.get(value); index.has_value()) {
+            serialize_enum(m_serialized, ValueTag::ObjectReference);
+            serialize_varint(m_serialized, *index);
+            return {};
         }
 
         // 3. Let deep be false.
@@ -186,13 +194,13 @@ public:
             TRY(serialize_big_int_primitive(m_vm, m_serialized, value));
         } else if (value.is_string()) {
             serialize_enum(m_serialized, ValueTag::StringPrimitive);
-            TRY(serialize_string_primitive(m_vm, m_serialized, value));
+            TRY(serialize_deduplicated_string(value.as_string().utf8_string()));
         } else {
             return_primitive_type = false;
         }
 
         if (return_primitive_type)
-            return m_serialized;
+            return {};
 
         // 5. If value is a Symbol, then throw a "DataCloneError" DOMException.
         if (value.is_symbol())
@@ -245,9 +253,9 @@ public:
 
         // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
         else if (value.is_object() && is<JS::TypedArrayBase>(value.as_object())) {
-            TRY(serialize_viewed_array_buffer(m_vm, m_serialized, static_cast<JS::TypedArrayBase&>(value.as_object()), m_for_storage, m_memory));
+            TRY(serialize_viewed_array_buffer(static_cast<JS::TypedArrayBase&>(value.as_object())));
         } else if (value.is_object() && is<JS::DataView>(value.as_object())) {
-            TRY(serialize_viewed_array_buffer(m_vm, m_serialized, static_cast<JS::DataView&>(value.as_object()), m_for_storage, m_memory));
+            TRY(serialize_viewed_array_buffer(static_cast<JS::DataView&>(value.as_object())));
         }
 
         // 15. Otherwise, if value has [[MapData]] internal slot, then:
@@ -304,7 +312,7 @@ public:
 
             // 3. Set serialized to { [[Type]]: "Array", [[Length]]: valueLen, [[Properties]]: a new empty List }.
             serialize_enum(m_serialized, ValueTag::ArrayObject);
-            serialize_primitive_type(m_serialized, length);
+            serialize_varint(m_serialized, length);
 
             // 4. Set deep to true.
             deep = true;
@@ -319,7 +327,7 @@ public:
             // 2. Let typeString be the identifier of the primary interface of value.
             // 3. Set serialized to { [[Type]]: typeString }.
             serialize_enum(m_serialized, ValueTag::SerializableObject);
-            TRY(serialize_string(m_vm, m_serialized, serializable.interface_name()));
+            TRY(serialize_deduplicated_string(TRY_OR_THROW_OOM(m_vm, String::from_utf8(serializable.interface_name()))));
 
             // 4. Set deep to true
             deep = true;
@@ -349,7 +357,9 @@ public:
         }
 
         // 25. Set memory[value] to serialized.
-        m_memory.set(make_root(value), m_next_id++);
+        // NOTE: Values are numbered in the order they are added to memory, which is also the order in which StructuredDeserialize
+        //       adds them to its own memory. This includes any transferred values, which are added to memory up front.
+        m_memory.set(make_root(value), m_memory.size());
 
         // 26. If deep is true, then:
         if (deep) {
@@ -366,16 +376,13 @@ public:
                     copied_list.append(entry.key);
                     copied_list.append(entry.value);
                 }
-                u64 size = map.map_size();
-                m_serialized.append(bit_cast<u32*>(&size), 2);
+                serialize_varint(m_serialized, map.map_size());
                 // 3. For each Record { [[Key]], [[Value]] } entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize(copied_value));
                 }
             }
 
@@ -390,14 +397,12 @@ public:
                     // 1. If entry is not the special value empty, append entry to copiedList.
                     copied_list.append(entry.key);
                 }
-                serialize_primitive_type(m_serialized, set.set_size());
+                serialize_varint(m_serialized, set.set_size());
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize(copied_value));
                 }
             }
 
@@ -409,7 +414,9 @@ public:
 
             // 4. Otherwise, for each key in ! EnumerableOwnProperties(value, key):
             else {
-                u64 property_count = 0;
+                // NOTE: We only know how many properties there are once we have serialized them all, so unlike other
+                //       counts, this one is fixed-width and filled in afterwards.
+                u32 property_count = 0;
                 auto count_offset = m_serialized.size();
                 serialize_primitive_type(m_serialized, property_count);
                 for (auto key : MUST(value.as_object().enumerable_own_property_names(JS::Object::PropertyKind::Key))) {
@@ -421,11 +428,9 @@ public:
                         auto input_value = TRY(value.as_object().internal_get(property_key, value));
 
                         // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
-
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
-                        TRY(serialize_string(m_vm, m_serialized, key.as_string()));
-                        m_serialized.extend(output_value);
+                        TRY(serialize_deduplicated_string(key.as_string().utf8_string()));
+                        TRY(serialize(input_value));
 
                         property_count++;
                     }
@@ -435,14 +440,90 @@ public:
         }
 
         // 27. Return serialized.
-        return m_serialized;
+        return {};
     }
 
 private:
+    // The first occurrence of a string is stored as a varint of its length shifted left by one, followed by its UTF-8
+    // bytes. Any later occurrence is stored as a varint of the index of the first one shifted left by one, with the
+    // lowest bit set.
+    WebIDL::ExceptionOr<void> serialize_deduplicated_string(String const& string)
+    {
+        if (auto index = m_strings.get(string); index.has_value()) {
+            serialize_varint(m_serialized, (static_cast<u64>(*index) << 1) | 1);
+            return {};
+        }
+
+        TRY_OR_THROW_OOM(m_vm, m_strings.try_set(string, m_strings.size()));
+
+        auto bytes = string.bytes();
+        serialize_varint(m_serialized, static_cast<u64>(bytes.size()) << 1);
+        TRY_OR_THROW_OOM(m_vm, m_serialized.try_append(bytes.data(), bytes.size()));
+        return {};
+    }
+
+    template<OneOf<JS::TypedArrayBase, JS::DataView> ViewType>
+    WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(ViewType const& view)
+    {
+        // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
+
+        auto view_record = [&]() {
+            if constexpr (IsSame<ViewType, JS::DataView>) {
+                return JS::make_data_view_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
+            } else {
+                return JS::make_typed_array_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
+            }
+        }();
+
+        // 1. If IsArrayBufferViewOutOfBounds(value) is true, then throw a "DataCloneError" DOMException.
+        if constexpr (IsSame<ViewType, JS::DataView>) {
+            if (JS::is_view_out_of_bounds(view_record))
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), MUST(String::formatted(JS::ErrorType::BufferOutOfBounds.message(), "DataView"sv)));
+        } else {
+            if (JS::is_typed_array_out_of_bounds(view_record))
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), MUST(String::formatted(JS::ErrorType::BufferOutOfBounds.message(), "TypedArray"sv)));
+        }
+
+        serialize_enum(m_serialized, ValueTag::ArrayBufferView);
+
+        // 2. Let buffer be the value of value's [[ViewedArrayBuffer]] internal slot.
+        auto* buffer = view.viewed_array_buffer();
+
+        // 3. Let bufferSerialized be ? StructuredSerializeInternal(buffer, forStorage, memory).
+        auto buffer_position = m_serialized.size();
+        TRY(serialize(JS::Value(buffer))); // [[ArrayBufferSerialized]]
+
+        // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
+        // NOTE: We currently only implement this for ArrayBuffer. The buffer may also have been serialized or transferred before.
+        VERIFY(first_is_one_of(m_serialized[buffer_position], ValueTag::ArrayBuffer, ValueTag::ObjectReference));
+
+        // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
+        //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
+        if constexpr (IsSame<ViewType, JS::DataView>) {
+            TRY(serialize_deduplicated_string("DataView"_string)); // [[Constructor]]
+            serialize_varint(m_serialized, JS::get_view_byte_length(view_record));
+            serialize_varint(m_serialized, view.byte_offset());
+        }
+
+        // 6. Otherwise:
+        else {
+            // 1. Assert: value has a [[TypedArrayName]] internal slot.
+            //    NOTE: Handled by constexpr check and template constraints
+            // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
+            //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
+            //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
+            TRY(serialize_deduplicated_string(TRY_OR_THROW_OOM(m_vm, String::from_utf8(view.element_name().view())))); // [[Constructor]]
+            serialize_varint(m_serialized, JS::typed_array_byte_length(view_record));
+            serialize_varint(m_serialized, view.byte_offset());
+            serialize_varint(m_serialized, JS::typed_array_length(view_record));
+        }
+        return {};
+    }
+
     JS::VM& m_vm;
     SerializationMemory& m_memory; // JS value -> index
-    u32 m_next_id { 0 };
     SerializationRecord m_serialized;
+    HashMap<String, u32> m_strings;
     bool m_for_storage { false };
 };
 
@@ -522,45 +603,44 @@ WebIDL::ExceptionOr<void> serialize_reg_exp_object(JS::VM& vm, SerializationReco
     return {};
 }
 
-WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, ReadonlyBytes bytes)
+void serialize_varint(SerializationRecord& serialized, u64 value)
+{
+    do {
+        u8 byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0)
+            byte |= 0x80;
+        serialized.append(byte);
+    } while (value != 0);
+}
+
+WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, SerializationRecord& vector, ReadonlyBytes bytes)
 {
     // Append size of the buffer to the serialized structure.
-    u64 const size = bytes.size();
-    serialize_primitive_type(vector, size);
+    serialize_varint(vector, bytes.size());
     // Append the bytes of the buffer to the serialized structure.
-    u64 byte_position = 0;
-    while (byte_position < size) {
-        u32 combined_value = 0;
-        for (u8 i = 0; i < 4; ++i) {
-            u8 const byte = bytes[byte_position];
-            combined_value |= byte << (i * 8);
-            byte_position++;
-            if (byte_position == size)
-                break;
-        }
-        TRY_OR_THROW_OOM(vm, vector.try_append(combined_value));
-    }
+    TRY_OR_THROW_OOM(vm, vector.try_append(bytes.data(), bytes.size()));
     return {};
 }
 
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, DeprecatedFlyString const& string)
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& vector, DeprecatedFlyString const& string)
 {
     return serialize_bytes(vm, vector, string.view().bytes());
 }
 
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, String const& string)
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& vector, String const& string)
 {
     return serialize_bytes(vm, vector, { string.code_points().bytes(), string.code_points().byte_length() });
 }
 
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, JS::PrimitiveString const& primitive_string)
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& vector, JS::PrimitiveString const& primitive_string)
 {
     auto string = primitive_string.utf8_string();
     TRY(serialize_string(vm, vector, string));
     return {};
 }
 
-WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::ArrayBuffer const& array_buffer, bool for_storage)
+WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, SerializationRecord& vector, JS::ArrayBuffer const& array_buffer, bool for_storage)
 {
     // 13. Otherwise, if value has an [[ArrayBufferData]] internal slot, then:
 
@@ -592,11 +672,10 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
         auto size = array_buffer.byte_length();
 
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
-        //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // NOTE: The serialized record is a copy of the data in its own right, so rather than making an intermediate copy
+        //       that is then copied again into the record, we copy the bytes straight into the record below.
+        auto data_copy = array_buffer.buffer().bytes().trim(size);
 
         // FIXME: 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
@@ -605,76 +684,15 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
             serialize_enum(vector, ValueTag::ArrayBuffer);
-            TRY(serialize_bytes(vm, vector, data_copy.buffer().bytes()));
+            TRY(serialize_bytes(vm, vector, data_copy));
         }
     }
     return {};
 }
 
-template<OneOf<JS::TypedArrayBase, JS::DataView> ViewType>
-WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, ViewType const& view, bool for_storage, SerializationMemory& memory)
-{
-    // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
-
-    auto view_record = [&]() {
-        if constexpr (IsSame<ViewType, JS::DataView>) {
-            return JS::make_data_view_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
-        } else {
-            return JS::make_typed_array_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
-        }
-    }();
-
-    // 1. If IsArrayBufferViewOutOfBounds(value) is true, then throw a "DataCloneError" DOMException.
-    if constexpr (IsSame<ViewType, JS::DataView>) {
-        if (JS::is_view_out_of_bounds(view_record))
-            return WebIDL::DataCloneError::create(*vm.current_realm(), MUST(String::formatted(JS::ErrorType::BufferOutOfBounds.message(), "DataView"sv)));
-    } else {
-        if (JS::is_typed_array_out_of_bounds(view_record))
-            return WebIDL::DataCloneError::create(*vm.current_realm(), MUST(String::formatted(JS::ErrorType::BufferOutOfBounds.message(), "TypedArray"sv)));
-    }
-
-    // 2. Let buffer be the value of value's [[ViewedArrayBuffer]] internal slot.
-    auto* buffer = view.viewed_array_buffer();
-
-    // 3. Let bufferSerialized be ? StructuredSerializeInternal(buffer, forStorage, memory).
-    auto buffer_serialized = TRY(structured_serialize_internal(vm, JS::Value(buffer), for_storage, memory));
-
-    // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
-    // NOTE: We currently only implement this for ArrayBuffer
-    VERIFY(buffer_serialized[0] == ValueTag::ArrayBuffer);
-
-    // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
-    //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
-    if constexpr (IsSame<ViewType, JS::DataView>) {
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));               // [[ArrayBufferSerialized]]
-        TRY(serialize_string(vm, vector, "DataView"_string)); // [[Constructor]]
-        serialize_primitive_type(vector, JS::get_view_byte_length(view_record));
-        serialize_primitive_type(vector, view.byte_offset());
-    }
-
-    // 6. Otherwise:
-    else {
-        // 1. Assert: value has a [[TypedArrayName]] internal slot.
-        //    NOTE: Handled by constexpr check and template constraints
-        // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
-        //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
-        //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));                 // [[ArrayBufferSerialized]]
-        TRY(serialize_string(vm, vector, view.element_name())); // [[Constructor]]
-        serialize_primitive_type(vector, JS::typed_array_byte_length(view_record));
-        serialize_primitive_type(vector, view.byte_offset());
-        serialize_primitive_type(vector, JS::typed_array_length(view_record));
-    }
-    return {};
-}
-template WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::TypedArrayBase const& view, bool for_storage, SerializationMemory& memory);
-template WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::DataView const& view, bool for_storage, SerializationMemory& memory);
-
 class Deserializer {
 public:
-    Deserializer(JS::VM& vm, JS::Realm& target_realm, ReadonlySpan<u32> serialized, DeserializationMemory& memory, Optional<size_t> position = {})
+    Deserializer(JS::VM& vm, JS::Realm& target_realm, ReadonlyBytes serialized, DeserializationMemory& memory, Optional<size_t> position = {})
         : m_vm(vm)
         , m_serialized(serialized)
         , m_memory(memory)
@@ -688,14 +706,13 @@ public:
     // https://html.spec.whatwg.org/multipage/structured-data.html#structureddeserialize
     WebIDL::ExceptionOr<JS::Value> deserialize()
     {
-        auto tag = deserialize_primitive_type<ValueTag>(m_serialized, m_position);
+        auto tag = TRY(deserialize_primitive_type<ValueTag>(m_vm, m_serialized, m_position));
 
         // 2. If memory[serialized] exists, then return memory[serialized].
         if (tag == ValueTag::ObjectReference) {
-            auto index = m_serialized[m_position++];
-            if (index == NumericLimits<u32>::max()) {
-                return JS::Object::create(*m_vm.current_realm(), nullptr);
-            }
+            auto index = TRY(deserialize_varint(m_vm, m_serialized, m_position));
+            if (index >= m_memory.size())
+                return malformed_serialization_record_error(m_vm);
             return m_memory[index];
         }
 
@@ -719,12 +736,12 @@ public:
             break;
         }
         case ValueTag::BooleanPrimitive: {
-            value = JS::Value { deserialize_boolean_primitive(m_serialized, m_position) };
+            value = JS::Value { TRY(deserialize_boolean_primitive(m_vm, m_serialized, m_position)) };
             is_primitive = true;
             break;
         }
         case ValueTag::NumberPrimitive: {
-            value = JS::Value { deserialize_number_primitive(m_serialized, m_position) };
+            value = JS::Value { TRY(deserialize_number_primitive(m_vm, m_serialized, m_position)) };
             is_primitive = true;
             break;
         }
@@ -735,19 +752,19 @@ public:
             break;
         }
         case ValueTag::StringPrimitive: {
-            auto string = TRY(deserialize_string_primitive(m_vm, m_serialized, m_position));
-            value = JS::Value { string };
+            auto string = TRY(deserialize_deduplicated_string());
+            value = JS::PrimitiveString::create(m_vm, move(string));
             is_primitive = true;
             break;
         }
         // 6. Otherwise, if serialized.[[Type]] is "Boolean", then set value to a new Boolean object in targetRealm whose [[BooleanData]] internal slot value is serialized.[[BooleanData]].
         case BooleanObject: {
-            value = deserialize_boolean_object(*m_vm.current_realm(), m_serialized, m_position);
+            value = TRY(deserialize_boolean_object(*m_vm.current_realm(), m_serialized, m_position));
             break;
         }
         // 7. Otherwise, if serialized.[[Type]] is "Number", then set value to a new Number object in targetRealm whose [[NumberData]] internal slot value is serialized.[[NumberData]].
         case ValueTag::NumberObject: {
-            value = deserialize_number_object(*m_vm.current_realm(), m_serialized, m_position);
+            value = TRY(deserialize_number_object(*m_vm.current_realm(), m_serialized, m_position));
             break;
         }
         // 8. Otherwise, if serialized.[[Type]] is "BigInt", then set value to a new BigInt object in targetRealm whose [[BigIntData]] internal slot value is serialized.[[BigIntData]].
@@ -762,7 +779,7 @@ public:
         }
         // 10. Otherwise, if serialized.[[Type]] is "Date", then set value to a new Date object in targetRealm whose [[DateValue]] internal slot value is serialized.[[DateValue]].
         case ValueTag::DateObject: {
-            value = deserialize_date_object(*m_vm.current_realm(), m_serialized, m_position);
+            value = TRY(deserialize_date_object(*m_vm.current_realm(), m_serialized, m_position));
             break;
         }
         // 11. Otherwise, if serialized.[[Type]] is "RegExp", then set value to a new RegExp object in targetRealm whose [[RegExpMatcher]] internal slot value is serialized.[[RegExpMatcher]],
@@ -779,7 +796,7 @@ public:
             // If this throws an exception, catch it, and then throw a "DataCloneError" DOMException.
             auto bytes_or_error = deserialize_bytes(m_vm, m_serialized, m_position);
             if (bytes_or_error.is_error())
-                return WebIDL::DataCloneError::create(*m_vm.current_realm(), "out of memory"_string);
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), "Failed to deserialize ArrayBuffer"_string);
             value = JS::ArrayBuffer::create(*realm, bytes_or_error.release_value());
             break;
         }
@@ -788,15 +805,19 @@ public:
         case ValueTag::ArrayBufferView: {
             auto* realm = m_vm.current_realm();
             auto array_buffer_value = TRY(deserialize());
-            auto& array_buffer = verify_cast<JS::ArrayBuffer>(array_buffer_value.as_object());
-            auto constructor_name = TRY(deserialize_string(m_vm, m_serialized, m_position));
-            u32 byte_length = deserialize_primitive_type<u32>(m_serialized, m_position);
-            u32 byte_offset = deserialize_primitive_type<u32>(m_serialized, m_position);
+            if (!array_buffer_value.is_object() || !is<JS::ArrayBuffer>(array_buffer_value.as_object()))
+                return malformed_serialization_record_error(m_vm);
+            auto& array_buffer = static_cast<JS::ArrayBuffer&>(array_buffer_value.as_object());
+            auto constructor_name = TRY(deserialize_deduplicated_string());
+            auto byte_length = TRY(deserialize_varint(m_vm, m_serialized, m_position));
+            auto byte_offset = TRY(deserialize_varint(m_vm, m_serialized, m_position));
+            if (byte_offset > array_buffer.byte_length() || byte_length > array_buffer.byte_length() - byte_offset)
+                return malformed_serialization_record_error(m_vm);
 
             if (constructor_name == "DataView"sv) {
                 value = JS::DataView::create(*realm, &array_buffer, byte_length, byte_offset);
             } else {
-                u32 array_length = deserialize_primitive_type<u32>(m_serialized, m_position);
+                auto array_length = TRY(deserialize_varint(m_vm, m_serialized, m_position));
                 GC::Ptr<JS::TypedArrayBase> typed_array_ptr;
 #define CREATE_TYPED_ARRAY(ClassName)       \
     if (constructor_name == #ClassName##sv) \
@@ -806,7 +827,8 @@ public:
                 JS_ENUMERATE_TYPED_ARRAYS
 #undef __JS_ENUMERATE
 #undef CREATE_TYPED_ARRAY
-                VERIFY(typed_array_ptr != nullptr); // FIXME: Handle errors better here? Can a fuzzer put weird stuff in the buffer?
+                if (!typed_array_ptr || byte_length % typed_array_ptr->element_size() != 0 || array_length != byte_length / typed_array_ptr->element_size())
+                    return malformed_serialization_record_error(m_vm);
                 typed_array_ptr->set_byte_length(byte_length);
                 typed_array_ptr->set_byte_offset(byte_offset);
                 value = typed_array_ptr;
@@ -836,7 +858,9 @@ public:
             auto& realm = *m_vm.current_realm();
             // 1. Let outputProto be targetRealm.[[Intrinsics]].[[%Array.prototype%]].
             // 2. Set value to ! ArrayCreate(serialized.[[Length]], outputProto).
-            auto length = deserialize_primitive_type<u64>(m_serialized, m_position);
+            auto length = TRY(deserialize_varint(m_vm, m_serialized, m_position));
+            if (length > NumericLimits<u32>::max())
+                return malformed_serialization_record_error(m_vm);
             value = MUST(JS::Array::create(realm, length));
             // 3. Set deep to true.
             deep = true;
@@ -854,8 +878,8 @@ public:
         // 21. Otherwise, if serialized.[[Type]] is "Error", then:
         case ValueTag::ErrorObject: {
             auto& realm = *m_vm.current_realm();
-            auto type = deserialize_primitive_type<ErrorType>(m_serialized, m_position);
-            auto has_message = deserialize_primitive_type<bool>(m_serialized, m_position);
+            auto type = TRY(deserialize_primitive_type<ErrorType>(m_vm, m_serialized, m_position));
+            auto has_message = TRY(deserialize_primitive_type<bool>(m_vm, m_serialized, m_position));
             if (has_message) {
                 auto message = TRY(deserialize_string(m_vm, m_serialized, m_position));
                 switch (type) {
@@ -868,6 +892,8 @@ public:
         break;
                     JS_ENUMERATE_NATIVE_ERRORS
 #undef __JS_ENUMERATE
+                default:
+                    return malformed_serialization_record_error(m_vm);
                 }
             } else {
                 switch (type) {
@@ -880,17 +906,20 @@ public:
         break;
                     JS_ENUMERATE_NATIVE_ERRORS
 #undef __JS_ENUMERATE
+                default:
+                    return malformed_serialization_record_error(m_vm);
                 }
             }
             break;
         }
         // 22. Otherwise:
         default:
-            VERIFY(tag == ValueTag::SerializableObject);
+            if (tag != ValueTag::SerializableObject)
+                return malformed_serialization_record_error(m_vm);
 
             auto& realm = *m_vm.current_realm();
             // 1. Let interfaceName be serialized.[[Type]].
-            auto interface_name = TRY(deserialize_string(m_vm, m_serialized, m_position));
+            auto interface_name = TRY(deserialize_deduplicated_string());
             // 2. If the interface identified by interfaceName is not exposed in targetRealm, then throw a "DataCloneError" DOMException.
             if (!is_interface_exposed_on_target_realm(interface_name, realm))
                 return WebIDL::DataCloneError::create(realm, "Unsupported type"_string);
@@ -912,7 +941,7 @@ public:
             // 1. If serialized.[[Type]] is "Map", then:
             if (tag == ValueTag::MapObject) {
                 auto& map = static_cast<JS::Map&>(value.as_object());
-                auto length = deserialize_primitive_type<u64>(m_serialized, m_position);
+                auto length = TRY(deserialize_varint(m_vm, m_serialized, m_position));
                 // 1. For each Record { [[Key]], [[Value]] } entry of serialized.[[MapData]]:
                 for (u64 i = 0u; i < length; ++i) {
                     // 1. Let deserializedKey be ? StructuredDeserialize(entry.[[Key]], targetRealm, memory).
@@ -929,7 +958,7 @@ public:
             // 2. Otherwise, if serialized.[[Type]] is "Set", then:
             else if (tag == ValueTag::SetObject) {
                 auto& set = static_cast<JS::Set&>(value.as_object());
-                auto length = deserialize_primitive_type<u64>(m_serialized, m_position);
+                auto length = TRY(deserialize_varint(m_vm, m_serialized, m_position));
                 // 1. For each entry of serialized.[[SetData]]:
                 for (u64 i = 0u; i < length; ++i) {
                     // 1. Let deserializedEntry be ? StructuredDeserialize(entry, targetRealm, memory).
@@ -943,19 +972,21 @@ public:
             // 3. Otherwise, if serialized.[[Type]] is "Array" or "Object", then:
             else if (tag == ValueTag::ArrayObject || tag == ValueTag::Object) {
                 auto& object = value.as_object();
-                auto length = deserialize_primitive_type<u64>(m_serialized, m_position);
+                auto length = TRY(deserialize_primitive_type<u32>(m_vm, m_serialized, m_position));
                 // 1. For each Record { [[Key]], [[Value]] } entry of serialized.[[Properties]]:
-                for (u64 i = 0u; i < length; ++i) {
-                    auto key = TRY(deserialize_string(m_vm, m_serialized, m_position));
+                for (u32 i = 0u; i < length; ++i) {
+                    auto key = TRY(deserialize_deduplicated_string());
 
                     // 1. Let deserializedValue be ? StructuredDeserialize(entry.[[Value]], targetRealm, memory).
                     auto deserialized_value = TRY(deserialize());
 
                     // 2. Let result be ! CreateDataProperty(value, entry.[[Key]], deserializedValue).
-                    auto result = MUST(object.create_data_property(key.to_byte_string(), deserialized_value));
+                    // NOTE: A malformed record may contain properties that can't be defined, e.g. an invalid length of an array.
+                    auto result = TRY(object.create_data_property(key.to_byte_string(), deserialized_value));
 
                     // 3. Assert: result is true.
-                    VERIFY(result);
+                    if (!result)
+                        return malformed_serialization_record_error(m_vm);
                 }
             }
 
@@ -972,9 +1003,31 @@ public:
     }
 
 private:
+    // See Serializer::serialize_deduplicated_string().
+    WebIDL::ExceptionOr<String> deserialize_deduplicated_string()
+    {
+        auto header = TRY(deserialize_varint(m_vm, m_serialized, m_position));
+        if (header & 1) {
+            if ((header >> 1) >= m_strings.size())
+                return malformed_serialization_record_error(m_vm);
+            return m_strings[header >> 1];
+        }
+
+        auto length = header >> 1;
+        if (length > m_serialized.size() - m_position)
+            return malformed_serialization_record_error(m_vm);
+
+        auto string = TRY_OR_THROW_OOM(m_vm, String::from_utf8(StringView { m_serialized.slice(m_position, length) }));
+        m_position += length;
+
+        TRY_OR_THROW_OOM(m_vm, m_strings.try_append(string));
+        return string;
+    }
+
     JS::VM& m_vm;
-    ReadonlySpan<u32> m_serialized;
-    GC::MarkedVector<JS::Value> m_memory; // Index -> JS value
+    ReadonlyBytes m_serialized;
+    DeserializationMemory& m_memory; // Index -> JS value
+    Vector<String> m_strings;
     size_t m_position { 0 };
 
     static WebIDL::ExceptionOr<GC::Ref<Bindings::PlatformObject>> create_serialized_type(StringView interface_name, JS::Realm& realm)
@@ -1002,7 +1055,8 @@ private:
         if (interface_name == "DOMQuad"sv)
             return Geometry::DOMQuad::create(realm);
 
-        VERIFY_NOT_REACHED();
+        // The interface is exposed, but isn't one that can be serialized.
+        return malformed_serialization_record_error(realm.vm());
     }
 
     // FIXME: Consolidate this function with the similar is_interface_exposed_on_target_realm() used when transferring objects.
@@ -1014,93 +1068,119 @@ private:
     }
 };
 
-bool deserialize_boolean_primitive(ReadonlySpan<u32> const& serialized, size_t& position)
+GC::Ref<WebIDL::DOMException> malformed_serialization_record_error(JS::VM& vm)
+{
+    return WebIDL::DataCloneError::create(*vm.current_realm(), "Malformed serialized data"_string);
+}
+
+WebIDL::ExceptionOr<bool> deserialize_boolean_primitive(JS::VM& vm, ReadonlyBytes serialized, size_t& position)
 {
-    return deserialize_primitive_type<bool>(serialized, position);
+    return deserialize_primitive_type<bool>(vm, serialized, position);
 }
 
-double deserialize_number_primitive(ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<double> deserialize_number_primitive(JS::VM& vm, ReadonlyBytes serialized, size_t& position)
 {
-    return deserialize_primitive_type<double>(serialized, position);
+    return deserialize_primitive_type<double>(vm, serialized, position);
 }
 
-GC::Ref<JS::BooleanObject> deserialize_boolean_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::BooleanObject>> deserialize_boolean_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position)
 {
-    auto boolean_primitive = deserialize_boolean_primitive(serialized, position);
+    auto boolean_primitive = TRY(deserialize_boolean_primitive(realm.vm(), serialized, position));
     return JS::BooleanObject::create(realm, boolean_primitive);
 }
 
-GC::Ref<JS::NumberObject> deserialize_number_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::NumberObject>> deserialize_number_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position)
 {
-    auto number_primitive = deserialize_number_primitive(serialized, position);
+    auto number_primitive = TRY(deserialize_number_primitive(realm.vm(), serialized, position));
     return JS::NumberObject::create(realm, number_primitive);
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position)
 {
     auto big_int_primitive = TRY(deserialize_big_int_primitive(realm.vm(), serialized, position));
     return JS::BigIntObject::create(realm, big_int_primitive);
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position)
 {
     auto string_primitive = TRY(deserialize_string_primitive(realm.vm(), serialized, position));
     return JS::StringObject::create(realm, string_primitive, realm.intrinsics().string_prototype());
 }
 
-GC::Ref<JS::Date> deserialize_date_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::Date>> deserialize_date_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position)
 {
-    auto double_value = deserialize_primitive_type<double>(serialized, position);
+    auto double_value = TRY(deserialize_primitive_type<double>(realm.vm(), serialized, position));
     return JS::Date::create(realm, double_value);
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position)
 {
     auto pattern = TRY(deserialize_string_primitive(realm.vm(), serialized, position));
     auto flags = TRY(deserialize_string_primitive(realm.vm(), serialized, position));
     return TRY(JS::regexp_create(realm.vm(), move(pattern), move(flags)));
 }
 
-WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<u64> deserialize_varint(JS::VM& vm, ReadonlyBytes serialized, size_t& position)
 {
-    u64 const size = deserialize_primitive_type<u64>(vector, position);
-
-    auto bytes = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size));
-    u64 byte_position = 0;
-    while (position < vector.size() && byte_position < size) {
-        for (u8 i = 0; i < 4; ++i) {
-            bytes[byte_position++] = (vector[position] >> (i * 8) & 0xFF);
-            if (byte_position == size)
-                break;
-        }
-        position++;
+    u64 value = 0;
+
+    for (size_t shift = 0;; shift += 7) {
+        if (position >= serialized.size() || shift >= 64)
+            return malformed_serialization_record_error(vm);
+
+        auto byte = serialized[position++];
+        value |= static_cast<u64>(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+            return value;
     }
+}
+
+// Returns a view of the bytes in the record, which is only valid for as long as the record is.
+static WebIDL::ExceptionOr<ReadonlyBytes> deserialize_bytes_view(JS::VM& vm, ReadonlyBytes vector, size_t& position)
+{
+    auto size = TRY(deserialize_varint(vm, vector, position));
+    if (size > vector.size() - position)
+        return malformed_serialization_record_error(vm);
+
+    auto bytes = vector.slice(position, size);
+    position += size;
     return bytes;
 }
 
-WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlyBytes vector, size_t& position)
+{
+    auto bytes = TRY(deserialize_bytes_view(vm, vector, position));
+    return TRY_OR_THROW_OOM(vm, ByteBuffer::copy(bytes));
+}
+
+WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlyBytes vector, size_t& position)
 {
-    auto bytes = TRY(deserialize_bytes(vm, vector, position));
+    auto bytes = TRY(deserialize_bytes_view(vm, vector, position));
     return TRY_OR_THROW_OOM(vm, String::from_utf8(StringView { bytes }));
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlyBytes vector, size_t& position)
 {
-    auto bytes = TRY(deserialize_bytes(vm, vector, position));
+    auto bytes = TRY(deserialize_bytes_view(vm, vector, position));
 
     return TRY(Bindings::throw_dom_exception_if_needed(vm, [&vm, &bytes]() {
         return JS::PrimitiveString::create(vm, StringView { bytes });
     }));
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<GC::Ref<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlyBytes vector, size_t& position)
 {
     auto string = TRY(deserialize_string_primitive(vm, vector, position));
     auto string_view = TRY(Bindings::throw_dom_exception_if_needed(vm, [&string]() {
         return string->utf8_string_view();
     }));
-    auto bigint = MUST(::Crypto::SignedBigInteger::from_base(10, string_view.substring_view(0, string_view.length() - 1)));
-    return JS::BigInt::create(vm, bigint);
+    if (string_view.is_empty())
+        return malformed_serialization_record_error(vm);
+    auto bigint = ::Crypto::SignedBigInteger::from_base(10, string_view.substring_view(0, string_view.length() - 1));
+    if (bigint.is_error())
+        return malformed_serialization_record_error(vm);
+    return JS::BigInt::create(vm, bigint.release_value());
 }
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
@@ -1113,12 +1193,14 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
     for (auto const& transferable : transfer_list) {
 
         // 1. If transferable has neither an [[ArrayBufferData]] internal slot nor a [[Detached]] internal slot, then throw a "DataCloneError" DOMException.
-        // FIXME: Handle transferring ArrayBufferData objects
-        if (!is<Bindings::Transferable>(*transferable)) {
+        if (!is<JS::ArrayBuffer>(*transferable) && !is<Bindings::Transferable>(*transferable)) {
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer type"_string);
         }
 
-        // FIXME: 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer const&>(*transferable).is_shared_array_buffer()) {
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer SharedArrayBuffer"_string);
+        }
 
         // 3. If memory[transferable] exists, then throw a "DataCloneError" DOMException.
         auto transferable_value = JS::Value(transferable);
@@ -1127,7 +1209,9 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         }
 
         // 4. Set memory[transferable] to { [[Type]]: an uninitialized value }.
-        memory.set(GC::make_root(transferable_value), NumericLimits<u32>::max());
+        // IMPLEMENTATION DEFINED: References to a transferable are serialized as its index in the transfer list, which is
+        //                         also its index in the memory of StructuredDeserializeWithTransfer.
+        memory.set(GC::make_root(transferable_value), memory.size());
     }
 
     // 3. Let serialized be ? StructuredSerializeInternal(value, false, memory).
@@ -1139,7 +1223,10 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
     // 5. For each transferable of transferList:
     for (auto& transferable : transfer_list) {
-        // 1. FIXME: If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 1. If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer const&>(*transferable).is_detached()) {
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer detached ArrayBuffer"_string);
+        }
 
         // 2. If transferable has a [[Detached]] internal slot and transferable.[[Detached]] is true, then throw a "DataCloneError" DOMException.
         if (is<Bindings::Transferable>(*transferable)) {
@@ -1153,8 +1240,26 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         // IMPLEMENTATION DEFINED: We just create a data holder here, our memory holds indices into the SerializationRecord
         TransferDataHolder data_holder;
 
-        // FIXME 4. If transferable has an [[ArrayBufferData]] internal slot, then:
-        if (false) {
+        // 4. If transferable has an [[ArrayBufferData]] internal slot, then:
+        if (is<JS::ArrayBuffer>(*transferable)) {
+            auto& array_buffer = static_cast<JS::ArrayBuffer&>(*transferable);
+
+            // FIXME: 1. If transferable has an [[ArrayBufferMaxByteLength]] internal slot, then set dataHolder.[[Type]] to "ResizableArrayBuffer", ...
+            // 2. Otherwise:
+            //    1. Set dataHolder.[[Type]] to "ArrayBuffer".
+            //    2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
+            //    3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
+            // NOTE: The data is moved rather than copied, as the transferable is detached right after anyway.
+            data_holder.data.append(to_underlying(TransferType::ArrayBuffer));
+            data_holder.array_buffer_data = move(array_buffer.buffer());
+
+            // 3. Perform ? DetachArrayBuffer(transferable).
+            // NOTE: Specifications can use the [[ArrayBufferDetachKey]] internal slot to prevent ArrayBuffers from being detached.
+            //       This is used in WebAssembly JavaScript Interface, for example. See: https://html.spec.whatwg.org/multipage/references.html#refsWASMJS
+            if (auto result = JS::detach_array_buffer(vm, array_buffer); result.is_error()) {
+                array_buffer.buffer() = move(data_holder.array_buffer_data.get<ByteBuffer>());
+                return result.release_error();
+            }
         }
 
         // 5. Otherwise:
@@ -1206,6 +1311,9 @@ static WebIDL::ExceptionOr<GC::Ref<Bindings::PlatformObject>> create_transferred
         TRY(message_port->transfer_receiving_steps(transfer_data_holder));
         return message_port;
     }
+    case TransferType::ArrayBuffer:
+        // NOTE: ArrayBuffers are handled by StructuredDeserializeWithTransfer itself.
+        break;
     }
     VERIFY_NOT_REACHED();
 }
@@ -1226,14 +1334,24 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         // 1. Let value be an uninitialized value.
         JS::Value value;
 
-        // FIXME: 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
+        // 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
         //    whose [[ArrayBufferData]] internal slot value is transferDataHolder.[[ArrayBufferData]], and
         //    whose [[ArrayBufferByteLength]] internal slot value is transferDataHolder.[[ArrayBufferByteLength]].
         // NOTE: In cases where the original memory occupied by [[ArrayBufferData]] is accessible during the deserialization,
         //       this step is unlikely to throw an exception, as no new memory needs to be allocated: the memory occupied by
         //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
         //       when both the source and target realms are in the same process.
-        if (false) {
+        if (transfer_data_holder.data.is_empty())
+            return malformed_serialization_record_error(vm);
+
+        if (transfer_data_holder.data.first() == to_underlying(TransferType::ArrayBuffer)) {
+            // NOTE: An ArrayBuffer has to own its data, so data that was received in shared memory is copied out of it here.
+            auto array_buffer_data = TRY(transfer_data_holder.array_buffer_data.visit(
+                [](ByteBuffer& data) -> WebIDL::ExceptionOr<ByteBuffer> { return move(data); },
+                [&](Core::AnonymousBuffer const& data) -> WebIDL::ExceptionOr<ByteBuffer> {
+                    return TRY_OR_THROW_OOM(vm, ByteBuffer::copy(data.data<u8>(), data.size()));
+                }));
+            value = JS::ArrayBuffer::create(target_realm, move(array_buffer_data));
         }
 
         // FIXME: 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
@@ -1266,7 +1384,10 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
     }
 
     // 4. Let deserialized be ? StructuredDeserialize(serializeWithTransferResult.[[Serialized]], targetRealm, memory).
-    auto deserialized = TRY(structured_deserialize(vm, serialize_with_transfer_result.serialized, target_realm, memory));
+    auto serialized = serialize_with_transfer_result.serialized.visit(
+        [](SerializationRecord const& record) { return record.span(); },
+        [](Core::AnonymousBuffer const& buffer) { return ReadonlyBytes { buffer.data<u8>(), buffer.size() }; });
+    auto deserialized = TRY(structured_deserialize(vm, serialized, target_realm, memory));
 
     // 5. Return { [[Deserialized]]: deserialized, [[TransferredValues]]: transferredValues }.
     return DeserializedTransferRecord { .deserialized = move(deserialized), .transferred_values = move(transferred_values) };
@@ -1295,11 +1416,12 @@ WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& v
     // IMPLEMENTATION DEFINED: We move this requirement up to the callers to make recursion easier
 
     Serializer serializer(vm, memory, for_storage);
-    return serializer.serialize(value);
+    TRY(serializer.serialize(value));
+    return serializer.take_serialized();
 }
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structureddeserialize
-WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationRecord const& serialized, JS::Realm& target_realm, Optional<DeserializationMemory> memory)
+WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, ReadonlyBytes serialized, JS::Realm& target_realm, Optional<DeserializationMemory> memory)
 {
     if (!memory.has_value())
         memory = DeserializationMemory { vm.heap() };
@@ -1307,14 +1429,16 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationR
     // IMPLEMENTATION DEFINED: We need to make sure there's an execution context for target_realm on the stack before constructing these JS objects
     prepare_to_run_script(target_realm);
 
-    auto result = TRY(structured_deserialize_internal(vm, serialized.span(), target_realm, *memory));
+    auto result = structured_deserialize_internal(vm, serialized, target_realm, *memory);
 
     clean_up_after_running_script(target_realm);
-    VERIFY(result.value.has_value());
-    return *result.value;
+    if (result.is_error())
+        return result.release_error();
+    VERIFY(result.value().value.has_value());
+    return *result.value().value;
 }
 
-WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlySpan<u32> const& serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position)
+WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlyBytes serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position)
 {
     Deserializer deserializer(vm, target_realm, serialized, memory, move(position));
     auto value = TRY(deserializer.deserialize());
@@ -1329,18 +1453,59 @@ WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM&
 
 namespace IPC {
 
+// Large payloads (e.g. big ArrayBuffers that are posted to a worker) are passed along in shared memory, rather than
+// being copied into the message and then pushed through the socket in chunks. The sender copies them into the shared
+// memory once, and the receiver keeps them there rather than copying them back out.
+static constexpr size_t shared_memory_threshold = 64 * KiB;
+
+template<typename BufferType>
+static ErrorOr<void> encode_bytes(Encoder& encoder, Variant<BufferType, Core::AnonymousBuffer> const& bytes)
+{
+    // Data that was received in shared memory is passed along in the same shared memory.
+    if (auto const* buffer = bytes.template get_pointer<Core::AnonymousBuffer>()) {
+        TRY(encoder.encode(true));
+        return encoder.encode(*buffer);
+    }
+
+    auto const& data = bytes.template get<BufferType>();
+    if (data.size() < shared_memory_threshold) {
+        TRY(encoder.encode(false));
+        TRY(encoder.encode_size(data.size()));
+        return encoder.append(data.data(), data.size());
+    }
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(data.size()));
+    data.span().copy_to({ buffer.template data<u8>(), buffer.size() });
+
+    TRY(encoder.encode(true));
+    return encoder.encode(buffer);
+}
+
+template<typename BufferType>
+static ErrorOr<Variant<BufferType, Core::AnonymousBuffer>> decode_bytes(Decoder& decoder)
+{
+    if (TRY(decoder.decode<bool>()))
+        return TRY(decoder.decode<Core::AnonymousBuffer>());
+
+    BufferType bytes;
+    TRY(bytes.try_resize(TRY(decoder.decode_size())));
+    TRY(decoder.decode_into(bytes.span()));
+    return bytes;
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& data_holder)
 {
     TRY(encoder.encode(data_holder.data));
     TRY(encoder.encode(data_holder.fds));
+    TRY(encode_bytes(encoder, data_holder.array_buffer_data));
     return {};
 }
 
 template<>
 ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::SerializedTransferRecord const& record)
 {
-    TRY(encoder.encode(record.serialized));
+    TRY(encode_bytes(encoder, record.serialized));
     TRY(encoder.encode(record.transfer_data_holders));
     return {};
 }
@@ -1350,13 +1515,14 @@ ErrorOr<::Web::HTML::TransferDataHolder> decode(Decoder& decoder)
 {
     auto data = TRY(decoder.decode<Vector<u8>>());
     auto fds = TRY(decoder.decode<Vector<IPC::File>>());
-    return ::Web::HTML::TransferDataHolder { move(data), move(fds) };
+    auto array_buffer_data = TRY(decode_bytes<ByteBuffer>(decoder));
+    return ::Web::HTML::TransferDataHolder { move(data), move(fds), move(array_buffer_data) };
 }
 
 template<>
 ErrorOr<::Web::HTML::SerializedTransferRecord> decode(Decoder& decoder)
 {
-    auto serialized = TRY(decoder.decode<Vector<u32>>());
+    auto serialized = TRY(decode_bytes<::Web::HTML::SerializationRecord>(decoder));
     auto transfer_data_holders = TRY(decoder.decode<Vector<::Web::HTML::TransferDataHolder>>());
     return ::Web::HTML::SerializedTransferRecord { move(serialized), move(transfer_data_holders) };
 }
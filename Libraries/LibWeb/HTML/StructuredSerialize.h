@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Result.h>
 #include <AK/Types.h>
+#include <AK/Variant.h>
 #include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/Forward.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -22,17 +25,22 @@
 
 namespace Web::HTML {
 
-using SerializationRecord = Vector<u32>;
+using SerializationRecord = Vector<u8>;
 using SerializationMemory = HashMap<GC::Root<JS::Value>, u32>;
 using DeserializationMemory = GC::MarkedVector<JS::Value>;
 
 struct TransferDataHolder {
     Vector<u8> data;
     Vector<IPC::File> fds;
+
+    // The [[ArrayBufferData]] of a transferred ArrayBuffer, which is moved rather than copied into the data holder. Large
+    // ones that are received over IPC stay in the shared memory they were sent in until they are deserialized.
+    Variant<ByteBuffer, Core::AnonymousBuffer> array_buffer_data { ByteBuffer {} };
 };
 
 struct SerializedTransferRecord {
-    SerializationRecord serialized;
+    // Large records that are received over IPC are deserialized straight from the shared memory they were sent in.
+    Variant<SerializationRecord, Core::AnonymousBuffer> serialized { SerializationRecord {} };
     Vector<TransferDataHolder> transfer_data_holders;
 };
 
@@ -48,14 +56,15 @@ struct DeserializedRecord {
 
 enum class TransferType : u8 {
     MessagePort,
+    ArrayBuffer,
 };
 
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize(JS::VM& vm, JS::Value);
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize_for_storage(JS::VM& vm, JS::Value);
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& vm, JS::Value, bool for_storage, SerializationMemory&);
 
-WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationRecord const& serialized, JS::Realm& target_realm, Optional<DeserializationMemory>);
-WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlySpan<u32> const& serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position = {});
+WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, ReadonlyBytes serialized, JS::Realm& target_realm, Optional<DeserializationMemory>);
+WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlyBytes serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position = {});
 
 void serialize_boolean_primitive(SerializationRecord& serialized, JS::Value& value);
 void serialize_number_primitive(SerializationRecord& serialized, JS::Value& value);
@@ -72,12 +81,7 @@ template<typename T>
 requires(IsIntegral<T> || IsFloatingPoint<T>)
 void serialize_primitive_type(SerializationRecord& serialized, T value)
 {
-    if constexpr (sizeof(T) < sizeof(u32)) {
-        // NOTE: If the value is smaller than a u32, we can just store it directly.
-        serialized.append(static_cast<u32>(value));
-        return;
-    }
-    serialized.append(bit_cast<u32*>(&value), sizeof(T) / 4);
+    serialized.append(reinterpret_cast<u8 const*>(&value), sizeof(T));
 }
 
 template<typename T>
@@ -87,40 +91,51 @@ void serialize_enum(SerializationRecord& serialized, T value)
     serialize_primitive_type<UnderlyingType<T>>(serialized, to_underlying(value));
 }
 
-WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, ReadonlyBytes bytes);
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, DeprecatedFlyString const& string);
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, String const& string);
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, JS::PrimitiveString const& primitive_string);
-WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::ArrayBuffer const& array_buffer, bool for_storage);
-template<OneOf<JS::TypedArrayBase, JS::DataView> ViewType>
-WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, ViewType const& view, bool for_storage, SerializationMemory& memory);
-
-bool deserialize_boolean_primitive(ReadonlySpan<u32> const& serialized, size_t& position);
-double deserialize_number_primitive(ReadonlySpan<u32> const& serialized, size_t& position);
-GC::Ref<JS::BooleanObject> deserialize_boolean_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-GC::Ref<JS::NumberObject> deserialize_number_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-WebIDL::ExceptionOr<GC::Ref<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-WebIDL::ExceptionOr<GC::Ref<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-GC::Ref<JS::Date> deserialize_date_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-WebIDL::ExceptionOr<GC::Ref<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
+void serialize_varint(SerializationRecord& serialized, u64 value);
+WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, SerializationRecord& vector, ReadonlyBytes bytes);
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& vector, DeprecatedFlyString const& string);
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& vector, String const& string);
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& vector, JS::PrimitiveString const& primitive_string);
+WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, SerializationRecord& vector, JS::ArrayBuffer const& array_buffer, bool for_storage);
+
+WebIDL::ExceptionOr<bool> deserialize_boolean_primitive(JS::VM& vm, ReadonlyBytes serialized, size_t& position);
+WebIDL::ExceptionOr<double> deserialize_number_primitive(JS::VM& vm, ReadonlyBytes serialized, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::BooleanObject>> deserialize_boolean_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::NumberObject>> deserialize_number_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::Date>> deserialize_date_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlyBytes serialized, size_t& position);
+
+// Records may have been received over IPC from another process, so they are not trusted to be well-formed.
+GC::Ref<WebIDL::DOMException> malformed_serialization_record_error(JS::VM& vm);
 
 template<typename T>
 requires(IsIntegral<T> || IsFloatingPoint<T> || IsEnum<T>)
-T deserialize_primitive_type(ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<T> deserialize_primitive_type(JS::VM& vm, ReadonlyBytes serialized, size_t& position)
 {
-    T value;
-    // NOTE: Make sure we always round up, otherwise Ts that are less than 32 bit will end up with a size of 0.
-    auto size = 1 + ((sizeof(value) - 1) / 4);
-    VERIFY(position + size <= serialized.size());
-    memcpy(&value, serialized.offset_pointer(position), sizeof(value));
-    position += size;
-    return value;
+    if (serialized.size() - position < sizeof(T))
+        return malformed_serialization_record_error(vm);
+
+    if constexpr (IsSame<T, bool>) {
+        auto value = serialized[position++];
+        if (value > 1)
+            return malformed_serialization_record_error(vm);
+        return value == 1;
+    } else {
+        T value;
+        memcpy(&value, serialized.offset_pointer(position), sizeof(value));
+        position += sizeof(value);
+        return value;
+    }
 }
 
-WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
-WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
-WebIDL::ExceptionOr<GC::Ref<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
-WebIDL::ExceptionOr<GC::Ref<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
+WebIDL::ExceptionOr<u64> deserialize_varint(JS::VM& vm, ReadonlyBytes serialized, size_t& position);
+
+WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlyBytes vector, size_t& position);
+WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlyBytes vector, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlyBytes vector, size_t& position);
+WebIDL::ExceptionOr<GC::Ref<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlyBytes vector, size_t& position);
 
 WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<GC::Root<JS::Object>> const& transfer_list);
 WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_transfer(JS::VM& vm, SerializedTransferRecord&);
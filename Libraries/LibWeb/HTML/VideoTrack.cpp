@@ -35,7 +35,7 @@ VideoTrack::VideoTrack(JS::Realm& realm, GC::Ref<HTMLMediaElement> media_element
         auto playback_position = static_cast<double>(position().to_milliseconds()) / 1000.0;
 
         if (is<HTMLVideoElement>(*m_media_element))
-            verify_cast<HTMLVideoElement>(*m_media_element).set_current_frame({}, move(frame), playback_position);
+            verify_cast<HTMLVideoElement>(*m_media_element).set_current_frame({}, m_playback_manager->frame_pool(), move(frame), playback_position);
 
         m_media_element->set_current_playback_position(playback_position);
     };
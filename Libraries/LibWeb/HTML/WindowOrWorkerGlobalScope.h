@@ -76,6 +76,8 @@ public:
 
     [[nodiscard]] GC::Ref<Crypto::Crypto> crypto();
 
+    [[nodiscard]] GC::Ref<Scheduling::Scheduler> scheduler();
+
     void push_onto_outstanding_rejected_promises_weak_set(JS::Promise*);
 
     // Returns true if removed, false otherwise.
@@ -129,6 +131,8 @@ private:
 
     GC::Ptr<Crypto::Crypto> m_crypto;
 
+    GC::Ptr<Scheduling::Scheduler> m_scheduler;
+
     bool m_error_reporting_mode { false };
 
     // https://html.spec.whatwg.org/multipage/webappapis.html#about-to-be-notified-rejected-promises-list
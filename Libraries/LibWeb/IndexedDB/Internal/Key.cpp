@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/Utf16View.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <math.h>
+
+namespace Web::IndexedDB {
+
+// Every serialized key starts with one of these, in the same order as the key types compare in.
+enum class SerializedTag : u8 {
+    End = 0x00,
+    Number = 0x10,
+    Date = 0x20,
+    String = 0x30,
+    Binary = 0x40,
+    Array = 0x50,
+};
+
+// Byte strings are terminated by a zero byte, so any zero byte within them is escaped as 0x00 0xFF.
+static constexpr u8 escaped_zero_byte = 0xff;
+
+// Greater than every tag, so it can serve as the upper bound of an unbounded key range.
+static constexpr u8 upper_bound_byte = 0xff;
+
+Key Key::create_number(double value)
+{
+    VERIFY(!isnan(value));
+
+    // NOTE: -0 and +0 are the same key, and must serialize the same way.
+    return Key { Type::Number, value == 0 ? 0.0 : value };
+}
+
+Key Key::create_date(double value)
+{
+    VERIFY(!isnan(value));
+    return Key { Type::Date, value == 0 ? 0.0 : value };
+}
+
+Key Key::create_string(String value)
+{
+    return Key { Type::String, move(value) };
+}
+
+Key Key::create_binary(ByteBuffer value)
+{
+    return Key { Type::Binary, move(value) };
+}
+
+Key Key::create_array(Vector<Key> value)
+{
+    return Key { Type::Array, move(value) };
+}
+
+static int compare_code_units(String const& a, String const& b)
+{
+    // NOTE: UTF-8 orders strings by code point, which is the same order as by code unit unless surrogates are involved.
+    auto a_code_units = MUST(utf8_to_utf16(a));
+    auto b_code_units = MUST(utf8_to_utf16(b));
+
+    for (size_t i = 0; i < min(a_code_units.size(), b_code_units.size()); ++i) {
+        if (a_code_units[i] != b_code_units[i])
+            return a_code_units[i] < b_code_units[i] ? -1 : 1;
+    }
+
+    if (a_code_units.size() == b_code_units.size())
+        return 0;
+    return a_code_units.size() < b_code_units.size() ? -1 : 1;
+}
+
+// https://w3c.github.io/IndexedDB/#compare-two-keys
+int Key::compare_two_keys(Key const& a, Key const& b)
+{
+    // 1. Let ta be the type of a.
+    auto ta = a.type();
+
+    // 2. Let tb be the type of b.
+    auto tb = b.type();
+
+    // 3. If ta does not equal tb, then run these steps:
+    // NOTE: The key types are declared in the order these steps put them in.
+    if (ta != tb)
+        return ta > tb ? 1 : -1;
+
+    // 4. Let va be the value of a.
+    // 5. Let vb be the value of b.
+    // 6. Switch on ta:
+    switch (ta) {
+    // number
+    // date
+    case Type::Number:
+    case Type::Date: {
+        auto va = a.value_as_double();
+        auto vb = b.value_as_double();
+
+        // 1. If va is greater than vb, then return 1.
+        if (va > vb)
+            return 1;
+
+        // 2. If va is less than vb, then return -1.
+        if (va < vb)
+            return -1;
+
+        // 3. Return 0.
+        return 0;
+    }
+    // string
+    case Type::String:
+        // 1. If va is code unit less than vb, then return -1.
+        // 2. If vb is code unit less than va, then return 1.
+        // 3. Return 0.
+        return compare_code_units(a.value_as_string(), b.value_as_string());
+
+    // binary
+    case Type::Binary: {
+        auto const& va = a.value_as_binary();
+        auto const& vb = b.value_as_binary();
+
+        // 1. If va is byte less than vb, then return -1.
+        // 2. If vb is byte less than va, then return 1.
+        // 3. Return 0.
+        auto length = min(va.size(), vb.size());
+        if (auto result = length == 0 ? 0 : __builtin_memcmp(va.data(), vb.data(), length); result != 0)
+            return result < 0 ? -1 : 1;
+        if (va.size() == vb.size())
+            return 0;
+        return va.size() < vb.size() ? -1 : 1;
+    }
+    // array
+    case Type::Array: {
+        auto const& va = a.value_as_array();
+        auto const& vb = b.value_as_array();
+
+        // 1. Let length be the lesser of va's size and vb's size.
+        auto length = min(va.size(), vb.size());
+
+        // 2. Let i be 0.
+        // 3. While i is less than length, then:
+        for (size_t i = 0; i < length; ++i) {
+            // 1. Let c be the result of recursively comparing two keys with va[i] and vb[i].
+            auto c = compare_two_keys(va[i], vb[i]);
+
+            // 2. If c is not 0, return c.
+            if (c != 0)
+                return c;
+
+            // 3. Increase i by 1.
+        }
+
+        // 4. If va's size is greater than vb's size, then return 1.
+        if (va.size() > vb.size())
+            return 1;
+
+        // 5. If va's size is less than vb's size, then return -1.
+        if (va.size() < vb.size())
+            return -1;
+
+        // 6. Return 0.
+        return 0;
+    }
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+static ErrorOr<void> serialize_byte_string(ByteBuffer& buffer, ReadonlyBytes bytes)
+{
+    for (auto byte : bytes) {
+        TRY(buffer.try_append(byte));
+        if (byte == 0)
+            TRY(buffer.try_append(escaped_zero_byte));
+    }
+    TRY(buffer.try_append(to_underlying(SerializedTag::End)));
+    return {};
+}
+
+static ErrorOr<ByteBuffer> deserialize_byte_string(ReadonlyBytes& bytes)
+{
+    ByteBuffer result;
+
+    while (!bytes.is_empty()) {
+        auto byte = bytes[0];
+        bytes = bytes.slice(1);
+
+        if (byte != 0) {
+            TRY(result.try_append(byte));
+            continue;
+        }
+
+        if (bytes.is_empty() || bytes[0] != escaped_zero_byte)
+            return result;
+
+        TRY(result.try_append(0));
+        bytes = bytes.slice(1);
+    }
+
+    return Error::from_string_literal("Unterminated byte string in serialized key");
+}
+
+ErrorOr<ByteBuffer> Key::serialize() const
+{
+    ByteBuffer buffer;
+    TRY(serialize_into(buffer));
+    return buffer;
+}
+
+ErrorOr<void> Key::serialize_into(ByteBuffer& buffer) const
+{
+    switch (m_type) {
+    case Type::Number:
+    case Type::Date: {
+        TRY(buffer.try_append(to_underlying(m_type == Type::Number ? SerializedTag::Number : SerializedTag::Date)));
+
+        // Flip the sign bit of positive numbers, and every bit of negative ones, so that the big endian bytes of the
+        // result compare the same way as the numbers do.
+        auto bits = bit_cast<u64>(value_as_double());
+        bits = (bits & (1ull << 63)) != 0 ? ~bits : bits | (1ull << 63);
+
+        for (int shift = 56; shift >= 0; shift -= 8)
+            TRY(buffer.try_append(static_cast<u8>(bits >> shift)));
+        return {};
+    }
+    case Type::String: {
+        TRY(buffer.try_append(to_underlying(SerializedTag::String)));
+
+        // Strings compare by UTF-16 code unit, so serialize them as big endian UTF-16.
+        ByteBuffer code_units;
+        for (auto code_unit : TRY(utf8_to_utf16(value_as_string()))) {
+            TRY(code_units.try_append(static_cast<u8>(code_unit >> 8)));
+            TRY(code_units.try_append(static_cast<u8>(code_unit)));
+        }
+        return serialize_byte_string(buffer, code_units);
+    }
+    case Type::Binary:
+        TRY(buffer.try_append(to_underlying(SerializedTag::Binary)));
+        return serialize_byte_string(buffer, value_as_binary());
+    case Type::Array:
+        TRY(buffer.try_append(to_underlying(SerializedTag::Array)));
+        for (auto const& key : value_as_array())
+            TRY(key.serialize_into(buffer));
+        TRY(buffer.try_append(to_underlying(SerializedTag::End)));
+        return {};
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+ErrorOr<Key> Key::deserialize(ReadonlyBytes bytes)
+{
+    auto key = TRY(deserialize_from(bytes));
+    if (!bytes.is_empty())
+        return Error::from_string_literal("Trailing data after serialized key");
+    return key;
+}
+
+ErrorOr<Key> Key::deserialize_from(ReadonlyBytes& bytes)
+{
+    if (bytes.is_empty())
+        return Error::from_string_literal("Empty serialized key");
+
+    auto tag = static_cast<SerializedTag>(bytes[0]);
+    bytes = bytes.slice(1);
+
+    switch (tag) {
+    case SerializedTag::Number:
+    case SerializedTag::Date: {
+        if (bytes.size() < sizeof(u64))
+            return Error::from_string_literal("Truncated number in serialized key");
+
+        u64 bits = 0;
+        for (size_t i = 0; i < sizeof(u64); ++i)
+            bits = (bits << 8) | bytes[i];
+        bytes = bytes.slice(sizeof(u64));
+
+        bits = (bits & (1ull << 63)) != 0 ? bits & ~(1ull << 63) : ~bits;
+        auto value = bit_cast<double>(bits);
+
+        return tag == SerializedTag::Number ? create_number(value) : create_date(value);
+    }
+    case SerializedTag::String: {
+        auto code_unit_bytes = TRY(deserialize_byte_string(bytes));
+        if (code_unit_bytes.size() % 2 != 0)
+            return Error::from_string_literal("Odd number of bytes in serialized string key");
+
+        Utf16Data code_units;
+        TRY(code_units.try_ensure_capacity(code_unit_bytes.size() / 2));
+        for (size_t i = 0; i < code_unit_bytes.size(); i += 2)
+            code_units.unchecked_append(static_cast<u16>((code_unit_bytes[i] << 8) | code_unit_bytes[i + 1]));
+
+        return create_string(TRY(String::from_utf16(Utf16View { code_units })));
+    }
+    case SerializedTag::Binary:
+        return create_binary(TRY(deserialize_byte_string(bytes)));
+    case SerializedTag::Array: {
+        Vector<Key> keys;
+        while (true) {
+            if (bytes.is_empty())
+                return Error::from_string_literal("Unterminated array in serialized key");
+            if (bytes[0] == to_underlying(SerializedTag::End)) {
+                bytes = bytes.slice(1);
+                break;
+            }
+            TRY(keys.try_append(TRY(deserialize_from(bytes))));
+        }
+        return create_array(move(keys));
+    }
+    case SerializedTag::End:
+        break;
+    }
+
+    return Error::from_string_literal("Invalid tag in serialized key");
+}
+
+KeyRange KeyRange::only(Key key)
+{
+    return KeyRange { .lower = key, .upper = key, .lower_open = false, .upper_open = false };
+}
+
+// https://w3c.github.io/IndexedDB/#in
+bool KeyRange::is_in_range(Key const& key) const
+{
+    // A key is in a key range range if both of the following conditions are fulfilled:
+
+    // - The range's lower bound is null, or it is less than key, or it is both equal to key and the range's lower open flag is false.
+    if (lower.has_value()) {
+        auto comparison = Key::compare_two_keys(*lower, key);
+        if (comparison > 0 || (comparison == 0 && lower_open))
+            return false;
+    }
+
+    // - The range's upper bound is null, or it is greater than key, or it is both equal to key and the range's upper open flag is false.
+    if (upper.has_value()) {
+        auto comparison = Key::compare_two_keys(*upper, key);
+        if (comparison < 0 || (comparison == 0 && upper_open))
+            return false;
+    }
+
+    return true;
+}
+
+ErrorOr<KeyRange::SerializedBounds> KeyRange::serialize_bounds() const
+{
+    SerializedBounds bounds;
+
+    if (lower.has_value()) {
+        bounds.lower = TRY(lower->serialize());
+        if (lower_open)
+            TRY(bounds.lower.try_append(0));
+    }
+
+    if (upper.has_value()) {
+        bounds.upper = TRY(upper->serialize());
+        if (!upper_open)
+            TRY(bounds.upper.try_append(0));
+    } else {
+        TRY(bounds.upper.try_append(upper_bound_byte));
+    }
+
+    return bounds;
+}
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#key-construct
+class Key {
+public:
+    // NOTE: These are in ascending order of how keys of different types compare to each other.
+    enum class Type : u8 {
+        Number,
+        Date,
+        String,
+        Binary,
+        Array,
+    };
+
+    static Key create_number(double);
+    static Key create_date(double);
+    static Key create_string(String);
+    static Key create_binary(ByteBuffer);
+    static Key create_array(Vector<Key>);
+
+    Type type() const { return m_type; }
+
+    double value_as_double() const { return m_value.get<double>(); }
+    String const& value_as_string() const { return m_value.get<String>(); }
+    ByteBuffer const& value_as_binary() const { return m_value.get<ByteBuffer>(); }
+    Vector<Key> const& value_as_array() const { return m_value.get<Vector<Key>>(); }
+
+    // https://w3c.github.io/IndexedDB/#compare-two-keys
+    static int compare_two_keys(Key const&, Key const&);
+
+    bool operator==(Key const& other) const { return compare_two_keys(*this, other) == 0; }
+    bool operator<(Key const& other) const { return compare_two_keys(*this, other) < 0; }
+
+    // Serializes the key such that comparing two serialized keys byte by byte (i.e. with memcmp) orders them the same
+    // way as compare_two_keys() does, which lets a storage backend keep records in key order without knowing about
+    // keys at all.
+    ErrorOr<ByteBuffer> serialize() const;
+    static ErrorOr<Key> deserialize(ReadonlyBytes);
+
+private:
+    using Value = Variant<double, String, ByteBuffer, Vector<Key>>;
+
+    Key(Type type, Value value)
+        : m_type(type)
+        , m_value(move(value))
+    {
+    }
+
+    ErrorOr<void> serialize_into(ByteBuffer&) const;
+    static ErrorOr<Key> deserialize_from(ReadonlyBytes&);
+
+    Type m_type;
+    Value m_value;
+};
+
+// https://w3c.github.io/IndexedDB/#range-construct
+struct KeyRange {
+    static KeyRange only(Key);
+
+    // https://w3c.github.io/IndexedDB/#in
+    bool is_in_range(Key const&) const;
+
+    // Serialized bounds, such that a serialized key K is in the range exactly when lower <= K < upper. Exclusive lower
+    // and inclusive upper bounds are turned into their counterparts by appending a zero byte, which sorts right after
+    // the bound itself and before every other key that is greater than it.
+    struct SerializedBounds {
+        ByteBuffer lower;
+        ByteBuffer upper;
+    };
+    ErrorOr<SerializedBounds> serialize_bounds() const;
+
+    Optional<Key> lower;
+    Optional<Key> upper;
+    bool lower_open { false };
+    bool upper_open { false };
+};
+
+}
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <LibGfx/Rect.h>
 #include <LibJS/Heap/Cell.h>
@@ -52,6 +53,21 @@ public:
     void clear_contained_abspos_children() { m_contained_abspos_children.clear(); }
     Vector<GC::Ref<Node>> const& contained_abspos_children() const { return m_contained_abspos_children; }
 
+    // Intrinsic sizes only depend on what's inside the box, so they are cached on the box across layouts.
+    // The cache is thrown away whenever the box or anything inside it needs layout (see Node::set_needs_layout()).
+    struct IntrinsicSizes {
+        // The definite content height (if any) the box had when the widths below were computed.
+        Optional<CSSPixels> definite_height_for_widths;
+        Optional<CSSPixels> min_content_width;
+        Optional<CSSPixels> max_content_width;
+
+        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
+        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+    };
+
+    IntrinsicSizes& cached_intrinsic_sizes() const;
+    void clear_cached_intrinsic_sizes() const { m_cached_intrinsic_sizes = nullptr; }
+
     virtual void visit_edges(Cell::Visitor&) override;
 
 protected:
@@ -66,6 +82,8 @@ private:
     Optional<CSSPixelFraction> m_natural_aspect_ratio;
 
     Vector<GC::Ref<Node>> m_contained_abspos_children;
+
+    mutable OwnPtr<IntrinsicSizes> m_cached_intrinsic_sizes;
 };
 
 template<>
@@ -237,15 +237,76 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
     if (!child_box.can_have_children())
         return {};
 
+    // OPTIMIZATION: Layout boundaries that haven't changed since the previous layout, and are given the same size
+    //               and available space as last time, would end up with the same layout inside. In that case we
+    //               take the used values of their descendants from the previous layout instead of running it again.
+    bool const is_layout_boundary_in_final_layout = layout_mode == LayoutMode::Normal && !m_state.m_parent && is_layout_boundary(child_box);
+    if (is_layout_boundary_in_final_layout) {
+        if (can_reuse_previous_layout_inside(child_box, available_space)) {
+            m_state.reuse_used_values_of_descendants_from_previous_layout(child_box);
+            m_state.available_space_for_layout_boundaries.set(child_box, available_space);
+            return nullptr;
+        }
+    }
+
     auto independent_formatting_context = create_independent_formatting_context_if_needed(m_state, layout_mode, child_box);
     if (independent_formatting_context)
         independent_formatting_context->run(available_space);
     else
         run(available_space);
 
+    if (is_layout_boundary_in_final_layout)
+        m_state.available_space_for_layout_boundaries.set(child_box, available_space);
+
     return independent_formatting_context;
 }
 
+// A layout boundary is a box whose size is fixed by its own style, and whose insides are laid out by a formatting
+// context of their own. Nothing outside such a box can affect the layout inside it, other than its size and the
+// available space given to it.
+// FIXME: Also treat boxes with `contain: layout` or `contain: size` as boundaries once we support `contain`.
+bool FormattingContext::is_layout_boundary(Box const& box)
+{
+    if (box.is_viewport())
+        return false;
+    if (!box.computed_values().width().is_length() || !box.computed_values().height().is_length())
+        return false;
+
+    // Tables size their cells from the outside, and read their metrics back after laying them out.
+    if (box.display().is_table_inside() || box.display().is_table_cell())
+        return false;
+
+    return formatting_context_type_created_by_box(box).has_value();
+}
+
+bool FormattingContext::can_reuse_previous_layout_inside(Box const& box, AvailableSpace const& available_space) const
+{
+    auto const* previous_layout = m_state.m_previous_layout;
+    if (!previous_layout)
+        return false;
+
+    if (box.needs_layout() || box.child_needs_layout())
+        return false;
+    for (auto const* ancestor = box.parent(); ancestor; ancestor = ancestor->parent()) {
+        if (ancestor->needs_layout())
+            return false;
+    }
+
+    auto previous_available_space = previous_layout->available_space_for_layout_boundaries.get(box);
+    if (!previous_available_space.has_value() || previous_available_space.value() != available_space)
+        return false;
+
+    auto const* previous_used_values = previous_layout->used_values_per_layout_node.get(box).value_or(nullptr);
+    if (!previous_used_values)
+        return false;
+
+    auto const& used_values = m_state.get(box);
+    return used_values.content_width() == previous_used_values->content_width()
+        && used_values.content_height() == previous_used_values->content_height()
+        && used_values.has_definite_width() == previous_used_values->has_definite_width()
+        && used_values.has_definite_height() == previous_used_values->has_definite_height();
+}
+
 CSSPixels FormattingContext::greatest_child_width(Box const& box) const
 {
     CSSPixels max_width = 0;
@@ -1413,18 +1474,48 @@ CSSPixels FormattingContext::calculate_fit_content_height(Layout::Box const& box
     return calculate_max_content_height(box, available_space.width.to_px_or_zero());
 }
 
+Box::IntrinsicSizes& FormattingContext::cached_intrinsic_sizes_for_width(Box const& box) const
+{
+    // The intrinsic widths of a box depend on whether it has a definite height (which percentages inside it
+    // resolve against), and that is decided from the outside. If it changed, the cached widths are stale.
+    auto const& used_values = m_state.get(box);
+    Optional<CSSPixels> definite_height;
+    if (used_values.has_definite_height())
+        definite_height = used_values.content_height();
+
+    auto& cache = box.cached_intrinsic_sizes();
+    if (cache.definite_height_for_widths != definite_height) {
+        cache.definite_height_for_widths = definite_height;
+        cache.min_content_width.clear();
+        cache.max_content_width.clear();
+    }
+    return cache;
+}
+
+void FormattingContext::did_start_intrinsic_sizing_layout(LayoutState const& throwaway_state) const
+{
+    size_t depth = 0;
+    for (auto const* state = throwaway_state.m_parent; state; state = state->m_parent)
+        ++depth;
+
+    auto& statistics = m_state.m_root.intrinsic_sizing_statistics;
+    ++statistics.layouts;
+    statistics.max_depth = max(statistics.max_depth, depth);
+}
+
 CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box) const
 {
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
-
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-    if (cache.min_content_width.has_value())
+    auto& cache = cached_intrinsic_sizes_for_width(box);
+    if (cache.min_content_width.has_value()) {
+        ++m_state.m_root.intrinsic_sizing_statistics.cache_hits;
         return *cache.min_content_width;
+    }
 
     LayoutState throwaway_state(&m_state);
+    did_start_intrinsic_sizing_layout(throwaway_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
     box_state.width_constraint = SizeConstraint::MinContent;
@@ -1458,13 +1549,14 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
-
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-    if (cache.max_content_width.has_value())
+    auto& cache = cached_intrinsic_sizes_for_width(box);
+    if (cache.max_content_width.has_value()) {
+        ++m_state.m_root.intrinsic_sizing_statistics.cache_hits;
         return *cache.max_content_width;
+    }
 
     LayoutState throwaway_state(&m_state);
+    did_start_intrinsic_sizing_layout(throwaway_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
     box_state.width_constraint = SizeConstraint::MaxContent;
@@ -1504,15 +1596,16 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        return &cache.min_content_height.ensure(width);
+        return &box.cached_intrinsic_sizes().min_content_height.ensure(width);
     };
 
-    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
+    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value()) {
+        ++m_state.m_root.intrinsic_sizing_statistics.cache_hits;
         return cache_slot->value();
+    }
 
     LayoutState throwaway_state(&m_state);
+    did_start_intrinsic_sizing_layout(throwaway_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
     box_state.height_constraint = SizeConstraint::MinContent;
@@ -1548,15 +1641,16 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        return &cache.max_content_height.ensure(width);
+        return &box.cached_intrinsic_sizes().max_content_height.ensure(width);
     };
 
-    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
+    if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value()) {
+        ++m_state.m_root.intrinsic_sizing_statistics.cache_hits;
         return cache_slot->value();
+    }
 
     LayoutState throwaway_state(&m_state);
+    did_start_intrinsic_sizing_layout(throwaway_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
     box_state.height_constraint = SizeConstraint::MaxContent;
@@ -110,6 +110,12 @@ protected:
 
     OwnPtr<FormattingContext> layout_inside(Box const&, LayoutMode, AvailableSpace const&);
 
+    Box::IntrinsicSizes& cached_intrinsic_sizes_for_width(Box const&) const;
+    void did_start_intrinsic_sizing_layout(LayoutState const& throwaway_state) const;
+
+    static bool is_layout_boundary(Box const&);
+    bool can_reuse_previous_layout_inside(Box const&, AvailableSpace const&) const;
+
     struct SpaceUsedByFloats {
         CSSPixels left { 0 };
         CSSPixels right { 0 };
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/GridFormattingContext.h>
@@ -321,20 +322,10 @@ void GridFormattingContext::place_item_with_row_position(Box const& child_box)
     size_t row_span = placement_position.span;
 
     auto const& grid_column_start = child_box.computed_values().grid_column_start();
-    int column_start = 0;
     size_t column_span = grid_column_start.is_span() ? grid_column_start.span() : 1;
 
-    bool found_available_column = false;
-    for (size_t column_index = column_start; column_index < m_occupation_grid.column_count(); column_index++) {
-        if (!m_occupation_grid.is_occupied(column_index, row_start)) {
-            found_available_column = true;
-            column_start = column_index;
-            break;
-        }
-    }
-    if (!found_available_column) {
-        column_start = m_occupation_grid.column_count();
-    }
+    // Take the first column that is available in the row, or the one right after the implicit grid.
+    int column_start = min(m_occupation_grid.first_unoccupied_column_in_row(row_start, 0), static_cast<int>(m_occupation_grid.column_count()));
 
     record_grid_placement(GridItem {
         .box = child_box,
@@ -382,11 +373,13 @@ FoundUnoccupiedPlace OccupationGrid::find_unoccupied_place(GridDimension dimensi
 {
     if (dimension == GridDimension::Column) {
         while (row_index <= max_row_index()) {
-            while (column_index <= max_column_index()) {
-                auto enough_span_for_span = column_index + column_span - 1 <= max_column_index();
-                if (enough_span_for_span && !is_occupied(column_index, row_index))
+            auto last_column_with_enough_span = max_column_index() - column_span + 1;
+            if (column_index <= last_column_with_enough_span) {
+                auto unoccupied_column_index = first_unoccupied_column_in_row(row_index, column_index);
+                if (unoccupied_column_index <= last_column_with_enough_span) {
+                    column_index = unoccupied_column_index;
                     return FoundUnoccupiedPlace::Yes;
-                column_index++;
+                }
             }
             row_index++;
             column_index = min_column_index();
@@ -2320,23 +2313,121 @@ void GridFormattingContext::init_grid_lines(GridDimension dimension)
     lines.append({ .names = line_names });
 }
 
+void OccupationGrid::ensure_stored(int column_start, int column_end, int row_start, int row_end)
+{
+    auto stored_column_end = m_first_stored_column + static_cast<int>(m_stored_column_count);
+    auto stored_row_end = m_first_stored_row + static_cast<int>(m_stored_row_count);
+    bool has_storage = m_stored_column_count > 0;
+
+    if (has_storage && column_start >= m_first_stored_column && column_end <= stored_column_end && row_start >= m_first_stored_row) {
+        // Rows are appended at the end, which leaves everything that's already stored in place.
+        if (row_end > stored_row_end) {
+            m_stored_row_count = row_end - m_first_stored_row;
+            m_cells.resize(m_stored_row_count * words_per_row());
+            while (m_first_maybe_unoccupied_column.size() < m_stored_row_count)
+                m_first_maybe_unoccupied_column.append(m_first_stored_column);
+        }
+        return;
+    }
+
+    // Otherwise the rows have to be laid out again. Widen them generously, so that this stays rare.
+    auto old_cells = move(m_cells);
+    auto old_first_column = m_first_stored_column;
+    auto old_first_row = m_first_stored_row;
+    auto old_words_per_row = words_per_row();
+    auto old_row_count = m_stored_row_count;
+
+    if (has_storage) {
+        column_start = min(column_start, m_first_stored_column);
+        column_end = max(max(column_end, stored_column_end), m_first_stored_column + static_cast<int>(2 * m_stored_column_count));
+        row_start = min(row_start, m_first_stored_row);
+        row_end = max(row_end, stored_row_end);
+    }
+
+    m_first_stored_column = column_start;
+    m_first_stored_row = row_start;
+    m_stored_column_count = align_up_to(static_cast<size_t>(column_end - column_start), bits_per_word);
+    m_stored_row_count = row_end - row_start;
+    m_cells.clear();
+    m_cells.resize(m_stored_row_count * words_per_row());
+
+    for (size_t row = 0; row < old_row_count; ++row) {
+        auto* new_row_words = row_words(old_first_row + static_cast<int>(row));
+        for (size_t word_index = 0; word_index < old_words_per_row; ++word_index) {
+            for (auto word = old_cells[row * old_words_per_row + word_index]; word; word &= word - 1) {
+                auto bit = static_cast<size_t>(old_first_column - m_first_stored_column) + word_index * bits_per_word + count_trailing_zeroes(word);
+                new_row_words[bit / bits_per_word] |= Word(1) << (bit % bits_per_word);
+            }
+        }
+    }
+
+    m_first_maybe_unoccupied_column.clear();
+    m_first_maybe_unoccupied_column.ensure_capacity(m_stored_row_count);
+    for (size_t row = 0; row < m_stored_row_count; ++row)
+        m_first_maybe_unoccupied_column.unchecked_append(scan_for_unoccupied_column(m_first_stored_row + static_cast<int>(row), m_first_stored_column));
+}
+
 void OccupationGrid::set_occupied(int column_start, int column_end, int row_start, int row_end)
 {
-    for (int row_index = row_start; row_index < row_end; row_index++) {
-        for (int column_index = column_start; column_index < column_end; column_index++) {
-            m_min_column_index = min(m_min_column_index, column_index);
-            m_max_column_index = max(m_max_column_index, column_index);
-            m_min_row_index = min(m_min_row_index, row_index);
-            m_max_row_index = max(m_max_row_index, row_index);
+    if (column_start >= column_end || row_start >= row_end)
+        return;
+
+    m_min_column_index = min(m_min_column_index, column_start);
+    m_max_column_index = max(m_max_column_index, column_end - 1);
+    m_min_row_index = min(m_min_row_index, row_start);
+    m_max_row_index = max(m_max_row_index, row_end - 1);
+
+    ensure_stored(column_start, column_end, row_start, row_end);
 
-            m_occupation_grid.set(GridPosition { .row = row_index, .column = column_index });
+    size_t const first_bit = column_start - m_first_stored_column;
+    size_t const end_bit = column_end - m_first_stored_column;
+    for (int row_index = row_start; row_index < row_end; row_index++) {
+        auto* words = row_words(row_index);
+        for (size_t bit = first_bit; bit < end_bit;) {
+            auto bit_in_word = bit % bits_per_word;
+            auto bit_count = min(bits_per_word - bit_in_word, end_bit - bit);
+            auto mask = bit_count == bits_per_word ? ~Word(0) : ((Word(1) << bit_count) - 1) << bit_in_word;
+            words[bit / bits_per_word] |= mask;
+            bit += bit_count;
         }
+
+        auto& first_maybe_unoccupied_column = m_first_maybe_unoccupied_column[row_index - m_first_stored_row];
+        if (first_maybe_unoccupied_column >= column_start && first_maybe_unoccupied_column < column_end)
+            first_maybe_unoccupied_column = scan_for_unoccupied_column(row_index, column_end);
     }
 }
 
 bool OccupationGrid::is_occupied(int column_index, int row_index) const
 {
-    return m_occupation_grid.contains(GridPosition { row_index, column_index });
+    if (!is_stored_row(row_index) || column_index < m_first_stored_column || column_index >= m_first_stored_column + static_cast<int>(m_stored_column_count))
+        return false;
+    size_t bit = column_index - m_first_stored_column;
+    return (row_words(row_index)[bit / bits_per_word] >> (bit % bits_per_word)) & 1;
+}
+
+int OccupationGrid::scan_for_unoccupied_column(int row_index, int column_index) const
+{
+    auto stored_column_end = m_first_stored_column + static_cast<int>(m_stored_column_count);
+    if (column_index < m_first_stored_column || column_index >= stored_column_end)
+        return column_index;
+
+    auto const* words = row_words(row_index);
+    size_t bit = column_index - m_first_stored_column;
+    auto word_index = bit / bits_per_word;
+    auto unoccupied = ~words[word_index] & (~Word(0) << (bit % bits_per_word));
+    while (!unoccupied) {
+        if (++word_index == words_per_row())
+            return stored_column_end;
+        unoccupied = ~words[word_index];
+    }
+    return m_first_stored_column + static_cast<int>(word_index * bits_per_word) + count_trailing_zeroes(unoccupied);
+}
+
+int OccupationGrid::first_unoccupied_column_in_row(int row_index, int column_index) const
+{
+    if (!is_stored_row(row_index) || column_index < m_first_stored_column)
+        return column_index;
+    return scan_for_unoccupied_column(row_index, max(column_index, m_first_maybe_unoccupied_column[row_index - m_first_stored_row]));
 }
 
 int GridItem::gap_adjusted_row() const
@@ -2631,10 +2722,3 @@ StaticPositionRect GridFormattingContext::calculate_static_position_rect(Box con
     return static_position;
 }
 }
-
-namespace AK {
-template<>
-struct Traits<Web::Layout::GridPosition> : public DefaultTraits<Web::Layout::GridPosition> {
-    static unsigned hash(Web::Layout::GridPosition const& key) { return pair_int_hash(key.row, key.column); }
-};
-}
@@ -28,12 +28,6 @@ enum class Alignment {
     Stretch,
 };
 
-struct GridPosition {
-    int row;
-    int column;
-    inline bool operator==(GridPosition const&) const = default;
-};
-
 struct GridItem {
     GC::Ref<Box const> box;
 
@@ -75,6 +69,9 @@ enum class FoundUnoccupiedPlace {
     Yes
 };
 
+// Keeps track of which cells of the implicit grid are occupied, with one bit per cell. Rows are stored one after
+// another, each padded to a whole number of words, so that free cells in a row can be found a word at a time.
+// The stored area grows on demand to cover every occupied cell, including ones at negative indices.
 class OccupationGrid {
 public:
     OccupationGrid(size_t columns_count, size_t rows_count)
@@ -105,10 +102,32 @@ public:
 
     bool is_occupied(int column_index, int row_index) const;
 
+    // Returns the first column at or after `column_index` whose cell in the given row is unoccupied.
+    int first_unoccupied_column_in_row(int row_index, int column_index) const;
+
     FoundUnoccupiedPlace find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span) const;
 
 private:
-    HashTable<GridPosition> m_occupation_grid;
+    using Word = u64;
+    static constexpr size_t bits_per_word = sizeof(Word) * 8;
+
+    size_t words_per_row() const { return m_stored_column_count / bits_per_word; }
+    Word const* row_words(int row_index) const { return m_cells.data() + (row_index - m_first_stored_row) * words_per_row(); }
+    Word* row_words(int row_index) { return m_cells.data() + (row_index - m_first_stored_row) * words_per_row(); }
+
+    bool is_stored_row(int row_index) const { return row_index >= m_first_stored_row && row_index < m_first_stored_row + static_cast<int>(m_stored_row_count); }
+    void ensure_stored(int column_start, int column_end, int row_start, int row_end);
+    int scan_for_unoccupied_column(int row_index, int column_index) const;
+
+    Vector<Word> m_cells;
+    int m_first_stored_column { 0 };
+    int m_first_stored_row { 0 };
+    size_t m_stored_column_count { 0 };
+    size_t m_stored_row_count { 0 };
+
+    // Per stored row, a column before which every cell of the row is known to be occupied. Dense packing
+    // keeps coming back to the start of rows, so this lets it skip over the part that has filled up.
+    Vector<int> m_first_maybe_unoccupied_column;
 
     int m_min_column_index { 0 };
     int m_max_column_index { 0 };
@@ -71,6 +71,30 @@ LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
     return *new_used_values_ptr;
 }
 
+void LayoutState::reuse_used_values_of_descendants_from_previous_layout(Box const& box)
+{
+    VERIFY(m_previous_layout);
+
+    // NOTE: This walks the subtree in tree order, so containing blocks inside `box` have been copied before
+    //       anything that points at their used values.
+    box.for_each_in_subtree([&](Node const& node) {
+        auto const* previous_used_values = m_previous_layout->used_values_per_layout_node.get(node).value_or(nullptr);
+        if (!previous_used_values)
+            return TraversalDecision::Continue;
+
+        auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr);
+        if (used_values) {
+            *used_values = *previous_used_values;
+        } else {
+            auto new_used_values = adopt_own(*new UsedValues(*previous_used_values));
+            used_values = new_used_values.ptr();
+            used_values_per_layout_node.set(node, move(new_used_values));
+        }
+        used_values->set_containing_block_used_values(&get(*node.containing_block()));
+        return TraversalDecision::Continue;
+    });
+}
+
 // https://www.w3.org/TR/css-overflow-3/#scrollable-overflow
 static CSSPixelRect measure_scrollable_overflow(Box const& box)
 {
@@ -293,7 +317,8 @@ void LayoutState::commit(Box& root)
 
             if (used_values.computed_svg_path().has_value() && is<Painting::SVGPathPaintable>(paintable_box)) {
                 auto& svg_geometry_paintable = static_cast<Painting::SVGPathPaintable&>(paintable_box);
-                svg_geometry_paintable.set_computed_path(move(*used_values.computed_svg_path()));
+                // NOTE: The path is copied rather than moved, as these used values may be reused by the next layout.
+                svg_geometry_paintable.set_computed_path(*used_values.computed_svg_path());
             }
 
             if (node.display().is_grid_inside()) {
@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/LineBox.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -76,6 +77,7 @@ struct LayoutState {
         void set_node(NodeWithStyle&, UsedValues const* containing_block_used_values);
 
         UsedValues const* containing_block_used_values() const { return m_containing_block_used_values; }
+        void set_containing_block_used_values(UsedValues const* used_values) { m_containing_block_used_values = used_values; }
 
         CSSPixels content_width() const { return m_content_width; }
         CSSPixels content_height() const { return m_content_height; }
@@ -225,21 +227,31 @@ struct LayoutState {
 
     HashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
 
-    // We cache intrinsic sizes once determined, as they will not change over the course of a full layout.
-    // This avoids computing them several times while performing flex layout.
-    struct IntrinsicSizes {
-        Optional<CSSPixels> min_content_width;
-        Optional<CSSPixels> max_content_width;
-
-        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
-        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+    // How much intrinsic sizing went on during this layout, tallied on the top-level state.
+    // Every intrinsic sizing layout runs in a throwaway state nested below the one that asked for it,
+    // so the nesting depth tells how far intrinsic sizing recursed.
+    struct IntrinsicSizingStatistics {
+        size_t cache_hits { 0 };
+        size_t layouts { 0 };
+        size_t max_depth { 0 };
     };
 
-    HashMap<GC::Ptr<NodeWithStyle const>, NonnullOwnPtr<IntrinsicSizes>> mutable intrinsic_sizes;
+    IntrinsicSizingStatistics mutable intrinsic_sizing_statistics;
+
+    // The available space each layout boundary was laid out with. Together with the boundary's own size,
+    // this is what decides whether the next layout can reuse the used values of everything inside it.
+    HashMap<GC::Ref<Box const>, AvailableSpace> available_space_for_layout_boundaries;
+
+    // Copies the used values of everything inside `box` from the previous layout.
+    void reuse_used_values_of_descendants_from_previous_layout(Box const&);
 
     LayoutState const* m_parent { nullptr };
     LayoutState const& m_root;
 
+    // The committed state of the previous layout, if the layout tree is unchanged since then.
+    // Only ever set on the top-level LayoutState.
+    LayoutState const* m_previous_layout { nullptr };
+
 private:
     void resolve_relative_positions();
 };
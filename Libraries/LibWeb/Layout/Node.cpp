@@ -1109,6 +1109,56 @@ void Node::clear_paintables()
     m_paintable.clear();
 }
 
+void Node::set_needs_layout()
+{
+    // NOTE: If this node is already marked, the intrinsic sizes of this box and its ancestors have been thrown away
+    //       when it was marked, and nothing has been laid out since.
+    if (m_needs_layout)
+        return;
+    m_needs_layout = true;
+
+    // The intrinsic sizes of this box, and of every box containing it, may now be different. Those of the boxes
+    // inside it are thrown away by layout (see clear_cached_intrinsic_sizes_in_subtrees_that_need_layout()).
+    if (is<Box>(*this))
+        static_cast<Box&>(*this).clear_cached_intrinsic_sizes();
+
+    // NOTE: Ancestors that are already marked have had their intrinsic sizes thrown away when they were marked,
+    //       and nothing has been laid out since.
+    for (auto* ancestor = parent(); ancestor && !ancestor->m_child_needs_layout; ancestor = ancestor->parent()) {
+        ancestor->m_child_needs_layout = true;
+        if (is<Box>(*ancestor))
+            static_cast<Box&>(*ancestor).clear_cached_intrinsic_sizes();
+    }
+
+    document().set_needs_incremental_layout();
+}
+
+void Node::clear_cached_intrinsic_sizes_in_subtrees_that_need_layout()
+{
+    if (m_needs_layout) {
+        for_each_in_inclusive_subtree_of_type<Box>([](Box& box) {
+            box.clear_cached_intrinsic_sizes();
+            return TraversalDecision::Continue;
+        });
+        return;
+    }
+    if (!m_child_needs_layout)
+        return;
+    for (auto* child = first_child(); child; child = child->next_sibling())
+        child->clear_cached_intrinsic_sizes_in_subtrees_that_need_layout();
+}
+
+void Node::clear_needs_layout_in_subtree()
+{
+    bool had_dirty_descendants = m_child_needs_layout;
+    m_needs_layout = false;
+    m_child_needs_layout = false;
+    if (!had_dirty_descendants)
+        return;
+    for (auto* child = first_child(); child; child = child->next_sibling())
+        child->clear_needs_layout_in_subtree();
+}
+
 GC::Ptr<Painting::Paintable> Node::create_paintable() const
 {
     return nullptr;
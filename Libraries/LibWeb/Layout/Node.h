@@ -164,6 +164,17 @@ public:
     void removed_from(Node&) { }
     void children_changed() { }
 
+    // Marks this node as changed in a way that affects the layout of its subtree, and its ancestors as having
+    // such a node somewhere below them. Layout can then reuse previous results for boxes that were untouched.
+    void set_needs_layout();
+    bool needs_layout() const { return m_needs_layout; }
+    bool child_needs_layout() const { return m_child_needs_layout; }
+    void clear_needs_layout_in_subtree();
+
+    // Throws away the cached intrinsic sizes of every box inside a node that needs layout. This is done once before
+    // layout rather than whenever a node is marked, so that marking many nodes stays cheap.
+    void clear_cached_intrinsic_sizes_in_subtrees_that_need_layout();
+
     bool children_are_inline() const { return m_children_are_inline; }
     void set_children_are_inline(bool value) { m_children_are_inline = value; }
 
@@ -197,6 +208,9 @@ private:
     bool m_has_style { false };
     bool m_children_are_inline { false };
 
+    bool m_needs_layout { false };
+    bool m_child_needs_layout { false };
+
     bool m_is_flex_item { false };
     bool m_is_grid_item { false };
 
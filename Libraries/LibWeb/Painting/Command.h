@@ -8,6 +8,8 @@
 
 #include <AK/Forward.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
 #include <AK/SegmentedVector.h>
 #include <AK/Utf8View.h>
 #include <AK/Vector.h>
@@ -26,6 +28,7 @@
 #include <LibGfx/Size.h>
 #include <LibGfx/TextAlignment.h>
 #include <LibGfx/TextLayout.h>
+#include <LibMedia/VideoFramePool.h>
 #include <LibWeb/CSS/Enums.h>
 #include <LibWeb/Painting/BorderRadiiData.h>
 #include <LibWeb/Painting/BorderRadiusCornerClipper.h>
@@ -78,6 +81,18 @@ struct DrawScaledImmutableBitmap {
     void translate_by(Gfx::IntPoint const& offset) { dst_rect.translate_by(offset); }
 };
 
+// Draws whichever frame of a video is presented when the display list is played, so that presenting a new frame does
+// not require recording the display list again.
+struct DrawVideoFrame {
+    Gfx::IntRect dst_rect;
+    NonnullRefPtr<Media::VideoFramePool> frame_pool;
+    Gfx::IntRect src_rect;
+    Gfx::ScalingMode scaling_mode;
+
+    [[nodiscard]] Gfx::IntRect bounding_rect() const { return dst_rect; }
+    void translate_by(Gfx::IntPoint const& offset) { dst_rect.translate_by(offset); }
+};
+
 struct DrawRepeatedImmutableBitmap {
     struct Repeat {
         bool x { false };
@@ -115,6 +130,23 @@ struct StackingContextTransform {
     Gfx::FloatMatrix4x4 matrix;
 };
 
+// The opacity and transform of a stacking context, shared between the stacking context and the display lists it has
+// been recorded into. Like scroll offsets, these are looked up when the display list is played, so that animating them
+// only requires updating this object and playing the display list again.
+class CompositedProperties : public RefCounted<CompositedProperties> {
+public:
+    static NonnullRefPtr<CompositedProperties> create()
+    {
+        return adopt_ref(*new CompositedProperties());
+    }
+
+    float opacity { 1.0f };
+    StackingContextTransform transform {};
+
+private:
+    CompositedProperties() = default;
+};
+
 struct PushStackingContext {
     float opacity;
     CSS::ResolvedFilter filter;
@@ -123,6 +155,8 @@ struct PushStackingContext {
     // A translation to be applied after the stacking context has been transformed.
     StackingContextTransform transform;
     Optional<Gfx::Path> clip_path = {};
+    // If present, this overrides the opacity and transform above when the display list is played.
+    RefPtr<CompositedProperties const> composited_properties = {};
 
     void translate_by(Gfx::IntPoint const& offset)
     {
@@ -381,6 +415,12 @@ struct PaintNestedDisplayList {
     }
 };
 
+// Plays the commands of a display list that is recorded and cached on its own, such as the one of a stacking context,
+// as if they had been recorded in place of this command.
+struct PaintCachedDisplayList {
+    NonnullRefPtr<DisplayList> display_list;
+};
+
 struct PaintScrollBar {
     int scroll_frame_id;
     Gfx::IntRect rect;
@@ -423,6 +463,7 @@ using Command = Variant<
     FillRect,
     DrawPaintingSurface,
     DrawScaledImmutableBitmap,
+    DrawVideoFrame,
     DrawRepeatedImmutableBitmap,
     Save,
     Restore,
@@ -450,6 +491,7 @@ using Command = Variant<
     AddRoundedRectClip,
     AddMask,
     PaintNestedDisplayList,
+    PaintCachedDisplayList,
     PaintScrollBar,
     ApplyOpacity,
     ApplyTransform,
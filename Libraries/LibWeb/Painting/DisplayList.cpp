@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/PerformanceTrace.h>
 #include <LibWeb/Painting/DisplayList.h>
 
 namespace Web::Painting {
@@ -36,16 +37,27 @@ static bool command_is_clip_or_mask(Command const& command)
 }
 
 void DisplayListPlayer::execute(DisplayList& display_list)
+{
+    Core::PerformanceTraceSpan trace_span("rendering"sv, "rasterize"sv);
+
+    execute_commands(display_list, display_list.scroll_state(), display_list.device_pixels_per_css_pixel());
+}
+
+void DisplayListPlayer::execute_commands(DisplayList const& display_list, ScrollState const& scroll_state, double device_pixels_per_css_pixel)
 {
     auto const& commands = display_list.commands();
-    auto const& scroll_state = display_list.scroll_state();
-    auto device_pixels_per_css_pixel = display_list.device_pixels_per_css_pixel();
 
     size_t next_command_index = 0;
     while (next_command_index < commands.size()) {
         auto scroll_frame_id = commands[next_command_index].scroll_frame_id;
         auto command = commands[next_command_index++].command;
 
+        // The commands of a cached display list are played as part of this one, so they use its scroll state.
+        if (command.has<PaintCachedDisplayList>()) {
+            execute_commands(*command.get<PaintCachedDisplayList>().display_list, scroll_state, device_pixels_per_css_pixel);
+            continue;
+        }
+
         if (command.has<PaintScrollBar>()) {
             auto& paint_scroll_bar = command.get<PaintScrollBar>();
             auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
@@ -58,6 +70,14 @@ void DisplayListPlayer::execute(DisplayList& display_list)
             }
         }
 
+        if (command.has<PushStackingContext>()) {
+            auto& push_stacking_context = command.get<PushStackingContext>();
+            if (auto const& composited_properties = push_stacking_context.composited_properties) {
+                push_stacking_context.opacity = composited_properties->opacity;
+                push_stacking_context.transform = composited_properties->transform;
+            }
+        }
+
         if (scroll_frame_id.has_value()) {
             auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
             auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
@@ -93,6 +113,7 @@ void DisplayListPlayer::execute(DisplayList& display_list)
         else HANDLE_COMMAND(FillRect, fill_rect)
         else HANDLE_COMMAND(DrawPaintingSurface, draw_painting_surface)
         else HANDLE_COMMAND(DrawScaledImmutableBitmap, draw_scaled_immutable_bitmap)
+        else HANDLE_COMMAND(DrawVideoFrame, draw_video_frame)
         else HANDLE_COMMAND(DrawRepeatedImmutableBitmap, draw_repeated_immutable_bitmap)
         else HANDLE_COMMAND(AddClipRect, add_clip_rect)
         else HANDLE_COMMAND(Save, save)
@@ -43,10 +43,13 @@ public:
     void execute(DisplayList& display_list);
 
 private:
+    void execute_commands(DisplayList const&, ScrollState const&, double device_pixels_per_css_pixel);
+
     virtual void draw_glyph_run(DrawGlyphRun const&) = 0;
     virtual void fill_rect(FillRect const&) = 0;
     virtual void draw_painting_surface(DrawPaintingSurface const&) = 0;
     virtual void draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const&) = 0;
+    virtual void draw_video_frame(DrawVideoFrame const&) = 0;
     virtual void draw_repeated_immutable_bitmap(DrawRepeatedImmutableBitmap const&) = 0;
     virtual void save(Save const&) = 0;
     virtual void restore(Restore const&) = 0;
@@ -89,6 +92,7 @@ public:
     }
 
     void append(Command&& command, Optional<i32> scroll_frame_id);
+    void clear() { m_commands.clear(); }
 
     struct CommandListItem {
         Optional<i32> scroll_frame_id;
@@ -96,6 +100,7 @@ public:
     };
 
     AK::SegmentedVector<CommandListItem, 512> const& commands() const { return m_commands; }
+    AK::SegmentedVector<CommandListItem, 512>& commands() { return m_commands; }
 
     void set_scroll_state(ScrollState scroll_state) { m_scroll_state = move(scroll_state); }
     ScrollState const& scroll_state() const { return m_scroll_state; }
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibCore/PerformanceTrace.h>
+#include <LibGfx/TextLayout.h>
+#include <LibWeb/Painting/DisplayListOptimizer.h>
+
+namespace Web::Painting {
+
+// A batched glyph run is culled as a whole when the display list is played, so we don't let it grow much beyond a few
+// lines of text.
+static constexpr size_t max_glyph_count_of_batched_glyph_run = 256;
+
+// Only this many of the most recent draws are checked for being covered by an opaque fill, so that long runs of draws
+// without state changes in between don't make the pass quadratic.
+static constexpr size_t max_occlusion_candidate_count = 32;
+
+template<typename... Ts>
+static bool command_is_one_of(Command const& command)
+{
+    return (command.has<Ts>() || ...);
+}
+
+// Commands that paint within their bounding rectangle, without changing the state of the painter.
+static bool is_bounded_draw(Command const& command)
+{
+    return command_is_one_of<DrawGlyphRun, FillRect, DrawPaintingSurface, DrawScaledImmutableBitmap, DrawVideoFrame,
+        PaintLinearGradient, PaintRadialGradient, PaintConicGradient, PaintOuterBoxShadow, PaintInnerBoxShadow,
+        PaintTextShadow, FillRectWithRoundedCorners, FillPathUsingColor, FillPathUsingPaintStyle, StrokePathUsingColor,
+        StrokePathUsingPaintStyle, DrawEllipse, FillEllipse, DrawRect>(command);
+}
+
+// Commands that paint something, without changing the state of the painter. Cached display lists are recorded with
+// balanced state changes, so they count as a single draw.
+static bool is_draw(Command const& command)
+{
+    return is_bounded_draw(command)
+        || command_is_one_of<DrawRepeatedImmutableBitmap, DrawLine, DrawTriangleWave, PaintScrollBar, PaintCachedDisplayList>(command);
+}
+
+// Draws that don't paint anything outside of their bounding rectangle, so they can't be seen beneath an opaque fill of
+// that rectangle.
+static bool can_be_occluded(Command const& command)
+{
+    return command_is_one_of<FillRect, FillRectWithRoundedCorners, DrawPaintingSurface, DrawScaledImmutableBitmap,
+        DrawVideoFrame, PaintLinearGradient, PaintRadialGradient, PaintConicGradient>(command);
+}
+
+// State changes that only affect the commands before the next restore.
+static bool is_restorable_state_change(Command const& command)
+{
+    return command_is_one_of<Translate, AddClipRect, AddRoundedRectClip, AddMask, ApplyMaskBitmap, ApplyTransform>(command);
+}
+
+static bool saves_state(Command const& command)
+{
+    return command_is_one_of<Save, PushStackingContext, ApplyOpacity>(command);
+}
+
+static bool restores_state(Command const& command)
+{
+    return command_is_one_of<Restore, PopStackingContext>(command);
+}
+
+static Gfx::IntRect bounding_rect_of_draw(Command const& command)
+{
+    return command.visit(
+        [&](auto const& command) -> Gfx::IntRect {
+            if constexpr (requires { command.bounding_rect(); })
+                return command.bounding_rect();
+            else
+                VERIFY_NOT_REACHED();
+        });
+}
+
+static bool can_merge_fill_rects(Gfx::IntRect const& a, Gfx::IntRect const& b, Color color)
+{
+    auto overlap = a.intersected(b);
+    // Overlapping translucent fills would blend twice where they overlap.
+    if (!overlap.is_empty() && color.alpha() != 255)
+        return false;
+
+    auto area = [](Gfx::IntRect const& rect) { return static_cast<i64>(rect.width()) * rect.height(); };
+    return area(a.united(b)) == area(a) + area(b) - area(overlap);
+}
+
+static bool can_batch_glyph_runs(DrawGlyphRun const& a, DrawGlyphRun const& b)
+{
+    return &a.glyph_run->font() == &b.glyph_run->font()
+        && a.scale == b.scale
+        && a.color == b.color
+        && a.orientation == Gfx::Orientation::Horizontal
+        && b.orientation == Gfx::Orientation::Horizontal
+        && a.glyph_run->glyphs().size() + b.glyph_run->glyphs().size() <= max_glyph_count_of_batched_glyph_run;
+}
+
+class DisplayListOptimizer {
+public:
+    DisplayListOptimizer(DisplayList& display_list, DisplayListOptimizationStatistics* statistics)
+        : m_commands(display_list.commands())
+        , m_statistics(statistics)
+    {
+        m_is_removed.resize(m_commands.size());
+    }
+
+    void optimize()
+    {
+        if (m_statistics)
+            m_statistics->command_count_before_optimization = m_commands.size();
+
+        run_pass("cull draws"sv, &DisplayListOptimizer::cull_draws);
+        run_pass("remove occluded draws"sv, &DisplayListOptimizer::remove_occluded_draws);
+        run_pass("remove redundant state changes"sv, &DisplayListOptimizer::remove_redundant_state_changes);
+        run_pass("merge fill rects"sv, &DisplayListOptimizer::merge_fill_rects);
+        run_pass("batch glyph runs"sv, &DisplayListOptimizer::batch_glyph_runs);
+
+        if (m_removed_command_count > 0) {
+            AK::SegmentedVector<DisplayList::CommandListItem, 512> optimized_commands;
+            for (size_t i = 0; i < m_commands.size(); ++i) {
+                if (!m_is_removed[i])
+                    optimized_commands.append(move(m_commands[i]));
+            }
+            m_commands = move(optimized_commands);
+        }
+
+        if (m_statistics)
+            m_statistics->command_count_after_optimization = m_commands.size();
+    }
+
+private:
+    void run_pass(StringView name, void (DisplayListOptimizer::*pass)())
+    {
+        if (!m_statistics) {
+            (this->*pass)();
+            return;
+        }
+
+        auto removed_command_count_before_pass = m_removed_command_count;
+        auto start_time = MonotonicTime::now();
+        (this->*pass)();
+        m_statistics->passes.append({
+            .name = name,
+            .removed_command_count = m_removed_command_count - removed_command_count_before_pass,
+            .time_spent = MonotonicTime::now() - start_time,
+        });
+    }
+
+    template<typename Callback>
+    void for_each_command(Callback callback)
+    {
+        for (size_t i = 0; i < m_commands.size(); ++i) {
+            if (!m_is_removed[i])
+                callback(i, m_commands[i]);
+        }
+    }
+
+    void remove(size_t index)
+    {
+        if (m_is_removed[index])
+            return;
+        m_is_removed[index] = true;
+        ++m_removed_command_count;
+    }
+
+    // Removes draws that have an empty bounding rectangle or lie outside of the clip rectangle they're drawn with. The
+    // clip is only tracked while it's in the same coordinate space as the draws, i.e. until the next transform.
+    void cull_draws()
+    {
+        struct Clip {
+            Gfx::IntRect rect;
+            Optional<i32> scroll_frame_id;
+        };
+        Optional<Clip> clip;
+        Vector<Optional<Clip>> saved_clips;
+
+        for_each_command([&](size_t index, DisplayList::CommandListItem const& item) {
+            auto const& command = item.command;
+            if (is_bounded_draw(command)) {
+                auto bounding_rect = bounding_rect_of_draw(command);
+                if (bounding_rect.is_empty() || (clip.has_value() && clip->scroll_frame_id == item.scroll_frame_id && !bounding_rect.intersects(clip->rect)))
+                    remove(index);
+                return;
+            }
+            if (is_draw(command))
+                return;
+
+            if (command.has<AddClipRect>()) {
+                auto const& rect = command.get<AddClipRect>().rect;
+                if (clip.has_value() && clip->scroll_frame_id == item.scroll_frame_id)
+                    clip->rect.intersect(rect);
+                else
+                    clip = Clip { rect, item.scroll_frame_id };
+                return;
+            }
+
+            // These only narrow down what is painted, so the clip we know of still contains it.
+            if (command_is_one_of<AddRoundedRectClip, AddMask, ApplyMaskBitmap, ApplyBackdropFilter>(command))
+                return;
+
+            if (saves_state(command)) {
+                saved_clips.append(clip);
+                // A stacking context may be transformed.
+                if (command.has<PushStackingContext>())
+                    clip = {};
+                return;
+            }
+
+            if (restores_state(command)) {
+                clip = saved_clips.is_empty() ? Optional<Clip> {} : saved_clips.take_last();
+                return;
+            }
+
+            clip = {};
+        });
+    }
+
+    // Removes draws that are fully covered by a later opaque fill, if the painter state doesn't change in between. Only
+    // the most recent draws are considered, see max_occlusion_candidate_count.
+    void remove_occluded_draws()
+    {
+        Vector<size_t> draws_that_can_be_occluded;
+
+        for_each_command([&](size_t index, DisplayList::CommandListItem const& item) {
+            auto const& command = item.command;
+            if (!is_draw(command)) {
+                draws_that_can_be_occluded.clear_with_capacity();
+                return;
+            }
+
+            if (command.has<FillRect>() && command.get<FillRect>().color.alpha() == 255) {
+                auto const& fill_rect = command.get<FillRect>().rect;
+                draws_that_can_be_occluded.remove_all_matching([&](size_t draw_index) {
+                    auto const& draw = m_commands[draw_index];
+                    if (draw.scroll_frame_id != item.scroll_frame_id || !fill_rect.contains(bounding_rect_of_draw(draw.command)))
+                        return false;
+                    remove(draw_index);
+                    return true;
+                });
+            }
+
+            if (can_be_occluded(command)) {
+                if (draws_that_can_be_occluded.size() == max_occlusion_candidate_count)
+                    draws_that_can_be_occluded.remove(0);
+                draws_that_can_be_occluded.append(index);
+            }
+        });
+    }
+
+    // Removes saved states that are restored without anything having been drawn in between, along with the clips and
+    // transforms applied to them.
+    void remove_redundant_state_changes()
+    {
+        struct SavedState {
+            size_t index { 0 };
+            bool can_be_removed { false };
+        };
+        Vector<SavedState> saved_states;
+
+        for_each_command([&](size_t index, DisplayList::CommandListItem const& item) {
+            auto const& command = item.command;
+            if (saves_state(command)) {
+                // Stacking contexts and opacity layers are composited when restored, so we keep them.
+                saved_states.append({ index, command.has<Save>() });
+                return;
+            }
+
+            if (restores_state(command)) {
+                if (saved_states.is_empty())
+                    return;
+                auto saved_state = saved_states.take_last();
+                if (saved_state.can_be_removed && command.has<Restore>()) {
+                    for (size_t i = saved_state.index; i <= index; ++i)
+                        remove(i);
+                } else if (!saved_states.is_empty()) {
+                    saved_states.last().can_be_removed = false;
+                }
+                return;
+            }
+
+            if (is_restorable_state_change(command))
+                return;
+
+            if (!saved_states.is_empty())
+                saved_states.last().can_be_removed = false;
+        });
+    }
+
+    // Merges adjacent fills of the same color whose rectangles add up to a rectangle.
+    void merge_fill_rects()
+    {
+        Optional<size_t> previous_fill_rect_index;
+
+        for_each_command([&](size_t index, DisplayList::CommandListItem const& item) {
+            if (!item.command.has<FillRect>()) {
+                previous_fill_rect_index = {};
+                return;
+            }
+
+            auto const& fill_rect = item.command.get<FillRect>();
+            if (previous_fill_rect_index.has_value()) {
+                auto& previous_item = m_commands[*previous_fill_rect_index];
+                auto& previous_fill_rect = previous_item.command.get<FillRect>();
+                if (previous_item.scroll_frame_id == item.scroll_frame_id
+                    && previous_fill_rect.color == fill_rect.color
+                    && can_merge_fill_rects(previous_fill_rect.rect, fill_rect.rect, fill_rect.color)) {
+                    previous_fill_rect.rect = previous_fill_rect.rect.united(fill_rect.rect);
+                    remove(index);
+                    return;
+                }
+            }
+            previous_fill_rect_index = index;
+        });
+    }
+
+    // Batches adjacent glyph runs with the same font and color into one, so that they're drawn with a single call.
+    void batch_glyph_runs()
+    {
+        Optional<size_t> previous_glyph_run_index;
+        bool previous_glyph_run_is_batched = false;
+
+        for_each_command([&](size_t index, DisplayList::CommandListItem const& item) {
+            if (!item.command.has<DrawGlyphRun>()) {
+                previous_glyph_run_index = {};
+                return;
+            }
+
+            auto const& draw_glyph_run = item.command.get<DrawGlyphRun>();
+            if (previous_glyph_run_index.has_value()) {
+                auto& previous_item = m_commands[*previous_glyph_run_index];
+                auto& previous_draw_glyph_run = previous_item.command.get<DrawGlyphRun>();
+                if (previous_item.scroll_frame_id == item.scroll_frame_id && can_batch_glyph_runs(previous_draw_glyph_run, draw_glyph_run)) {
+                    // NOTE: Glyph runs are shared with the paintables they've been shaped for, so we batch into a copy.
+                    if (!previous_glyph_run_is_batched) {
+                        auto const& glyph_run = *previous_draw_glyph_run.glyph_run;
+                        auto glyphs = glyph_run.glyphs();
+                        previous_draw_glyph_run.glyph_run = adopt_ref(*new Gfx::GlyphRun(move(glyphs), const_cast<Gfx::Font&>(glyph_run.font()), glyph_run.text_type(), glyph_run.width()));
+                        previous_glyph_run_is_batched = true;
+                    }
+
+                    // The glyph positions are relative to the translation of their run, in unscaled units.
+                    auto offset = (draw_glyph_run.translation - previous_draw_glyph_run.translation).scaled(static_cast<float>(1 / draw_glyph_run.scale));
+                    auto& batched_glyph_run = *previous_draw_glyph_run.glyph_run;
+                    for (auto glyph : draw_glyph_run.glyph_run->glyphs()) {
+                        glyph.translate_by(offset);
+                        batched_glyph_run.append(glyph);
+                    }
+                    previous_draw_glyph_run.rect = previous_draw_glyph_run.rect.united(draw_glyph_run.rect);
+                    remove(index);
+                    return;
+                }
+            }
+            previous_glyph_run_index = index;
+            previous_glyph_run_is_batched = false;
+        });
+    }
+
+    AK::SegmentedVector<DisplayList::CommandListItem, 512>& m_commands;
+    Vector<bool> m_is_removed;
+    size_t m_removed_command_count { 0 };
+    DisplayListOptimizationStatistics* m_statistics { nullptr };
+};
+
+void optimize_display_list(DisplayList& display_list, DisplayListOptimizationStatistics* statistics)
+{
+    Core::PerformanceTraceSpan trace_span("rendering"sv, "optimize"sv);
+
+    DisplayListOptimizer(display_list, statistics).optimize();
+}
+
+String DisplayListOptimizationStatistics::to_string() const
+{
+    StringBuilder builder;
+    builder.appendff("{} -> {} commands", command_count_before_optimization, command_count_after_optimization);
+    for (auto const& pass : passes)
+        builder.appendff(", {}: -{} in {}us", pass.name, pass.removed_command_count, pass.time_spent.to_microseconds());
+    return MUST(builder.to_string());
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Format.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+namespace Web::Painting {
+
+struct DisplayListOptimizationStatistics {
+    struct Pass {
+        StringView name;
+        size_t removed_command_count { 0 };
+        AK::Duration time_spent;
+    };
+
+    size_t command_count_before_optimization { 0 };
+    size_t command_count_after_optimization { 0 };
+    Vector<Pass> passes;
+
+    String to_string() const;
+};
+
+// Removes the commands of a recorded display list that don't change what it paints, and merges commands that can be
+// painted as one. This only relies on what is known when recording, since the same display list is played again with
+// different scroll offsets and composited properties. Statistics about the passes are only gathered if asked for, as
+// timing them isn't free.
+void optimize_display_list(DisplayList&, DisplayListOptimizationStatistics* = nullptr);
+
+}
+
+template<>
+struct AK::Formatter<Web::Painting::DisplayListOptimizationStatistics> : Formatter<StringView> {
+    ErrorOr<void> format(FormatBuilder& builder, Web::Painting::DisplayListOptimizationStatistics const& statistics)
+    {
+        return Formatter<StringView>::format(builder, statistics.to_string());
+    }
+};
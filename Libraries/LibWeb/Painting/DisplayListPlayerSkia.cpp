@@ -341,6 +341,19 @@ void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitm
     canvas.drawImageRect(command.bitmap->sk_image(), src_rect, dst_rect, to_skia_sampling_options(command.scaling_mode), &paint, SkCanvas::kStrict_SrcRectConstraint);
 }
 
+void DisplayListPlayerSkia::draw_video_frame(DrawVideoFrame const& command)
+{
+    auto const& frame = command.frame_pool->presented_surface();
+    if (!frame)
+        return;
+
+    auto src_rect = to_skia_rect(command.src_rect);
+    auto dst_rect = to_skia_rect(command.dst_rect);
+    auto& canvas = surface().canvas();
+    SkPaint paint;
+    canvas.drawImageRect(frame->immutable_bitmap().sk_image(), src_rect, dst_rect, to_skia_sampling_options(command.scaling_mode), &paint, SkCanvas::kStrict_SrcRectConstraint);
+}
+
 void DisplayListPlayerSkia::draw_repeated_immutable_bitmap(DrawRepeatedImmutableBitmap const& command)
 {
     SkMatrix matrix;
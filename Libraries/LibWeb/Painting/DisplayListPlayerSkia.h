@@ -34,6 +34,7 @@ private:
     void fill_rect(FillRect const&) override;
     void draw_painting_surface(DrawPaintingSurface const&) override;
     void draw_scaled_immutable_bitmap(DrawScaledImmutableBitmap const&) override;
+    void draw_video_frame(DrawVideoFrame const&) override;
     void draw_repeated_immutable_bitmap(DrawRepeatedImmutableBitmap const&) override;
     void add_clip_rect(AddClipRect const&) override;
     void save(Save const&) override;
@@ -29,6 +29,11 @@ void DisplayListRecorder::paint_nested_display_list(RefPtr<DisplayList> display_
     append(PaintNestedDisplayList { move(display_list), rect });
 }
 
+void DisplayListRecorder::paint_cached_display_list(NonnullRefPtr<DisplayList> display_list)
+{
+    append(PaintCachedDisplayList { move(display_list) });
+}
+
 void DisplayListRecorder::add_rounded_rect_clip(CornerRadii corner_radii, Gfx::IntRect border_rect, CornerClip corner_clip)
 {
     append(AddRoundedRectClip { corner_radii, border_rect, corner_clip });
@@ -192,6 +197,18 @@ void DisplayListRecorder::draw_scaled_immutable_bitmap(Gfx::IntRect const& dst_r
     });
 }
 
+void DisplayListRecorder::draw_video_frame(Gfx::IntRect const& dst_rect, Media::VideoFramePool& frame_pool, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode)
+{
+    if (dst_rect.is_empty())
+        return;
+    append(DrawVideoFrame {
+        .dst_rect = dst_rect,
+        .frame_pool = frame_pool,
+        .src_rect = src_rect,
+        .scaling_mode = scaling_mode,
+    });
+}
+
 void DisplayListRecorder::draw_repeated_immutable_bitmap(Gfx::IntRect dst_rect, Gfx::IntRect clip_rect, NonnullRefPtr<Gfx::ImmutableBitmap> bitmap, Gfx::ScalingMode scaling_mode, DrawRepeatedImmutableBitmap::Repeat repeat)
 {
     append(DrawRepeatedImmutableBitmap {
@@ -281,6 +298,13 @@ void DisplayListRecorder::pop_scroll_frame_id()
     (void)m_scroll_frame_id_stack.take_last();
 }
 
+Optional<i32> DisplayListRecorder::current_scroll_frame_id() const
+{
+    if (m_scroll_frame_id_stack.is_empty())
+        return {};
+    return m_scroll_frame_id_stack.last();
+}
+
 void DisplayListRecorder::push_stacking_context(PushStackingContextParams params)
 {
     append(PushStackingContext {
@@ -291,7 +315,8 @@ void DisplayListRecorder::push_stacking_context(PushStackingContextParams params
             .origin = params.transform.origin,
             .matrix = params.transform.matrix,
         },
-        .clip_path = params.clip_path });
+        .clip_path = params.clip_path,
+        .composited_properties = params.composited_properties });
     m_scroll_frame_id_stack.append({});
 }
 
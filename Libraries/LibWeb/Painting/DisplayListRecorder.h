@@ -89,6 +89,7 @@ public:
 
     void draw_painting_surface(Gfx::IntRect const& dst_rect, NonnullRefPtr<Gfx::PaintingSurface>, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode = Gfx::ScalingMode::NearestNeighbor);
     void draw_scaled_immutable_bitmap(Gfx::IntRect const& dst_rect, Gfx::ImmutableBitmap const& bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode = Gfx::ScalingMode::NearestNeighbor);
+    void draw_video_frame(Gfx::IntRect const& dst_rect, Media::VideoFramePool&, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode = Gfx::ScalingMode::NearestNeighbor);
 
     void draw_repeated_immutable_bitmap(Gfx::IntRect dst_rect, Gfx::IntRect clip_rect, NonnullRefPtr<Gfx::ImmutableBitmap> bitmap, Gfx::ScalingMode scaling_mode, DrawRepeatedImmutableBitmap::Repeat);
 
@@ -105,6 +106,7 @@ public:
 
     void push_scroll_frame_id(Optional<i32> id);
     void pop_scroll_frame_id();
+    Optional<i32> current_scroll_frame_id() const;
 
     void save();
     void restore();
@@ -116,11 +118,13 @@ public:
         Gfx::IntRect source_paintable_rect;
         StackingContextTransform transform;
         Optional<Gfx::Path> clip_path = {};
+        RefPtr<CompositedProperties const> composited_properties = {};
     };
     void push_stacking_context(PushStackingContextParams params);
     void pop_stacking_context();
 
     void paint_nested_display_list(RefPtr<DisplayList> display_list, Gfx::IntRect rect);
+    void paint_cached_display_list(NonnullRefPtr<DisplayList> display_list);
 
     void add_rounded_rect_clip(CornerRadii corner_radii, Gfx::IntRect border_rect, CornerClip corner_clip);
     void add_mask(RefPtr<DisplayList> display_list, Gfx::IntRect rect);
@@ -147,11 +147,52 @@ StackingContext* Paintable::enclosing_stacking_context()
     VERIFY_NOT_REACHED();
 }
 
+static StackingContext* find_inclusive_enclosing_stacking_context(Paintable& paintable)
+{
+    for (auto* ancestor = &paintable; ancestor; ancestor = ancestor->parent()) {
+        if (!ancestor->is_paintable_box())
+            continue;
+        if (auto* stacking_context = static_cast<PaintableBox&>(*ancestor).stacking_context())
+            return stacking_context;
+    }
+    return nullptr;
+}
+
+void Paintable::invalidate_display_list()
+{
+    auto& document = const_cast<DOM::Document&>(this->document());
+
+    // NOTE: The viewport records the canvas, which the backgrounds of the root element and the body propagate to, and
+    //       SVG elements may be referenced as masks and clip paths by other elements. In these cases, or if the
+    //       stacking contexts of this paintable haven't been built, we have to invalidate the whole display list.
+    auto const* viewport = document.paintable();
+    auto needs_full_invalidation = !viewport
+        || !viewport->stacking_context()
+        || layout_node().is_viewport()
+        || layout_node().is_svg_box()
+        || layout_node().is_svg_svg_box()
+        || (dom_node() && (dom_node()->is_html_html_element() || dom_node()->is_html_body_element()));
+    if (needs_full_invalidation) {
+        document.invalidate_display_list();
+        return;
+    }
+
+    // NOTE: An inline node has a paintable for each of its lines, which may not all belong to the same stacking context.
+    for (auto const& paintable : layout_node().paintables()) {
+        auto* stacking_context = find_inclusive_enclosing_stacking_context(const_cast<Paintable&>(paintable));
+        if (!stacking_context) {
+            document.invalidate_display_list();
+            return;
+        }
+        document.invalidate_display_list(*stacking_context);
+    }
+}
+
 void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
     auto& document = const_cast<DOM::Document&>(this->document());
     if (should_invalidate_display_list == InvalidateDisplayList::Yes)
-        document.invalidate_display_list();
+        invalidate_display_list();
 
     auto* containing_block = this->containing_block();
     if (!containing_block)
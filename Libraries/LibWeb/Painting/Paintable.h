@@ -198,6 +198,10 @@ public:
 
     virtual void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
 
+    // Invalidates the display lists of the stacking contexts that this paintable has been recorded into, while the
+    // display lists of other stacking contexts stay valid.
+    void invalidate_display_list();
+
     PaintableBox* containing_block() const;
 
     template<typename T>
@@ -1015,7 +1015,9 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
 
 void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        invalidate_display_list();
+    document().set_needs_display(absolute_rect(), InvalidateDisplayList::No);
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
@@ -1094,6 +1096,18 @@ CSSPixelRect PaintableBox::transform_box_rect() const
     VERIFY_NOT_REACHED();
 }
 
+void PaintableBox::resolve_transform()
+{
+    auto const& transformations = computed_values().transformations();
+    if (transformations.is_empty())
+        return;
+
+    auto matrix = Gfx::FloatMatrix4x4::identity();
+    for (auto const& transform : transformations)
+        matrix = matrix * transform.to_matrix(*this).release_value();
+    set_transform(matrix);
+}
+
 void PaintableBox::resolve_paint_properties()
 {
     auto const& computed_values = this->computed_values();
@@ -1127,13 +1141,7 @@ void PaintableBox::resolve_paint_properties()
     }
     set_box_shadow_data(move(resolved_box_shadow_data));
 
-    auto const& transformations = computed_values.transformations();
-    if (!transformations.is_empty()) {
-        auto matrix = Gfx::FloatMatrix4x4::identity();
-        for (auto const& transform : transformations)
-            matrix = matrix * transform.to_matrix(*this).release_value();
-        set_transform(matrix);
-    }
+    resolve_transform();
 
     auto const& transform_origin = computed_values.transform_origin();
     auto reference_box = transform_box_rect();
@@ -226,6 +226,9 @@ public:
     CSSPixelRect transform_box_rect() const;
     virtual void resolve_paint_properties() override;
 
+    // Resolves only the transform matrix, for when the transform is the only property that changed.
+    void resolve_transform();
+
     RefPtr<ScrollFrame const> nearest_scroll_frame() const;
 
     CSSPixelRect border_box_rect_relative_to_nearest_scrollable_ancestor() const;
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <AK/QuickSort.h>
 #include <LibGfx/AffineTransform.h>
 #include <LibGfx/Matrix4x4.h>
@@ -14,6 +15,7 @@
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/Viewport.h>
+#include <LibWeb/Painting/DisplayListOptimizer.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/SVGSVGPaintable.h>
 #include <LibWeb/Painting/StackingContext.h>
@@ -32,6 +34,7 @@ StackingContext::StackingContext(PaintableBox& paintable, StackingContext* paren
     : m_paintable(paintable)
     , m_parent(parent)
     , m_index_in_tree_order(index_in_tree_order)
+    , m_composited_properties(CompositedProperties::create())
 {
     VERIFY(m_parent != this);
     if (m_parent)
@@ -285,7 +288,87 @@ static Gfx::FloatMatrix4x4 matrix_with_scaled_translation(Gfx::FloatMatrix4x4 ma
     return matrix;
 }
 
+void StackingContext::update_composited_properties(double device_pixels_per_css_pixel) const
+{
+    auto to_device_pixels_scale = float(device_pixels_per_css_pixel);
+
+    m_composited_properties->opacity = paintable_box().computed_values().opacity();
+    m_composited_properties->transform = {
+        .origin = paintable_box().transform_origin().to_type<float>().scaled(to_device_pixels_scale),
+        .matrix = matrix_with_scaled_translation(paintable_box().transform(), to_device_pixels_scale),
+    };
+}
+
 void StackingContext::paint(PaintContext& context) const
+{
+    // NOTE: The SVG transform and clip path state of the context is not carried over into a display list of our own,
+    //       so we can only record into one when painting outside of SVG.
+    if (!context.svg_transform().is_identity() || context.draw_svg_geometry_for_clip_path()) {
+        m_display_list = nullptr;
+        record(context);
+        return;
+    }
+
+    auto scroll_frame_id = context.display_list_recorder().current_scroll_frame_id();
+    if (!m_display_list || !m_display_list_is_valid || m_display_list_scroll_frame_id != scroll_frame_id)
+        record_display_list(context, scroll_frame_id);
+    context.display_list_recorder().paint_cached_display_list(*m_display_list);
+}
+
+void StackingContext::record_display_list(PaintContext& context, Optional<i32> scroll_frame_id) const
+{
+    // NOTE: Display lists are played as soon as they have been recorded, so the one of this stacking context can be
+    //       cleared and recorded again while the display lists of other stacking contexts keep referring to it.
+    if (m_display_list)
+        m_display_list->clear();
+    else
+        m_display_list = DisplayList::create();
+
+    DisplayListRecorder display_list_recorder(*m_display_list);
+    display_list_recorder.push_scroll_frame_id(scroll_frame_id);
+    auto stacking_context_context = context.clone(display_list_recorder);
+    record(stacking_context_context);
+    display_list_recorder.pop_scroll_frame_id();
+
+    if constexpr (LIBWEB_DISPLAY_LIST_DEBUG) {
+        DisplayListOptimizationStatistics optimization_statistics;
+        optimize_display_list(*m_display_list, &optimization_statistics);
+        dbgln("Optimized display list of {}: {}", paintable_box().layout_node().debug_description(), optimization_statistics);
+    } else {
+        optimize_display_list(*m_display_list);
+    }
+
+    m_display_list_scroll_frame_id = scroll_frame_id;
+    m_display_list_is_valid = true;
+}
+
+void StackingContext::record_invalidated_display_lists(PaintContext& context) const
+{
+    // NOTE: Recording a stacking context also records the invalidated display lists of its descendants.
+    if (m_display_list && !m_display_list_is_valid) {
+        record_display_list(context, m_display_list_scroll_frame_id);
+        return;
+    }
+
+    for (auto const* child : m_children)
+        child->record_invalidated_display_lists(context);
+}
+
+void StackingContext::invalidate_display_list()
+{
+    m_display_list_is_valid = false;
+    if (!m_display_list && m_parent)
+        m_parent->invalidate_display_list();
+}
+
+void StackingContext::invalidate_display_lists_of_subtree()
+{
+    m_display_list_is_valid = false;
+    for (auto* child : m_children)
+        child->invalidate_display_lists_of_subtree();
+}
+
+void StackingContext::record(PaintContext& context) const
 {
     auto opacity = paintable_box().computed_values().opacity();
     if (opacity == 0.0f)
@@ -293,21 +376,17 @@ void StackingContext::paint(PaintContext& context) const
 
     DisplayListRecorderStateSaver saver(context.display_list_recorder());
 
-    auto to_device_pixels_scale = float(context.device_pixels_per_css_pixel());
     auto source_paintable_rect = context.enclosing_device_rect(paintable_box().absolute_paint_rect()).to_type<int>();
 
-    auto transform_matrix = paintable_box().transform();
-    auto transform_origin = paintable_box().transform_origin().to_type<float>();
+    update_composited_properties(context.device_pixels_per_css_pixel());
 
     DisplayListRecorder::PushStackingContextParams push_stacking_context_params {
-        .opacity = opacity,
+        .opacity = m_composited_properties->opacity,
         .filter = paintable_box().computed_values().filter(),
         .is_fixed_position = paintable_box().is_fixed_position(),
         .source_paintable_rect = source_paintable_rect,
-        .transform = {
-            .origin = transform_origin.scaled(to_device_pixels_scale),
-            .matrix = matrix_with_scaled_translation(transform_matrix, to_device_pixels_scale),
-        },
+        .transform = m_composited_properties->transform,
+        .composited_properties = m_composited_properties,
     };
 
     auto const& computed_values = paintable_box().computed_values();
@@ -338,17 +417,20 @@ void StackingContext::paint(PaintContext& context) const
         context.display_list_recorder().add_mask(mask_display_list, mask_rect_in_device_pixels.to_type<int>());
     }
 
-    if (auto masking_area = paintable_box().get_masking_area(); masking_area.has_value()) {
-        if (masking_area->is_empty())
-            return;
-        auto mask_bitmap = paintable_box().calculate_mask(context, *masking_area);
-        if (mask_bitmap) {
-            auto masking_area_rect = context.enclosing_device_rect(*masking_area).to_type<int>();
-            context.display_list_recorder().apply_mask_bitmap(masking_area_rect.location(), mask_bitmap.release_nonnull(), *paintable_box().get_mask_type());
+    // NOTE: Nothing is painted into an empty masking area, but the state changes above still have to be undone, so that
+    //       the display list of this stacking context can be played as a whole.
+    auto masking_area = paintable_box().get_masking_area();
+    if (!masking_area.has_value() || !masking_area->is_empty()) {
+        if (masking_area.has_value()) {
+            auto mask_bitmap = paintable_box().calculate_mask(context, *masking_area);
+            if (mask_bitmap) {
+                auto masking_area_rect = context.enclosing_device_rect(*masking_area).to_type<int>();
+                context.display_list_recorder().apply_mask_bitmap(masking_area_rect.location(), mask_bitmap.release_nonnull(), *paintable_box().get_mask_type());
+            }
         }
+        paint_internal(context);
     }
 
-    paint_internal(context);
     context.display_list_recorder().pop_stacking_context();
     if (paintable_box().scroll_frame_id().has_value()) {
         context.display_list_recorder().pop_scroll_frame_id();
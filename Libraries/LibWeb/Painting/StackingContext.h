@@ -8,6 +8,8 @@
 
 #include <AK/Vector.h>
 #include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Painting/Command.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/Paintable.h>
 
 namespace Web::Painting {
@@ -40,6 +42,19 @@ public:
 
     Gfx::AffineTransform affine_transform_matrix() const;
 
+    // Updates the opacity and transform used by display lists that this stacking context has been recorded into, from
+    // the current values of its paintable box.
+    void update_composited_properties(double device_pixels_per_css_pixel) const;
+
+    // Marks the display list of this stacking context as needing to be recorded again. A stacking context that has been
+    // recorded directly into the display list of its parent has to be recorded again along with it.
+    void invalidate_display_list();
+    void invalidate_display_lists_of_subtree();
+
+    // Records the invalidated display lists of this stacking context and its descendants again. This happens in place,
+    // so that the display lists referring to them don't have to be recorded again.
+    void record_invalidated_display_lists(PaintContext&) const;
+
     void dump(int indent = 0) const;
 
     void sort();
@@ -52,12 +67,19 @@ private:
     Vector<StackingContext*> m_children;
     size_t m_index_in_tree_order { 0 };
     Optional<u64> m_last_paint_generation_id;
+    NonnullRefPtr<CompositedProperties> m_composited_properties;
+
+    mutable RefPtr<DisplayList> m_display_list;
+    mutable Optional<i32> m_display_list_scroll_frame_id;
+    mutable bool m_display_list_is_valid { false };
 
     Vector<GC::Ref<PaintableBox const>> m_positioned_descendants_and_stacking_contexts_with_stack_level_0;
     Vector<GC::Ref<PaintableBox const>> m_non_positioned_floating_descendants;
 
     static void paint_child(PaintContext&, StackingContext const&);
     void paint_internal(PaintContext&) const;
+    void record(PaintContext&) const;
+    void record_display_list(PaintContext&, Optional<i32> scroll_frame_id) const;
 };
 
 }
@@ -48,8 +48,16 @@ Layout::VideoBox const& VideoPaintable::layout_box() const
     return static_cast<Layout::VideoBox const&>(layout_node());
 }
 
+bool VideoPaintable::can_present_frame_without_recording(Media::VideoFramePool const& frame_pool, Gfx::IntSize frame_size) const
+{
+    return m_recorded_frame_pool.ptr() == &frame_pool && m_recorded_frame_size == frame_size;
+}
+
 void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
 {
+    if (phase == PaintPhase::Foreground)
+        m_recorded_frame_pool = nullptr;
+
     if (!is_visible())
         return;
 
@@ -128,7 +136,13 @@ void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
         representation = Representation::CurrentVideoFrame;
     }
 
-    auto paint_frame = [&](auto const& frame) {
+    auto paint_video_frame = [&](auto const& frame) {
+        auto frame_rect = frame.frame->bitmap().rect();
+        auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(), frame_rect, video_rect.to_type<int>());
+        context.display_list_recorder().draw_video_frame(video_rect.to_type<int>(), *frame.frame_pool, frame_rect, scaling_mode);
+    };
+
+    auto paint_poster_frame = [&](auto const& frame) {
         auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(), frame->rect(), video_rect.to_type<int>());
         context.display_list_recorder().draw_scaled_immutable_bitmap(video_rect.to_type<int>(), Gfx::ImmutableBitmap::create(*frame), frame->rect(), scaling_mode);
     };
@@ -142,8 +156,11 @@ void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
         auto is_hovered = document().hovered_node() == &video_element;
         auto is_paused = video_element.paused();
 
-        if (is_hovered || is_paused)
-            paint_media_controls(context, video_element, video_rect, mouse_position);
+        if (!is_hovered && !is_paused)
+            return false;
+
+        paint_media_controls(context, video_element, video_rect, mouse_position);
+        return true;
     };
 
     auto paint_user_agent_controls = video_element.has_attribute(HTML::AttributeNames::controls) || video_element.is_scripting_disabled();
@@ -155,14 +172,20 @@ void VideoPaintable::paint(PaintContext& context, PaintPhase phase) const
         // FIXME: We likely need to cache all (or a subset of) decoded video frames along with their position. We at least
         //        will need the first video frame and the last-rendered video frame.
         if (current_frame.frame)
-            paint_frame(current_frame.frame);
-        if (paint_user_agent_controls)
-            paint_loaded_video_controls();
+            paint_video_frame(current_frame);
+
+        // The controls show the playback position, so they have to be recorded again for every frame.
+        if (paint_user_agent_controls && paint_loaded_video_controls())
+            break;
+        if (current_frame.frame) {
+            m_recorded_frame_pool = current_frame.frame_pool;
+            m_recorded_frame_size = current_frame.frame->size();
+        }
         break;
 
     case Representation::PosterFrame:
         VERIFY(poster_frame);
-        paint_frame(poster_frame);
+        paint_poster_frame(poster_frame);
         if (paint_user_agent_controls)
             paint_placeholder_video_controls(context, video_rect, mouse_position);
         break;
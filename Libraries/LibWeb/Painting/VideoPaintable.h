@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibMedia/VideoFramePool.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Painting/MediaPaintable.h>
 
@@ -23,10 +24,17 @@ public:
     Layout::VideoBox& layout_box();
     Layout::VideoBox const& layout_box() const;
 
+    // Returns whether the last recorded display list draws the presented frame of the given pool, and nothing else that
+    // changes from one frame to the next, such that a new frame of the given size shows up by playing it again.
+    bool can_present_frame_without_recording(Media::VideoFramePool const&, Gfx::IntSize frame_size) const;
+
 private:
     VideoPaintable(Layout::VideoBox const&);
 
     void paint_placeholder_video_controls(PaintContext&, DevicePixelRect video_rect, Optional<DevicePixelPoint> const& mouse_position) const;
+
+    mutable RefPtr<Media::VideoFramePool> m_recorded_frame_pool;
+    mutable Gfx::IntSize m_recorded_frame_size;
 };
 
 }
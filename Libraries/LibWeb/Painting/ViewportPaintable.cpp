@@ -63,6 +63,9 @@ void ViewportPaintable::build_stacking_context_tree()
 void ViewportPaintable::paint_all_phases(PaintContext& context)
 {
     build_stacking_context_tree_if_needed();
+    // NOTE: Stacking contexts whose display lists are referenced from valid display lists aren't reached when painting
+    //       the root stacking context, so their invalidated display lists have to be recorded again beforehand.
+    stacking_context()->record_invalidated_display_lists(context);
     stacking_context()->paint(context);
 }
 
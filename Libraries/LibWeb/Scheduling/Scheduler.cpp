@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/Platform/Timer.h>
+#include <LibWeb/Scheduling/Scheduler.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Scheduling {
+
+GC_DEFINE_ALLOCATOR(Scheduler);
+
+static HTML::Task::Priority task_priority_from_bindings(Bindings::TaskPriority priority)
+{
+    switch (priority) {
+    case Bindings::TaskPriority::UserBlocking:
+        return HTML::Task::Priority::UserBlocking;
+    case Bindings::TaskPriority::UserVisible:
+        return HTML::Task::Priority::UserVisible;
+    case Bindings::TaskPriority::Background:
+        return HTML::Task::Priority::Background;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+GC::Ref<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.create<Scheduler>(realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+}
+
+void Scheduler::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto& timer : m_delay_timers)
+        visitor.visit(timer);
+}
+
+// https://wicg.github.io/scheduling-apis/#queue-a-scheduler-task
+GC::Ref<HTML::Task> Scheduler::queue_a_scheduler_task(HTML::Task::Priority priority, bool is_continuation, GC::Ref<GC::Function<void()>> steps)
+{
+    auto& global = HTML::relevant_global_object(*this);
+
+    DOM::Document* document = nullptr;
+    if (is<HTML::Window>(global))
+        document = &verify_cast<HTML::Window>(global).associated_document();
+
+    auto task = HTML::Task::create(vm(), HTML::Task::Source::PostedTask, document, steps);
+    task->set_priority(priority);
+    task->set_is_continuation(is_continuation);
+
+    HTML::relevant_settings_object(*this).responsible_event_loop().task_queue().add(task);
+    return task;
+}
+
+void Scheduler::remove_task_when_aborted(DOM::AbortSignal& signal, HTML::Task const& task)
+{
+    signal.add_abort_algorithm([this, task_id = task.id()] {
+        HTML::relevant_settings_object(*this).responsible_event_loop().task_queue().remove_tasks_matching([&](auto const& queued_task) {
+            return queued_task.id() == task_id;
+        });
+    });
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+GC::Ref<WebIDL::Promise> Scheduler::post_task(GC::Ref<WebIDL::CallbackType> callback, SchedulerPostTaskOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if options["signal"] exists, or otherwise null.
+    auto signal = options.signal;
+
+    // 3. If signal is not null and it is aborted, then reject result with signal's abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return result;
+    }
+
+    // 4. Let priority be options["priority"] if options["priority"] exists, or "user-visible" otherwise.
+    // FIXME: Take the priority from signal if it is a TaskSignal.
+    auto priority = task_priority_from_bindings(options.priority.value_or(Bindings::TaskPriority::UserVisible));
+
+    // 5. Let task steps be the following steps:
+    auto steps = GC::create_function(heap(), [this, &realm, callback, result, priority] {
+        // 1. Set the scheduler's current priority, so that continuations queued by the callback inherit it.
+        auto previous_priority = m_current_task_priority;
+        m_current_task_priority = priority;
+
+        // 2. Let callbackResult be the result of invoking callback.
+        auto completion = WebIDL::invoke_callback(*callback, {});
+
+        m_current_task_priority = previous_priority;
+
+        // 3. If that threw an exception, then reject result with that. Otherwise, resolve result with callbackResult.
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        if (completion.is_abrupt())
+            WebIDL::reject_promise(realm, result, completion.release_value().value());
+        else
+            WebIDL::resolve_promise(realm, result, completion.release_value().value_or(JS::js_undefined()));
+    });
+
+    // 6. If options["delay"] is greater than 0, then queue the task once that many milliseconds have passed.
+    //    Otherwise, queue it right away.
+    if (options.delay > 0) {
+        auto delay = static_cast<int>(min(options.delay, static_cast<WebIDL::UnsignedLongLong>(NumericLimits<int>::max())));
+
+        auto timer = Platform::Timer::create_single_shot(heap(), delay, {});
+        timer->on_timeout = GC::create_function(heap(), [this, timer, priority, steps, signal] {
+            m_delay_timers.remove(timer);
+
+            // The task may have been aborted while we were waiting.
+            if (signal && signal->aborted())
+                return;
+
+            auto task = queue_a_scheduler_task(priority, false, steps);
+            if (signal)
+                remove_task_when_aborted(*signal, task);
+        });
+
+        m_delay_timers.set(timer);
+        timer->start();
+    } else {
+        auto task = queue_a_scheduler_task(priority, false, steps);
+        if (signal)
+            remove_task_when_aborted(*signal, task);
+    }
+
+    // 7. If signal is not null, then add the following abort steps to it: reject result with signal's abort reason.
+    //    NOTE: If the task has already run, result is settled already and this does nothing.
+    if (signal) {
+        signal->add_abort_algorithm([&realm, result, signal] {
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+            WebIDL::reject_promise(realm, result, signal->reason());
+        });
+    }
+
+    // 8. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-yield
+GC::Ref<WebIDL::Promise> Scheduler::yield()
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Queue a continuation with the priority of the posted task we are being called from, if any, that resolves
+    //    result. Continuations run before other tasks of the same priority, so that yielding does not send the
+    //    caller to the back of the line.
+    auto priority = m_current_task_priority.value_or(HTML::Task::Priority::UserVisible);
+    queue_a_scheduler_task(priority, true, GC::create_function(heap(), [&realm, result] {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        WebIDL::resolve_promise(realm, result, JS::js_undefined());
+    }));
+
+    // 3. Return result.
+    return result;
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::Scheduling {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-schedulerposttaskoptions
+struct SchedulerPostTaskOptions {
+    GC::Ptr<DOM::AbortSignal> signal;
+    Optional<Bindings::TaskPriority> priority;
+    WebIDL::UnsignedLongLong delay { 0 };
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler
+// Posted tasks are queued on the event loop's task queue with the matching HTML::Task::Priority, so they are
+// scheduled together with (and relative to) every other task.
+// FIXME: Implement TaskController and TaskSignal, to allow changing the priority of a task after it was posted.
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static GC::Ref<Scheduler> create(JS::Realm&);
+    virtual ~Scheduler() override;
+
+    GC::Ref<WebIDL::Promise> post_task(GC::Ref<WebIDL::CallbackType>, SchedulerPostTaskOptions const&);
+    GC::Ref<WebIDL::Promise> yield();
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    GC::Ref<HTML::Task> queue_a_scheduler_task(HTML::Task::Priority, bool is_continuation, GC::Ref<GC::Function<void()>> steps);
+    void remove_task_when_aborted(DOM::AbortSignal&, HTML::Task const&);
+
+    // The priority of the posted task that is currently running, which yield() continuations inherit.
+    Optional<HTML::Task::Priority> m_current_task_priority;
+
+    HashTable<GC::Ref<Platform::Timer>> m_delay_timers;
+};
+
+}
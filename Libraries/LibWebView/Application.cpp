@@ -80,6 +80,7 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    size_t web_content_process_pool_size = 0;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("The Ladybird web browser :^)");
@@ -100,6 +101,7 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
+    args_parser.add_option(web_content_process_pool_size, "Number of idle WebContent processes to keep ready for new tabs", "web-content-process-pool-size", 0, "count");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation", 'g');
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
@@ -140,6 +142,7 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
         .disable_sql_database = disable_sql_database ? DisableSQLDatabase::Yes : DisableSQLDatabase::No,
         .debug_helper_process = move(debug_process_type),
         .profile_helper_process = move(profile_process_type),
+        .web_content_process_pool_size = web_content_process_pool_size,
     };
 
     if (webdriver_content_ipc_path.has_value())
@@ -167,12 +170,22 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     } else {
         m_cookie_jar = CookieJar::create();
     }
+
+    // WebContent processes cache cookie-strings, so let them know when those may have become stale.
+    m_cookie_jar->on_cookies_changed = [](Optional<String> const& domain) {
+        WebContentClient::for_each_client([&](WebContentClient& client) {
+            client.async_cookies_changed(domain);
+            return IterationDecision::Continue;
+        });
+    };
 }
 
 ErrorOr<void> Application::launch_services()
 {
     TRY(launch_request_server());
     TRY(launch_image_decoder_server());
+
+    m_web_content_process_pool.set_size(m_chrome_options.web_content_process_pool_size);
     return {};
 }
 
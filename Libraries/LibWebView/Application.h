@@ -20,6 +20,7 @@
 #include <LibWebView/Options.h>
 #include <LibWebView/Process.h>
 #include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebContentProcessPool.h>
 
 namespace WebView {
 
@@ -41,6 +42,8 @@ public:
 
     static CookieJar& cookie_jar() { return *the().m_cookie_jar; }
 
+    static WebContentProcessPool& web_content_process_pool() { return the().m_web_content_process_pool; }
+
     Core::EventLoop& event_loop() { return m_event_loop; }
 
     ErrorOr<void> launch_services();
@@ -99,6 +102,7 @@ private:
 
     Core::EventLoop m_event_loop;
     ProcessManager m_process_manager;
+    WebContentProcessPool m_web_content_process_pool;
     bool m_in_shutdown { false };
 } SWIFT_IMMORTAL_REFERENCE;
 
@@ -87,20 +87,23 @@ CookieJar::~CookieJar()
 }
 
 // https://www.ietf.org/archive/id/draft-ietf-httpbis-rfc6265bis-15.html#section-5.8.3
-String CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
+CookieJar::CookieString CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
 {
     m_transient_storage.purge_expired_cookies();
 
     auto domain = canonicalize_domain(url);
     if (!domain.has_value())
-        return {};
+        return { {}, UnixDateTime::latest() };
 
     auto cookie_list = get_matching_cookies(url, domain.value(), source);
+    auto valid_until = UnixDateTime::latest();
 
     // 4. Serialize the cookie-list into a cookie-string by processing each cookie in the cookie-list in order:
     StringBuilder builder;
 
     for (auto const& cookie : cookie_list) {
+        valid_until = min(valid_until, cookie.expiry_time);
+
         if (!builder.is_empty())
             builder.append("; "sv);
 
@@ -115,7 +118,7 @@ String CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
         // 3. If there is an unprocessed cookie in the cookie-list, output the characters %x3B and %x20 ("; ").
     }
 
-    return MUST(builder.to_string());
+    return { MUST(builder.to_string()), valid_until };
 }
 
 void CookieJar::set_cookie(const URL::URL& url, Web::Cookie::ParsedCookie const& parsed_cookie, Web::Cookie::Source source)
@@ -143,9 +146,13 @@ void CookieJar::update_cookie(Web::Cookie::Cookie cookie)
     }
 
     // 24. Insert the newly-created cookie into the cookie store.
+    auto domain = cookie.domain;
     m_transient_storage.set_cookie(move(key), move(cookie));
 
     m_transient_storage.purge_expired_cookies();
+
+    if (on_cookies_changed)
+        on_cookies_changed(domain);
 }
 
 void CookieJar::dump_cookies()
@@ -216,6 +223,10 @@ Optional<Web::Cookie::Cookie> CookieJar::get_named_cookie(URL::URL const& url, S
 void CookieJar::expire_cookies_with_time_offset(AK::Duration offset)
 {
     m_transient_storage.purge_expired_cookies(offset);
+
+    // Cookie-strings handed out so far only account for the passing of real time, so they may all be stale now.
+    if (on_cookies_changed)
+        on_cookies_changed({});
 }
 
 // https://www.ietf.org/archive/id/draft-ietf-httpbis-rfc6265bis-15.html#section-5.1.2
@@ -523,9 +534,13 @@ void CookieJar::store_cookie(Web::Cookie::ParsedCookie const& parsed_cookie, con
     }
 
     // 24. Insert the newly-created cookie into the cookie store.
+    auto domain = cookie.domain;
     m_transient_storage.set_cookie(move(key), move(cookie));
 
     m_transient_storage.purge_expired_cookies();
+
+    if (on_cookies_changed)
+        on_cookies_changed(domain);
 }
 
 // https://www.ietf.org/archive/id/draft-ietf-httpbis-rfc6265bis-15.html#section-5.8.3
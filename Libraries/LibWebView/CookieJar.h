@@ -87,7 +87,14 @@ public:
 
     ~CookieJar();
 
-    String get_cookie(const URL::URL& url, Web::Cookie::Source source);
+    struct CookieString {
+        String cookie;
+
+        // The cookie-string stays the same until the first of its cookies expires, unless the cookie store is changed.
+        UnixDateTime valid_until;
+    };
+
+    CookieString get_cookie(const URL::URL& url, Web::Cookie::Source source);
     void set_cookie(const URL::URL& url, Web::Cookie::ParsedCookie const& parsed_cookie, Web::Cookie::Source source);
     void update_cookie(Web::Cookie::Cookie);
     void dump_cookies();
@@ -96,6 +103,10 @@ public:
     Optional<Web::Cookie::Cookie> get_named_cookie(URL::URL const& url, StringView name);
     void expire_cookies_with_time_offset(AK::Duration);
 
+    // Invoked whenever cookies of the given domain were stored or updated, or with no domain at all when cookies of
+    // any domain may have changed.
+    Function<void(Optional<String> const& domain)> on_cookies_changed;
+
 private:
     explicit CookieJar(Optional<PersistedStorage>);
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/String.h>
 #include <AK/Time.h>
@@ -46,9 +47,20 @@ ErrorOr<NonnullRefPtr<Database>> Database::create()
     TRY(Core::Directory::create(database_path, Core::Directory::CreateDirectories::Yes));
 
     auto database_file = ByteString::formatted("{}/Ladybird.db", database_path);
+    return create(database_file);
+}
+
+ErrorOr<NonnullRefPtr<Database>> Database::create_memory_backed()
+{
+    return create(":memory:"sv);
+}
+
+ErrorOr<NonnullRefPtr<Database>> Database::create(StringView database_file)
+{
+    auto database_file_path = ByteString { database_file };
 
     sqlite3* m_database { nullptr };
-    SQL_TRY(sqlite3_open(database_file.characters(), &m_database));
+    SQL_TRY(sqlite3_open(database_file_path.characters(), &m_database));
 
     return adopt_nonnull_ref_or_enomem(new (nothrow) Database(m_database));
 }
@@ -116,6 +128,14 @@ void Database::apply_placeholder(StatementID statement_id, int index, ValueType
         SQL_MUST(sqlite3_bind_int(statement, index, value));
     } else if constexpr (IsSame<ValueType, bool>) {
         SQL_MUST(sqlite3_bind_int(statement, index, static_cast<int>(value)));
+    } else if constexpr (IsSame<ValueType, i64>) {
+        SQL_MUST(sqlite3_bind_int64(statement, index, value));
+    } else if constexpr (IsSame<ValueType, ByteBuffer>) {
+        // NOTE: SQLite would bind NULL rather than an empty blob for a null pointer.
+        if (value.is_empty())
+            SQL_MUST(sqlite3_bind_zeroblob(statement, index, 0));
+        else
+            SQL_MUST(sqlite3_bind_blob(statement, index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT));
     }
 }
 
@@ -123,6 +143,8 @@ template void Database::apply_placeholder(StatementID, int, String const&);
 template void Database::apply_placeholder(StatementID, int, UnixDateTime const&);
 template void Database::apply_placeholder(StatementID, int, int const&);
 template void Database::apply_placeholder(StatementID, int, bool const&);
+template void Database::apply_placeholder(StatementID, int, i64 const&);
+template void Database::apply_placeholder(StatementID, int, ByteBuffer const&);
 
 template<typename ValueType>
 ValueType Database::result_column(StatementID statement_id, int column)
@@ -139,6 +161,16 @@ ValueType Database::result_column(StatementID statement_id, int column)
         return sqlite3_column_int(statement, column);
     } else if constexpr (IsSame<ValueType, bool>) {
         return static_cast<bool>(sqlite3_column_int(statement, column));
+    } else if constexpr (IsSame<ValueType, i64>) {
+        return sqlite3_column_int64(statement, column);
+    } else if constexpr (IsSame<ValueType, ByteBuffer>) {
+        // NOTE: SQLite returns a null pointer for empty blobs.
+        auto const* data = static_cast<u8 const*>(sqlite3_column_blob(statement, column));
+        if (!data)
+            return ByteBuffer {};
+
+        auto size = static_cast<size_t>(sqlite3_column_bytes(statement, column));
+        return MUST(ByteBuffer::copy(data, size));
     }
 
     VERIFY_NOT_REACHED();
@@ -148,5 +180,7 @@ template String Database::result_column(StatementID, int);
 template UnixDateTime Database::result_column(StatementID, int);
 template int Database::result_column(StatementID, int);
 template bool Database::result_column(StatementID, int);
+template i64 Database::result_column(StatementID, int);
+template ByteBuffer Database::result_column(StatementID, int);
 
 }
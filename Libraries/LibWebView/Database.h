@@ -22,6 +22,7 @@ namespace WebView {
 class Database : public RefCounted<Database> {
 public:
     static ErrorOr<NonnullRefPtr<Database>> create();
+    static ErrorOr<NonnullRefPtr<Database>> create_memory_backed();
     ~Database();
 
     using StatementID = size_t;
@@ -43,6 +44,8 @@ public:
     ValueType result_column(StatementID, int column);
 
 private:
+    static ErrorOr<NonnullRefPtr<Database>> create(StringView database_file);
+
     explicit Database(sqlite3*);
 
     template<typename ValueType>
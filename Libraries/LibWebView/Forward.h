@@ -12,11 +12,13 @@ namespace WebView {
 
 class CookieJar;
 class Database;
+class IndexedDBStorage;
 class InspectorClient;
 class OutOfProcessWebView;
 class ProcessManager;
 class ViewImplementation;
 class WebContentClient;
+class WebContentProcessPool;
 
 struct Attribute;
 struct CookieStorageKey;
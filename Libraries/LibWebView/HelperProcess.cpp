@@ -74,10 +74,7 @@ static ErrorOr<NonnullRefPtr<ClientType>> launch_server_process(
     VERIFY_NOT_REACHED();
 }
 
-ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
-    WebView::ViewImplementation& view,
-    IPC::File image_decoder_socket,
-    Optional<IPC::File> request_server_socket)
+static Vector<ByteString> web_content_process_arguments(IPC::File const& image_decoder_socket, Optional<IPC::File> const& request_server_socket)
 {
     auto const& web_content_options = WebView::Application::web_content_options();
 
@@ -121,9 +118,27 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
     arguments.append("--image-decoder-socket"sv);
     arguments.append(ByteString::number(image_decoder_socket.fd()));
 
+    return arguments;
+}
+
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
+    WebView::ViewImplementation& view,
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket)
+{
+    auto arguments = web_content_process_arguments(image_decoder_socket, request_server_socket);
     return launch_server_process<WebView::WebContentClient>("WebContent"sv, move(arguments), view);
 }
 
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_spare_web_content_process()
+{
+    Optional<IPC::File> request_server_socket = TRY(connect_new_request_server_client());
+    auto image_decoder_socket = TRY(connect_new_image_decoder_client());
+
+    auto arguments = web_content_process_arguments(image_decoder_socket, request_server_socket);
+    return launch_server_process<WebView::WebContentClient>("WebContent"sv, move(arguments));
+}
+
 ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_image_decoder_process()
 {
     Vector<ByteString> arguments;
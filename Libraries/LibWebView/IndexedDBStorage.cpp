@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWebView/IndexedDBStorage.h>
+
+namespace WebView {
+
+ErrorOr<NonnullOwnPtr<IndexedDBStorage>> IndexedDBStorage::create(Database& database)
+{
+    Statements statements {};
+
+    auto create_records_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS IndexedDBRecords (
+            storage_key TEXT,
+            database_name TEXT,
+            object_store_name TEXT,
+            key BLOB,
+            value BLOB,
+            PRIMARY KEY(storage_key, database_name, object_store_name, key)
+        ) WITHOUT ROWID;)#"sv));
+    database.execute_statement(create_records_table, {});
+
+    auto create_index_records_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS IndexedDBIndexRecords (
+            storage_key TEXT,
+            database_name TEXT,
+            object_store_name TEXT,
+            index_name TEXT,
+            index_key BLOB,
+            primary_key BLOB,
+            PRIMARY KEY(storage_key, database_name, object_store_name, index_name, index_key, primary_key)
+        ) WITHOUT ROWID;)#"sv));
+    database.execute_statement(create_index_records_table, {});
+
+    // Replacing or deleting a record has to find the index entries that refer to it by its primary key.
+    auto create_index_records_by_primary_key = TRY(database.prepare_statement(R"#(
+        CREATE INDEX IF NOT EXISTS IndexedDBIndexRecordsByPrimaryKey
+        ON IndexedDBIndexRecords (storage_key, database_name, object_store_name, primary_key);)#"sv));
+    database.execute_statement(create_index_records_by_primary_key, {});
+
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+
+    statements.put_record = TRY(database.prepare_statement("INSERT OR REPLACE INTO IndexedDBRecords VALUES (?, ?, ?, ?, ?);"sv));
+    statements.delete_records = TRY(database.prepare_statement(R"#(
+        DELETE FROM IndexedDBRecords
+        WHERE storage_key = ? AND database_name = ? AND object_store_name = ? AND key >= ? AND key < ?;)#"sv));
+
+    statements.put_index_record = TRY(database.prepare_statement("INSERT OR REPLACE INTO IndexedDBIndexRecords VALUES (?, ?, ?, ?, ?, ?);"sv));
+    statements.delete_index_records = TRY(database.prepare_statement(R"#(
+        DELETE FROM IndexedDBIndexRecords
+        WHERE storage_key = ? AND database_name = ? AND object_store_name = ? AND primary_key >= ? AND primary_key < ?;)#"sv));
+
+    statements.get_record = TRY(database.prepare_statement(R"#(
+        SELECT value FROM IndexedDBRecords
+        WHERE storage_key = ? AND database_name = ? AND object_store_name = ? AND key = ?;)#"sv));
+
+    // NOTE: A negative LIMIT means that there is no limit.
+    statements.get_records_ascending = TRY(database.prepare_statement(R"#(
+        SELECT key, value FROM IndexedDBRecords
+        WHERE storage_key = ? AND database_name = ? AND object_store_name = ? AND key >= ? AND key < ?
+        ORDER BY key ASC LIMIT ?;)#"sv));
+    statements.get_records_descending = TRY(database.prepare_statement(R"#(
+        SELECT key, value FROM IndexedDBRecords
+        WHERE storage_key = ? AND database_name = ? AND object_store_name = ? AND key >= ? AND key < ?
+        ORDER BY key DESC LIMIT ?;)#"sv));
+    statements.count_records = TRY(database.prepare_statement(R"#(
+        SELECT COUNT(*) FROM IndexedDBRecords
+        WHERE storage_key = ? AND database_name = ? AND object_store_name = ? AND key >= ? AND key < ?;)#"sv));
+
+    statements.get_index_records_ascending = TRY(database.prepare_statement(R"#(
+        SELECT IndexedDBIndexRecords.index_key, IndexedDBIndexRecords.primary_key, IndexedDBRecords.value
+        FROM IndexedDBIndexRecords JOIN IndexedDBRecords
+        ON IndexedDBRecords.storage_key = IndexedDBIndexRecords.storage_key
+            AND IndexedDBRecords.database_name = IndexedDBIndexRecords.database_name
+            AND IndexedDBRecords.object_store_name = IndexedDBIndexRecords.object_store_name
+            AND IndexedDBRecords.key = IndexedDBIndexRecords.primary_key
+        WHERE IndexedDBIndexRecords.storage_key = ? AND IndexedDBIndexRecords.database_name = ? AND IndexedDBIndexRecords.object_store_name = ?
+            AND IndexedDBIndexRecords.index_name = ? AND IndexedDBIndexRecords.index_key >= ? AND IndexedDBIndexRecords.index_key < ?
+        ORDER BY IndexedDBIndexRecords.index_key ASC, IndexedDBIndexRecords.primary_key ASC LIMIT ?;)#"sv));
+    statements.get_index_records_descending = TRY(database.prepare_statement(R"#(
+        SELECT IndexedDBIndexRecords.index_key, IndexedDBIndexRecords.primary_key, IndexedDBRecords.value
+        FROM IndexedDBIndexRecords JOIN IndexedDBRecords
+        ON IndexedDBRecords.storage_key = IndexedDBIndexRecords.storage_key
+            AND IndexedDBRecords.database_name = IndexedDBIndexRecords.database_name
+            AND IndexedDBRecords.object_store_name = IndexedDBIndexRecords.object_store_name
+            AND IndexedDBRecords.key = IndexedDBIndexRecords.primary_key
+        WHERE IndexedDBIndexRecords.storage_key = ? AND IndexedDBIndexRecords.database_name = ? AND IndexedDBIndexRecords.object_store_name = ?
+            AND IndexedDBIndexRecords.index_name = ? AND IndexedDBIndexRecords.index_key >= ? AND IndexedDBIndexRecords.index_key < ?
+        ORDER BY IndexedDBIndexRecords.index_key DESC, IndexedDBIndexRecords.primary_key DESC LIMIT ?;)#"sv));
+
+    return adopt_own(*new IndexedDBStorage { database, statements });
+}
+
+IndexedDBStorage::IndexedDBStorage(Database& database, Statements statements)
+    : m_database(database)
+    , m_statements(statements)
+{
+}
+
+static i64 limit_placeholder(Optional<u32> limit)
+{
+    return limit.has_value() ? static_cast<i64>(*limit) : -1;
+}
+
+// Serialized keys are never a prefix of one another, so the smallest key that sorts after a key is that key followed
+// by a zero byte.
+static ByteBuffer key_successor(ByteBuffer const& key)
+{
+    auto successor = MUST(ByteBuffer::copy(key));
+    successor.append(0);
+    return successor;
+}
+
+void IndexedDBStorage::write(ObjectStoreID const& id, Vector<Operation> const& operations)
+{
+    m_database.execute_statement(m_statements.begin_transaction, {});
+
+    for (auto const& operation : operations) {
+        operation.visit(
+            [&](PutOperation const& put) {
+                m_database.execute_statement(
+                    m_statements.delete_index_records, {},
+                    id.storage_key, id.database, id.object_store, put.key, key_successor(put.key));
+
+                m_database.execute_statement(
+                    m_statements.put_record, {},
+                    id.storage_key, id.database, id.object_store, put.key, put.value);
+
+                for (auto const& index_key : put.index_keys) {
+                    m_database.execute_statement(
+                        m_statements.put_index_record, {},
+                        id.storage_key, id.database, id.object_store, index_key.index, index_key.key, put.key);
+                }
+            },
+            [&](DeleteOperation const& deletion) {
+                m_database.execute_statement(
+                    m_statements.delete_index_records, {},
+                    id.storage_key, id.database, id.object_store, deletion.bounds.lower, deletion.bounds.upper);
+
+                m_database.execute_statement(
+                    m_statements.delete_records, {},
+                    id.storage_key, id.database, id.object_store, deletion.bounds.lower, deletion.bounds.upper);
+            });
+    }
+
+    m_database.execute_statement(m_statements.commit_transaction, {});
+}
+
+Optional<ByteBuffer> IndexedDBStorage::get(ObjectStoreID const& id, ByteBuffer const& key)
+{
+    Optional<ByteBuffer> value;
+
+    m_database.execute_statement(
+        m_statements.get_record,
+        [&](auto statement_id) {
+            value = m_database.result_column<ByteBuffer>(statement_id, 0);
+        },
+        id.storage_key, id.database, id.object_store, key);
+
+    return value;
+}
+
+Vector<IndexedDBStorage::Record> IndexedDBStorage::get_all(ObjectStoreID const& id, KeyBounds const& bounds, Direction direction, Optional<u32> limit)
+{
+    Vector<Record> records;
+    if (limit.has_value())
+        records.ensure_capacity(*limit);
+
+    auto statement = direction == Direction::Next ? m_statements.get_records_ascending : m_statements.get_records_descending;
+
+    m_database.execute_statement(
+        statement,
+        [&](auto statement_id) {
+            auto key = m_database.result_column<ByteBuffer>(statement_id, 0);
+            auto value = m_database.result_column<ByteBuffer>(statement_id, 1);
+            records.append({ move(key), move(value) });
+        },
+        id.storage_key, id.database, id.object_store, bounds.lower, bounds.upper, limit_placeholder(limit));
+
+    return records;
+}
+
+i64 IndexedDBStorage::count(ObjectStoreID const& id, KeyBounds const& bounds)
+{
+    i64 count = 0;
+
+    m_database.execute_statement(
+        m_statements.count_records,
+        [&](auto statement_id) {
+            count = m_database.result_column<i64>(statement_id, 0);
+        },
+        id.storage_key, id.database, id.object_store, bounds.lower, bounds.upper);
+
+    return count;
+}
+
+Vector<IndexedDBStorage::IndexRecord> IndexedDBStorage::get_all_from_index(ObjectStoreID const& id, String const& index, KeyBounds const& bounds, Direction direction, Optional<u32> limit)
+{
+    Vector<IndexRecord> records;
+    if (limit.has_value())
+        records.ensure_capacity(*limit);
+
+    auto statement = direction == Direction::Next ? m_statements.get_index_records_ascending : m_statements.get_index_records_descending;
+
+    m_database.execute_statement(
+        statement,
+        [&](auto statement_id) {
+            auto index_key = m_database.result_column<ByteBuffer>(statement_id, 0);
+            auto primary_key = m_database.result_column<ByteBuffer>(statement_id, 1);
+            auto value = m_database.result_column<ByteBuffer>(statement_id, 2);
+            records.append({ move(index_key), move(primary_key), move(value) });
+        },
+        id.storage_key, id.database, id.object_store, index, bounds.lower, bounds.upper, limit_placeholder(limit));
+
+    return records;
+}
+
+Optional<IndexedDBStorage::Record> IndexedDBStorage::continue_cursor(ObjectStoreID const& id, KeyBounds const& bounds, Direction direction, ByteBuffer const& position)
+{
+    auto remaining_bounds = MUST(ByteBuffer::copy(direction == Direction::Next ? bounds.upper : bounds.lower));
+
+    auto records = direction == Direction::Next
+        ? get_all(id, { key_successor(position), move(remaining_bounds) }, direction, 1)
+        : get_all(id, { move(remaining_bounds), MUST(ByteBuffer::copy(position)) }, direction, 1);
+
+    if (records.is_empty())
+        return {};
+    return records.take_first();
+}
+
+}
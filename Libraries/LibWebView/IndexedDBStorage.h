@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibWebView/Database.h>
+
+namespace WebView {
+
+// Record storage for IndexedDB object stores and their indexes.
+//
+// Keys are handed to us in their serialized form (see Web::IndexedDB::Key::serialize), which SQLite orders correctly
+// just by comparing them as blobs. That lets both tables be plain B-trees clustered on their keys, so that range
+// lookups in either key or index order never have to sort anything.
+class IndexedDBStorage {
+    struct Statements {
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+        Database::StatementID put_record { 0 };
+        Database::StatementID delete_records { 0 };
+        Database::StatementID put_index_record { 0 };
+        Database::StatementID delete_index_records { 0 };
+        Database::StatementID get_record { 0 };
+        Database::StatementID get_records_ascending { 0 };
+        Database::StatementID get_records_descending { 0 };
+        Database::StatementID count_records { 0 };
+        Database::StatementID get_index_records_ascending { 0 };
+        Database::StatementID get_index_records_descending { 0 };
+    };
+
+public:
+    struct ObjectStoreID {
+        String storage_key;
+        String database;
+        String object_store;
+    };
+
+    // Serialized key bounds, such that a key K is in the range exactly when lower <= K < upper.
+    struct KeyBounds {
+        ByteBuffer lower;
+        ByteBuffer upper;
+    };
+
+    enum class Direction {
+        Next,
+        Prev,
+    };
+
+    struct Record {
+        ByteBuffer key;
+        ByteBuffer value;
+    };
+
+    struct IndexRecord {
+        ByteBuffer index_key;
+        ByteBuffer primary_key;
+        ByteBuffer value;
+    };
+
+    struct IndexKey {
+        String index;
+        ByteBuffer key;
+    };
+
+    // Replaces the record with the given key, along with all index entries that refer to it.
+    struct PutOperation {
+        ByteBuffer key;
+        ByteBuffer value;
+        Vector<IndexKey> index_keys;
+    };
+
+    // Removes all records with a key in the given range, along with all index entries that refer to them.
+    struct DeleteOperation {
+        KeyBounds bounds;
+    };
+
+    using Operation = Variant<PutOperation, DeleteOperation>;
+
+    static ErrorOr<NonnullOwnPtr<IndexedDBStorage>> create(Database&);
+
+    // Applies all operations in a single SQLite transaction. Doing so is much faster than committing every operation
+    // on its own, and makes sure that an IndexedDB transaction is either entirely written to disk or not at all.
+    void write(ObjectStoreID const&, Vector<Operation> const&);
+
+    Optional<ByteBuffer> get(ObjectStoreID const&, ByteBuffer const& key);
+    Vector<Record> get_all(ObjectStoreID const&, KeyBounds const&, Direction = Direction::Next, Optional<u32> limit = {});
+    i64 count(ObjectStoreID const&, KeyBounds const&);
+
+    Vector<IndexRecord> get_all_from_index(ObjectStoreID const&, String const& index, KeyBounds const&, Direction = Direction::Next, Optional<u32> limit = {});
+
+    // Returns the record right after (or before, when iterating backwards) the given cursor position.
+    Optional<Record> continue_cursor(ObjectStoreID const&, KeyBounds const&, Direction, ByteBuffer const& position);
+
+private:
+    IndexedDBStorage(Database&, Statements);
+
+    Database& m_database;
+    Statements m_statements;
+};
+
+}
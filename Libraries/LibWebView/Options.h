@@ -58,6 +58,7 @@ struct ChromeOptions {
     Optional<ProcessType> debug_helper_process {};
     Optional<ProcessType> profile_helper_process {};
     Optional<ByteString> webdriver_content_ipc_path {};
+    size_t web_content_process_pool_size { 0 };
 };
 
 enum class IsLayoutTestMode {
@@ -74,6 +74,11 @@ template<typename ClientType, typename... ClientArguments>
 ErrorOr<Process::ProcessAndClient<ClientType>> Process::spawn(ProcessType type, Core::ProcessSpawnOptions const& options, ClientArguments&&... client_arguments)
 {
     auto [core_process, transport] = TRY(spawn_and_connect_to_process(options));
+
+    // These processes exchange a great many messages with us, which are much cheaper to send through shared memory.
+    if (type == ProcessType::WebContent || type == ProcessType::RequestServer)
+        TRY(transport.send_messages_through_shared_memory());
+
     auto client = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) ClientType { move(transport), forward<ClientArguments>(client_arguments)... }));
 
     return ProcessAndClient<ClientType> { Process { type, client, move(core_process) }, client };
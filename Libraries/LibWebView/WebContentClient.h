@@ -37,8 +37,12 @@ public:
     static size_t client_count() { return s_clients.size(); }
 
     WebContentClient(IPC::Transport, ViewImplementation&);
+    explicit WebContentClient(IPC::Transport);
     ~WebContentClient();
 
+    // Hands a process that was launched without a view (see WebContentProcessPool) to its first view.
+    void assign_view(ViewImplementation&);
+
     void register_view(u64 page_id, ViewImplementation&);
     void unregister_view(u64 page_id);
 
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/ScopeGuard.h>
+#include <LibCore/EventLoop.h>
+#include <LibWebView/HelperProcess.h>
+#include <LibWebView/ViewImplementation.h>
+#include <LibWebView/WebContentClient.h>
+#include <LibWebView/WebContentProcessPool.h>
+
+namespace WebView {
+
+void WebContentProcessPool::set_size(size_t size)
+{
+    m_size = size;
+
+    while (m_idle_clients.size() > m_size) {
+        auto client = m_idle_clients.take_last();
+        client->on_web_content_process_crash = nullptr;
+        client->async_close_server();
+    }
+
+    schedule_replenish();
+}
+
+ErrorOr<NonnullRefPtr<WebContentClient>> WebContentProcessPool::take_process(ViewImplementation& view)
+{
+    // Whatever we hand out (or fail to), the pool needs topping up again afterwards.
+    ScopeGuard replenish_guard = [&] { schedule_replenish(); };
+
+    while (!m_idle_clients.is_empty()) {
+        // Hand out the oldest process first, as it has had the most time to finish initializing.
+        auto client = m_idle_clients.take_first();
+        if (!client->is_open())
+            continue;
+
+        client->on_web_content_process_crash = nullptr;
+        client->assign_view(view);
+
+        dbgln_if(WEBVIEW_PROCESS_DEBUG, "Handing out spare WebContent process, {} left in the pool", m_idle_clients.size());
+        return client;
+    }
+
+    auto request_server_socket = TRY(connect_new_request_server_client());
+    auto image_decoder_socket = TRY(connect_new_image_decoder_client());
+
+    return launch_web_content_process(view, move(image_decoder_socket), move(request_server_socket));
+}
+
+void WebContentProcessPool::schedule_replenish()
+{
+    if (m_replenish_scheduled || m_idle_clients.size() >= m_size)
+        return;
+
+    // Spawning a process blocks until it has connected to us, so only spawn one at a time to keep the UI responsive.
+    m_replenish_scheduled = true;
+    Core::deferred_invoke([this]() {
+        replenish();
+    });
+}
+
+void WebContentProcessPool::replenish()
+{
+    m_replenish_scheduled = false;
+
+    if (m_idle_clients.size() >= m_size)
+        return;
+
+    auto client = launch_spare_web_content_process();
+    if (client.is_error()) {
+        // Don't try again right away, the next process that is taken from the pool will cause another attempt.
+        dbgln("Unable to launch a spare WebContent process: {}", client.error());
+        return;
+    }
+
+    // A spare process that crashes is simply dropped. It is replaced the next time a process is taken from the pool,
+    // rather than right away, so that a WebContent that fails during startup does not keep us busy respawning it.
+    client.value()->on_web_content_process_crash = [this, &spare_client = *client.value()]() {
+        remove_idle_client(spare_client);
+    };
+
+    m_idle_clients.append(client.release_value());
+    schedule_replenish();
+}
+
+void WebContentProcessPool::remove_idle_client(WebContentClient& client)
+{
+    m_idle_clients.remove_first_matching([&](auto const& idle_client) {
+        return idle_client.ptr() == &client;
+    });
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/Vector.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+// Keeps a number of idle WebContent processes around, already connected to RequestServer and ImageDecoder, so that a
+// new view does not have to wait for a process to be spawned and to initialize itself. Every process that is handed
+// out is replaced once the event loop gets around to it.
+class WebContentProcessPool {
+    AK_MAKE_NONCOPYABLE(WebContentProcessPool);
+    AK_MAKE_NONMOVABLE(WebContentProcessPool);
+
+public:
+    WebContentProcessPool() = default;
+
+    void set_size(size_t);
+    size_t size() const { return m_size; }
+    size_t idle_process_count() const { return m_idle_clients.size(); }
+
+    // Hands out an idle process for the given view, or launches a new one if there is none.
+    ErrorOr<NonnullRefPtr<WebContentClient>> take_process(ViewImplementation&);
+
+private:
+    void schedule_replenish();
+    void replenish();
+
+    void remove_idle_client(WebContentClient&);
+
+    size_t m_size { 0 };
+    Vector<NonnullRefPtr<WebContentClient>> m_idle_clients;
+    bool m_replenish_scheduled { false };
+};
+
+}
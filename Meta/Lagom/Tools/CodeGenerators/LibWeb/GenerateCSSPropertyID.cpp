@@ -8,6 +8,8 @@
 #include "GeneratorUtil.h"
 #include <AK/CharacterTypes.h>
 #include <AK/GenericShorthands.h>
+#include <AK/HashMap.h>
+#include <AK/QuickSort.h>
 #include <AK/SourceGenerator.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
@@ -128,6 +130,7 @@ ErrorOr<void> generate_header_file(JsonObject& properties, Core::File& file)
     generator.append(R"~~~(
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/StringView.h>
 #include <AK/Traits.h>
@@ -201,6 +204,110 @@ enum class PropertyID {
     generator.set("first_inherited_longhand_property_id", title_casify(inherited_longhand_property_ids.first()));
     generator.set("last_inherited_longhand_property_id", title_casify(inherited_longhand_property_ids.last()));
 
+    // Every longhand's computed value is stored in one of several groups, so that elements can share whole groups of
+    // values with their parent or with the initial values. Each longhand gets a slot within its group.
+    struct StyleGroupSlot {
+        ByteString group;
+        size_t index { 0 };
+    };
+    Vector<Optional<StyleGroupSlot>> style_group_slots;
+    HashMap<ByteString, size_t> style_group_sizes;
+    HashMap<ByteString, bool> style_group_inherited;
+
+    // Invalid, Custom and All don't have a computed value, and neither do shorthands.
+    for (size_t i = 0; i < 3 + inherited_shorthand_property_ids.size() + noninherited_shorthand_property_ids.size(); ++i)
+        style_group_slots.append({});
+
+    auto assign_style_group_slots = [&](auto& property_ids) {
+        for (auto& name : property_ids) {
+            auto const& property = properties.get_object(name).value();
+            auto group = property.get_byte_string("style-group"sv);
+            if (!group.has_value()) {
+                warnln("Longhand property `{}` has no `style-group`", name);
+                VERIFY_NOT_REACHED();
+            }
+
+            // Groups are shared with the parent or with the initial values as a whole, which only makes sense if all
+            // of their properties are either inherited or not.
+            bool inherited = property.get_bool("inherited"sv).value_or(false);
+            if (inherited != style_group_inherited.ensure(*group, [&] { return inherited; })) {
+                warnln("Property `{}` doesn't agree with the rest of style group `{}` on whether it is inherited", name, *group);
+                VERIFY_NOT_REACHED();
+            }
+
+            auto& size = style_group_sizes.ensure(*group, [] { return 0uz; });
+            style_group_slots.append(StyleGroupSlot { *group, size++ });
+        }
+    };
+
+    assign_style_group_slots(inherited_longhand_property_ids);
+    assign_style_group_slots(noninherited_longhand_property_ids);
+
+    auto style_group_names = style_group_sizes.keys();
+    quick_sort(style_group_names);
+
+    generator.set("number_of_style_groups", ByteString::number(style_group_names.size()));
+    generator.set("style_group_slot_count", ByteString::number(style_group_slots.size()));
+
+    generator.append(R"~~~(
+};
+
+enum class StyleGroup : u8 {
+)~~~");
+
+    for (auto const& group : style_group_names) {
+        auto member_generator = generator.fork();
+        member_generator.set("group:titlecase", title_casify(group));
+        member_generator.append(R"~~~(
+    @group:titlecase@,
+)~~~");
+    }
+
+    generator.append(R"~~~(
+    // Properties without a computed value of their own, i.e. shorthands.
+    None,
+};
+
+constexpr size_t number_of_style_groups = @number_of_style_groups@;
+
+constexpr Array<u8, number_of_style_groups> style_group_sizes {
+)~~~");
+
+    for (auto const& group : style_group_names) {
+        auto member_generator = generator.fork();
+        member_generator.set("group_size", ByteString::number(style_group_sizes.get(group).value()));
+        member_generator.append(R"~~~(
+    @group_size@,
+)~~~");
+    }
+
+    generator.append(R"~~~(
+};
+
+struct StyleGroupSlot {
+    StyleGroup group;
+    u8 index;
+};
+
+// Where each property's computed value is stored in StyleProperties, indexed by PropertyID.
+constexpr Array<StyleGroupSlot, @style_group_slot_count@> style_group_slots {
+)~~~");
+
+    for (auto const& slot : style_group_slots) {
+        auto member_generator = generator.fork();
+        if (slot.has_value()) {
+            VERIFY(slot->index <= NumericLimits<u8>::max());
+            member_generator.set("group:titlecase", title_casify(slot->group));
+            member_generator.set("index", ByteString::number(slot->index));
+        } else {
+            member_generator.set("group:titlecase", "None");
+            member_generator.set("index", "0");
+        }
+        member_generator.append(R"~~~(
+    StyleGroupSlot { StyleGroup::@group:titlecase@, @index@ },
+)~~~");
+    }
+
     generator.append(R"~~~(
 };
 
@@ -8,6 +8,7 @@
 #include <AK/IDAllocator.h>
 #include <AK/NonnullOwnPtr.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/PerformanceTrace.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
 #include <LibRequests/NetworkErrorEnum.h>
@@ -39,6 +40,7 @@ struct ConnectionFromClient::ActiveRequest {
     String url;
     Optional<String> reason_phrase;
     ByteBuffer body;
+    MonotonicTime start_time { MonotonicTime::now() };
 
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
@@ -253,8 +255,16 @@ Messages::RequestServer::ConnectNewClientResponse ConnectionFromClient::connect_
         return IPC::File {};
     }
     auto client_socket = client_socket_or_error.release_value();
+
+    auto transport = IPC::Transport(move(client_socket));
+    if (auto result = transport.send_messages_through_shared_memory(); result.is_error()) {
+        close(socket_fds[1]);
+        dbgln("Failed to set up shared memory for client: {}", result.error());
+        return IPC::File {};
+    }
+
     // Note: A ref is stored in the static s_connections map
-    auto client = adopt_ref(*new ConnectionFromClient(IPC::Transport(move(client_socket))));
+    auto client = adopt_ref(*new ConnectionFromClient(move(transport)));
 
     return IPC::File::adopt_fd(socket_fds[1]);
 }
@@ -407,6 +417,9 @@ void ConnectionFromClient::check_active_requests()
             }
 
             async_request_finished(request->request_id, request->downloaded_so_far, network_error);
+
+            if (Core::PerformanceTrace::is_enabled())
+                Core::PerformanceTrace::record_span("network"sv, "fetch"sv, request->start_time, MonotonicTime::now(), request->url);
         }
 
         m_active_requests.remove(request->request_id);
@@ -12,8 +12,8 @@
 #include <LibCore/LocalServer.h>
 #include <LibCore/Process.h>
 #include <LibCore/System.h>
+#include <LibCore/SystemServerTakeover.h>
 #include <LibFileSystem/FileSystem.h>
-#include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <LibTLS/Certificate.h>
 #include <RequestServer/ConnectionFromClient.h>
@@ -69,7 +69,12 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         Core::Platform::register_with_mach_server(mach_server_name);
 #endif
 
-    auto client = TRY(IPC::take_over_accepted_client_from_system_server<RequestServer::ConnectionFromClient>());
+    static_assert(IsSame<IPC::Transport, IPC::TransportSocket>, "Need to handle other IPC transports here");
+
+    // We send a great many messages to the UI process, which are much cheaper to send through shared memory.
+    auto transport = IPC::Transport(TRY(Core::take_over_socket_from_system_server()));
+    TRY(transport.send_messages_through_shared_memory());
+    auto client = IPC::new_client_connection<RequestServer::ConnectionFromClient>(move(transport));
 
     return event_loop.exec();
 }
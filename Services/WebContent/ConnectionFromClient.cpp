@@ -31,6 +31,7 @@
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
@@ -121,6 +122,11 @@ void ConnectionFromClient::connect_to_image_decoder(IPC::File const& image_decod
         on_image_decoder_connection(image_decoder_socket);
 }
 
+void ConnectionFromClient::cookies_changed(Optional<String> const& domain)
+{
+    m_cookie_cache.invalidate(domain);
+}
+
 void ConnectionFromClient::update_system_theme(u64 page_id, Core::AnonymousBuffer const& theme_buffer)
 {
     auto page = this->page(page_id);
@@ -403,6 +409,11 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString const& request,
         return;
     }
 
+    if (request == "dump-task-queue-statistics") {
+        dbgln("{}", Web::HTML::main_thread_event_loop().task_queue().dump_statistics());
+        return;
+    }
+
     if (request == "dump-local-storage") {
         if (auto* document = page->page().top_level_browsing_context().active_document())
             document->window()->local_storage().release_value_but_fixme_should_propagate_errors()->dump();
@@ -24,6 +24,7 @@
 #include <LibWeb/Platform/Timer.h>
 #include <LibWebView/Forward.h>
 #include <LibWebView/PageInfo.h>
+#include <WebContent/CookieCache.h>
 #include <WebContent/Forward.h>
 #include <WebContent/WebContentClientEndpoint.h>
 #include <WebContent/WebContentConsoleClient.h>
@@ -45,6 +46,8 @@ public:
     PageHost& page_host() { return *m_page_host; }
     PageHost const& page_host() const { return *m_page_host; }
 
+    CookieCache& cookie_cache() { return m_cookie_cache; }
+
     Function<void(IPC::File const&)> on_image_decoder_connection;
 
 private:
@@ -58,6 +61,7 @@ private:
     virtual void set_window_handle(u64 page_id, String const& handle) override;
     virtual void connect_to_webdriver(u64 page_id, ByteString const& webdriver_ipc_path) override;
     virtual void connect_to_image_decoder(IPC::File const& image_decoder_socket) override;
+    virtual void cookies_changed(Optional<String> const& domain) override;
     virtual void update_system_theme(u64 page_id, Core::AnonymousBuffer const&) override;
     virtual void update_screen_rects(u64 page_id, Vector<Web::DevicePixelRect> const&, u32) override;
     virtual void load_url(u64 page_id, URL::URL const&) override;
@@ -153,6 +157,8 @@ private:
     GC::Heap& m_heap;
     NonnullOwnPtr<PageHost> m_page_host;
 
+    CookieCache m_cookie_cache;
+
     HashMap<int, Web::FileRequest> m_requested_files {};
     int last_id { 0 };
 
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibURL/URL.h>
+#include <LibWeb/Cookie/ParsedCookie.h>
+#include <WebContent/CookieCache.h>
+
+namespace WebContent {
+
+// This has to agree with how the cookie jar canonicalizes the host of a URL.
+Optional<String> CookieCache::host_for_url(URL::URL const& url)
+{
+    if (!url.is_valid() || url.host().has<Empty>())
+        return {};
+
+    auto host = url.serialized_host();
+    if (host.is_error())
+        return {};
+
+    return MUST(host.value().to_lowercase());
+}
+
+Optional<String> CookieCache::get(URL::URL const& url, Web::Cookie::Source source) const
+{
+    auto host = host_for_url(url);
+    if (!host.has_value())
+        return {};
+
+    auto entries = m_entries_by_host.get(*host);
+    if (!entries.has_value())
+        return {};
+
+    auto entry = entries->get({ url.scheme(), url.serialize_path(), source });
+    if (!entry.has_value() || entry->valid_until <= UnixDateTime::now())
+        return {};
+
+    return entry->cookie;
+}
+
+void CookieCache::set(URL::URL const& url, Web::Cookie::Source source, String cookie, UnixDateTime valid_until)
+{
+    auto host = host_for_url(url);
+    if (!host.has_value())
+        return;
+
+    auto& entries = m_entries_by_host.ensure(host.release_value());
+    entries.set({ url.scheme(), url.serialize_path(), source }, { move(cookie), valid_until });
+}
+
+void CookieCache::invalidate(Optional<String> const& domain)
+{
+    if (!domain.has_value()) {
+        m_entries_by_host.clear();
+        return;
+    }
+
+    m_entries_by_host.remove_all_matching([&](String const& host, auto const&) {
+        return Web::Cookie::domain_matches(host, *domain);
+    });
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Traits.h>
+#include <LibURL/Forward.h>
+#include <LibWeb/Cookie/Cookie.h>
+
+namespace WebContent {
+
+// Cookie-strings previously handed out by the UI process's cookie jar, so that reading document.cookie over and over
+// does not have to block on a synchronous IPC round trip every time.
+//
+// Entries are grouped by the host of the URL they were requested for. The UI process tells us about every change to
+// the cookie store, and we drop the entries of every host the changed cookies may apply to. An entry also goes stale
+// on its own once the first of the cookies it was made of expires.
+class CookieCache {
+public:
+    Optional<String> get(URL::URL const&, Web::Cookie::Source) const;
+    void set(URL::URL const&, Web::Cookie::Source, String cookie, UnixDateTime valid_until);
+
+    // Drops everything that cookies of the given domain may apply to, or everything at all if there is no domain.
+    void invalidate(Optional<String> const& domain);
+
+    static Optional<String> host_for_url(URL::URL const&);
+
+private:
+    struct Key {
+        bool operator==(Key const&) const = default;
+
+        String scheme;
+        String path;
+        Web::Cookie::Source source { Web::Cookie::Source::NonHttp };
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key)
+        {
+            return pair_int_hash(pair_int_hash(key.scheme.hash(), key.path.hash()), to_underlying(key.source));
+        }
+    };
+
+    struct Entry {
+        String cookie;
+        UnixDateTime valid_until;
+    };
+
+    using EntriesForHost = HashMap<Key, Entry, KeyTraits>;
+
+    HashMap<String, EntriesForHost> m_entries_by_host;
+};
+
+}
@@ -482,14 +482,25 @@ Optional<Web::Cookie::Cookie> PageClient::page_did_request_named_cookie(URL::URL
 
 String PageClient::page_did_request_cookie(URL::URL const& url, Web::Cookie::Source source)
 {
+    auto& cookie_cache = client().cookie_cache();
+    if (auto cookie = cookie_cache.get(url, source); cookie.has_value())
+        return cookie.release_value();
+
     auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestCookie>(url, source);
     if (!response) {
         dbgln("WebContent client disconnected during DidRequestCookie. Exiting peacefully.");
         exit(0);
     }
-    return response->take_cookie();
+
+    auto cookie = response->take_cookie();
+    cookie_cache.set(url, source, cookie, response->valid_until());
+    return cookie;
 }
 
+// NOTE: The UI process lets every WebContent process know about cookie changes, but that notification may only be
+//       handled after this process has already read the cookie again. So we drop what the change may have made stale
+//       right away when it originates here.
+
 void PageClient::page_did_set_cookie(URL::URL const& url, Web::Cookie::ParsedCookie const& cookie, Web::Cookie::Source source)
 {
     auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidSetCookie>(url, cookie, source);
@@ -497,15 +508,24 @@ void PageClient::page_did_set_cookie(URL::URL const& url, Web::Cookie::ParsedCoo
         dbgln("WebContent client disconnected during DidSetCookie. Exiting peacefully.");
         exit(0);
     }
+
+    // The cookie ends up applying either to the URL's host, or to the domain given by its Domain attribute.
+    auto& cookie_cache = client().cookie_cache();
+    if (auto host = CookieCache::host_for_url(url); host.has_value())
+        cookie_cache.invalidate(host);
+    if (cookie.domain.has_value())
+        cookie_cache.invalidate(MUST(cookie.domain->to_lowercase()));
 }
 
 void PageClient::page_did_update_cookie(Web::Cookie::Cookie cookie)
 {
+    client().cookie_cache().invalidate(cookie.domain);
     client().async_did_update_cookie(move(cookie));
 }
 
 void PageClient::page_did_expire_cookies_with_time_offset(AK::Duration offset)
 {
+    client().cookie_cache().invalidate({});
     client().async_did_expire_cookies_with_time_offset(offset);
 }
 
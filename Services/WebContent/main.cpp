@@ -197,7 +197,10 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     static_assert(IsSame<IPC::Transport, IPC::TransportSocket>, "Need to handle other IPC transports here");
 
     auto webcontent_socket = TRY(Core::take_over_socket_from_system_server("WebContent"sv));
-    auto webcontent_client = TRY(WebContent::ConnectionFromClient::try_create(Web::Bindings::main_thread_vm().heap(), IPC::Transport(move(webcontent_socket))));
+    auto webcontent_transport = IPC::Transport(move(webcontent_socket));
+    TRY(webcontent_transport.send_messages_through_shared_memory());
+
+    auto webcontent_client = TRY(WebContent::ConnectionFromClient::try_create(Web::Bindings::main_thread_vm().heap(), move(webcontent_transport)));
 
     webcontent_client->on_image_decoder_connection = [&](auto& socket_file) {
         auto maybe_error = reinitialize_image_decoder(socket_file);
@@ -263,7 +266,10 @@ ErrorOr<void> initialize_resource_loader(GC::Heap& heap, int request_server_sock
     auto socket = TRY(Core::LocalSocket::adopt_fd(request_server_socket));
     TRY(socket->set_blocking(true));
 
-    auto request_client = TRY(try_make_ref_counted<Requests::RequestClient>(IPC::Transport(move(socket))));
+    auto transport = IPC::Transport(move(socket));
+    TRY(transport.send_messages_through_shared_memory());
+
+    auto request_client = TRY(try_make_ref_counted<Requests::RequestClient>(move(transport)));
     Web::ResourceLoader::initialize(heap, move(request_client));
 
     return {};
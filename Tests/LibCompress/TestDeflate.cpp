@@ -58,6 +58,37 @@ TEST_CASE(canonical_code_complex)
         EXPECT_EQ(MUST(huffman.read_symbol(bit_stream)), output[idx]);
 }
 
+TEST_CASE(canonical_code_long_codes)
+{
+    // Code lengths 1, 2, ..., 15, 15 form a complete code whose longest codes need the second-level decode table.
+    Array<u8, 16> code;
+    for (size_t i = 0; i < 15; ++i)
+        code[i] = i + 1;
+    code[15] = 15;
+
+    Array<u32, 20> const symbols {
+        15, 0, 14, 9, 10, 1, 11, 12, 13, 2, 15, 3, 4, 8, 5, 6, 7, 14, 1, 0
+    };
+
+    auto const huffman = TRY_OR_FAIL(Compress::CanonicalCode::from_bytes(code));
+
+    AllocatingMemoryStream encoded;
+    {
+        LittleEndianOutputBitStream bit_stream { MaybeOwned<Stream>(encoded) };
+        for (auto symbol : symbols)
+            TRY_OR_FAIL(huffman.write_symbol(bit_stream, symbol));
+        TRY_OR_FAIL(bit_stream.align_to_byte_boundary());
+        TRY_OR_FAIL(bit_stream.flush_buffer_to_stream());
+    }
+    auto encoded_bytes = TRY_OR_FAIL(encoded.read_until_eof());
+
+    // The stream ends with short codes, so the last few symbols can't be decoded by peeking a full 15-bit code.
+    auto memory_stream = TRY_OR_FAIL(try_make<FixedMemoryStream>(encoded_bytes.bytes()));
+    LittleEndianInputBitStream bit_stream { move(memory_stream) };
+    for (auto symbol : symbols)
+        EXPECT_EQ(TRY_OR_FAIL(huffman.read_symbol(bit_stream)), symbol);
+}
+
 TEST_CASE(invalid_canonical_code)
 {
     Array<u8, 257> code;
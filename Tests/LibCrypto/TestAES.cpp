@@ -443,6 +443,36 @@ TEST_CASE(test_AES_CTR_128bit_decrypt_16bytes)
     // If encryption works, then decryption works, too.
 }
 
+TEST_CASE(test_AES_CTR_batched_key_stream_matches_block_by_block)
+{
+    auto key = "WellHelloFriends"_b;
+    u8 ivec[] {
+        0x00, 0x6c, 0xb6, 0xdb, 0xc0, 0x54, 0x3b, 0x59, 0xda, 0x48, 0xd9, 0x0b, 0xff, 0xff, 0xff, 0xfe
+    };
+
+    // Long enough to cover two full batches of counter blocks and a partial trailing block.
+    auto in = ByteBuffer::create_uninitialized(16 * 16 + 5).release_value();
+    for (size_t i = 0; i < in.size(); ++i)
+        in[i] = static_cast<u8>(i * 7);
+
+    Crypto::Cipher::AESCipher::CTRMode cipher(key, 128, Crypto::Cipher::Intent::Encryption);
+    auto out = ByteBuffer::create_zeroed(in.size()).release_value();
+    auto out_span = out.bytes();
+    cipher.encrypt(in, out_span, AS_BB(ivec));
+
+    Crypto::Cipher::AESCipher block_cipher(key, 128);
+    Crypto::Cipher::AESCipherBlock counter_block;
+    auto counter = ByteBuffer::copy(AS_BB(ivec)).release_value();
+    for (size_t offset = 0; offset < in.size(); offset += 16) {
+        counter_block.overwrite(counter);
+        block_cipher.encrypt_block(counter_block, counter_block);
+        for (size_t i = offset; i < min(offset + 16, in.size()); ++i)
+            EXPECT_EQ(out[i], in[i] ^ counter_block.bytes()[i - offset]);
+        auto counter_bytes = counter.bytes();
+        Crypto::Cipher::IncrementInplace {}(counter_bytes);
+    }
+}
+
 BENCHMARK_CASE(GCM)
 {
     Crypto::Authentication::GHash ghash("WellHelloFriends"_b);
@@ -201,6 +201,34 @@ TEST_CASE(test_unsigned_bigint_multiplication_with_big_numbers2)
     EXPECT_EQ(result.words(), expected_result);
 }
 
+TEST_CASE(test_unsigned_bigint_multiplication_with_karatsuba_sized_numbers)
+{
+    // (2^a - 1) * (2^b - 1) == 2^(a + b) - 2^a - 2^b + 1, with operands well beyond the Karatsuba threshold.
+    auto power_of_two = [](size_t bits) { return Crypto::UnsignedBigInteger { 1 }.shift_left(bits); };
+    struct {
+        size_t a;
+        size_t b;
+    } sizes[] = { { 4096, 4096 }, { 8191, 4097 }, { 20000, 3000 }, { 2049, 12345 } };
+
+    for (auto [a, b] : sizes) {
+        auto left = power_of_two(a).minus(1);
+        auto right = power_of_two(b).minus(1);
+        auto expected = power_of_two(a + b).minus(power_of_two(a)).minus(power_of_two(b)).plus(1);
+        EXPECT_EQ(left.multiplied_by(right), expected);
+        EXPECT_EQ(right.multiplied_by(left), expected);
+    }
+}
+
+TEST_CASE(test_unsigned_bigint_multiplication_division_roundtrip)
+{
+    auto left = Crypto::NumberTheory::random_number(1, Crypto::UnsignedBigInteger { 1 }.shift_left(5000));
+    auto right = Crypto::NumberTheory::random_number(1, Crypto::UnsignedBigInteger { 1 }.shift_left(3333));
+    auto product = left.multiplied_by(right);
+    auto division = product.divided_by(right);
+    EXPECT_EQ(division.quotient, left);
+    EXPECT_EQ(division.remainder, 0);
+}
+
 TEST_CASE(test_unsigned_bigint_simple_division)
 {
     Crypto::UnsignedBigInteger num1(27194);
@@ -335,6 +363,26 @@ TEST_CASE(test_bigint_modular_power_extra_tests)
     }
 }
 
+TEST_CASE(test_bigint_large_odd_modular_power_matches_square_and_multiply)
+{
+    auto modulo = Crypto::NumberTheory::random_number(1, Crypto::UnsignedBigInteger { 1 }.shift_left(2048)).shift_left(1).plus(1);
+    auto base = Crypto::NumberTheory::random_number(1, Crypto::UnsignedBigInteger { 1 }.shift_left(2100));
+
+    for (size_t exponent_bits : { 17, 200, 700, 1500 }) {
+        auto exponent = Crypto::NumberTheory::random_number(1, Crypto::UnsignedBigInteger { 1 }.shift_left(exponent_bits));
+
+        Crypto::UnsignedBigInteger expected { 1 };
+        auto square = base.divided_by(modulo).remainder;
+        for (size_t i = 0; i < exponent.one_based_index_of_highest_set_bit(); ++i) {
+            if ((exponent.words()[i / 32] >> (i % 32)) & 1)
+                expected = expected.multiplied_by(square).divided_by(modulo).remainder;
+            square = square.multiplied_by(square).divided_by(modulo).remainder;
+        }
+
+        EXPECT_EQ(Crypto::NumberTheory::ModularPower(base, exponent, modulo), expected);
+    }
+}
+
 TEST_CASE(test_bigint_primality_test)
 {
     struct {
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <AK/Random.h>
+#include <AK/Time.h>
+#include <LibCrypto/Authentication/GHash.h>
+#include <LibCrypto/Cipher/AES.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibTest/TestCase.h>
+
+static ReadonlyBytes operator""_b(char const* string, size_t length)
+{
+    return ReadonlyBytes(string, length);
+}
+
+static constexpr size_t buffer_size = 16 * MiB;
+static constexpr size_t iterations = 8;
+
+static ByteBuffer random_buffer()
+{
+    auto buffer = ByteBuffer::create_uninitialized(buffer_size).release_value();
+    fill_with_random(buffer);
+    return buffer;
+}
+
+template<typename Callback>
+static void report_throughput(StringView name, Callback callback)
+{
+    auto start = MonotonicTime::now();
+    for (size_t i = 0; i < iterations; ++i)
+        callback();
+    auto elapsed = MonotonicTime::now() - start;
+
+    auto megabytes = static_cast<double>(buffer_size * iterations) / MiB;
+    auto seconds = static_cast<double>(elapsed.to_nanoseconds()) / 1e9;
+    outln("{}: {:.1} MiB/s", name, megabytes / seconds);
+}
+
+BENCHMARK_CASE(aes_128_ctr)
+{
+    auto input = random_buffer();
+    auto output = ByteBuffer::create_uninitialized(buffer_size).release_value();
+    u8 iv[16] {};
+
+    Crypto::Cipher::AESCipher::CTRMode cipher("WellHelloFriends"_b, 128, Crypto::Cipher::Intent::Encryption);
+    report_throughput("AES-128-CTR"sv, [&] {
+        auto output_bytes = output.bytes();
+        cipher.encrypt(input, output_bytes, { iv, sizeof(iv) });
+        AK::taint_for_optimizer(output);
+    });
+}
+
+BENCHMARK_CASE(aes_256_gcm)
+{
+    auto input = random_buffer();
+    auto output = ByteBuffer::create_uninitialized(buffer_size).release_value();
+    u8 iv[16] {};
+    u8 tag[16] {};
+
+    Crypto::Cipher::AESCipher::GCMMode cipher("WellHelloFriendsWellHelloFriends"_b, 256, Crypto::Cipher::Intent::Encryption);
+    report_throughput("AES-256-GCM"sv, [&] {
+        cipher.encrypt(input, output.bytes(), { iv, sizeof(iv) }, {}, { tag, sizeof(tag) });
+        AK::taint_for_optimizer(output);
+    });
+}
+
+BENCHMARK_CASE(ghash)
+{
+    auto input = random_buffer();
+
+    Crypto::Authentication::GHash ghash("WellHelloFriends"_b);
+    report_throughput("GHASH"sv, [&] {
+        auto tag = ghash.process({}, input);
+        AK::taint_for_optimizer(tag);
+    });
+}
+
+BENCHMARK_CASE(sha256)
+{
+    auto input = random_buffer();
+
+    report_throughput("SHA-256"sv, [&] {
+        auto digest = Crypto::Hash::SHA256::hash(input);
+        AK::taint_for_optimizer(digest);
+    });
+}
+
+BENCHMARK_CASE(sha512)
+{
+    auto input = random_buffer();
+
+    report_throughput("SHA-512"sv, [&] {
+        auto digest = Crypto::Hash::SHA512::hash(input);
+        AK::taint_for_optimizer(digest);
+    });
+}
@@ -241,6 +241,25 @@ TEST_CASE(test_SHA256_hash_split_into_blocks)
     EXPECT(memcmp(result, digest.data, Crypto::Hash::SHA256::digest_size()) == 0);
 }
 
+TEST_CASE(test_SHA256_hash_one_million_a)
+{
+    u8 result[] {
+        0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67, 0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0
+    };
+    auto input = ByteBuffer::create_uninitialized(1'000'000).release_value();
+    input.bytes().fill('a');
+
+    auto digest = Crypto::Hash::SHA256::hash(input);
+    EXPECT(memcmp(result, digest.data, Crypto::Hash::SHA256::digest_size()) == 0);
+
+    // Updates that do not line up with the block size mix buffered and in-place blocks.
+    Crypto::Hash::SHA256 sha;
+    for (size_t offset = 0; offset < input.size(); offset += 1000)
+        sha.update(input.bytes().slice(offset, 1000));
+    digest = sha.digest();
+    EXPECT(memcmp(result, digest.data, Crypto::Hash::SHA256::digest_size()) == 0);
+}
+
 TEST_CASE(test_SHA384_name)
 {
     Crypto::Hash::SHA384 sha;
@@ -300,6 +319,25 @@ TEST_CASE(test_SHA512_hash_empty_string)
     EXPECT(memcmp(result, digest.data, Crypto::Hash::SHA512::digest_size()) == 0);
 }
 
+TEST_CASE(test_SHA512_hash_one_million_a)
+{
+    u8 result[] {
+        0xe7, 0x18, 0x48, 0x3d, 0x0c, 0xe7, 0x69, 0x64, 0x4e, 0x2e, 0x42, 0xc7, 0xbc, 0x15, 0xb4, 0x63, 0x8e, 0x1f, 0x98, 0xb1, 0x3b, 0x20, 0x44, 0x28, 0x56, 0x32, 0xa8, 0x03, 0xaf, 0xa9, 0x73, 0xeb, 0xde, 0x0f, 0xf2, 0x44, 0x87, 0x7e, 0xa6, 0x0a, 0x4c, 0xb0, 0x43, 0x2c, 0xe5, 0x77, 0xc3, 0x1b, 0xeb, 0x00, 0x9c, 0x5c, 0x2c, 0x49, 0xaa, 0x2e, 0x4e, 0xad, 0xb2, 0x17, 0xad, 0x8c, 0xc0, 0x9b
+    };
+    auto input = ByteBuffer::create_uninitialized(1'000'000).release_value();
+    input.bytes().fill('a');
+
+    auto digest = Crypto::Hash::SHA512::hash(input);
+    EXPECT(memcmp(result, digest.data, Crypto::Hash::SHA512::digest_size()) == 0);
+
+    // Updates that do not line up with the block size mix buffered and in-place blocks.
+    Crypto::Hash::SHA512 sha;
+    for (size_t offset = 0; offset < input.size(); offset += 1000)
+        sha.update(input.bytes().slice(offset, 1000));
+    digest = sha.digest();
+    EXPECT(memcmp(result, digest.data, Crypto::Hash::SHA512::digest_size()) == 0);
+}
+
 TEST_CASE(test_ghash_test_name)
 {
     Crypto::Authentication::GHash ghash("WellHelloFriends");
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Vector.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/PremultipliedAlpha.h>
 #include <LibTest/TestCase.h>
 
 TEST_CASE(color)
@@ -21,3 +23,37 @@ TEST_CASE(all_green)
     EXPECT_EQ(Color(Color::NamedColor::Green), Color::from_xyz50(0.385152, 0.716887, 0.097081));
     EXPECT_EQ(Color(Color::NamedColor::Green), Color::from_xyz65(0.357584, 0.715169, 0.119195));
 }
+
+TEST_CASE(unpremultiply_bgra8888_to_rgba8888)
+{
+    // Five pixels, so both the vectorized loop and the scalar tail are exercised.
+    u32 const premultiplied[] = { 0xff102030, 0x80402010, 0x00000000, 0x07030107, 0x80808080 };
+    u32 unpremultiplied[5] {};
+    Gfx::unpremultiply_bgra8888_to_rgba8888(premultiplied, unpremultiplied, 5);
+
+    EXPECT_EQ(unpremultiplied[0], 0xff302010u);
+    EXPECT_EQ(unpremultiplied[1], 0x80204080u);
+    EXPECT_EQ(unpremultiplied[2], 0x00000000u);
+    EXPECT_EQ(unpremultiplied[3], 0x07ff246du);
+    EXPECT_EQ(unpremultiplied[4], 0x80ffffffu);
+}
+
+TEST_CASE(premultiply_rgba8888_to_bgra8888_round_trips)
+{
+    Vector<u32> premultiplied;
+    for (u32 alpha = 0; alpha < 256; ++alpha) {
+        for (u32 value = 0; value <= alpha; ++value)
+            premultiplied.append((alpha << 24) | (value << 16) | ((alpha - value) << 8) | (value / 2));
+    }
+
+    Vector<u32> unpremultiplied;
+    unpremultiplied.resize(premultiplied.size());
+    Gfx::unpremultiply_bgra8888_to_rgba8888(premultiplied.data(), unpremultiplied.data(), premultiplied.size());
+
+    Vector<u32> round_tripped;
+    round_tripped.resize(premultiplied.size());
+    Gfx::premultiply_rgba8888_to_bgra8888(unpremultiplied.data(), round_tripped.data(), unpremultiplied.size());
+
+    for (size_t i = 0; i < premultiplied.size(); ++i)
+        EXPECT_EQ(round_tripped[i], premultiplied[i]);
+}
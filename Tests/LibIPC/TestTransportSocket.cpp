@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Socket.h>
+#include <LibCore/System.h>
+#include <LibIPC/TransportSocket.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+
+struct TransportPair {
+    IPC::TransportSocket sender;
+    IPC::TransportSocket receiver;
+};
+
+static TransportPair create_transport_pair()
+{
+    int fds[2] {};
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+    return {
+        IPC::TransportSocket(MUST(Core::LocalSocket::adopt_fd(fds[0]))),
+        IPC::TransportSocket(MUST(Core::LocalSocket::adopt_fd(fds[1]))),
+    };
+}
+
+static Vector<u8> read_bytes(IPC::TransportSocket& transport, size_t count, Vector<int>* fds = nullptr)
+{
+    Vector<u8> bytes;
+
+    while (bytes.size() < count) {
+        transport.wait_until_readable();
+
+        auto result = transport.read_as_much_as_possible_without_blocking([] { FAIL("Peer disconnected"); });
+        bytes.extend(move(result.bytes));
+
+        if (fds)
+            fds->extend(move(result.fds));
+        else
+            EXPECT(result.fds.is_empty());
+    }
+
+    EXPECT_EQ(bytes.size(), count);
+    return bytes;
+}
+
+static void test_messages(IPC::TransportSocket& sender, IPC::TransportSocket& receiver)
+{
+    Vector<u8> expected;
+
+    for (u8 i = 0; i < 100; ++i) {
+        Array<u8, 3> message { i, static_cast<u8>(i * 2), static_cast<u8>(i * 3) };
+        MUST(sender.transfer(message, {}));
+        expected.append(message.data(), message.size());
+    }
+
+    EXPECT_EQ(read_bytes(receiver, expected.size()), expected);
+}
+
+TEST_CASE(socket)
+{
+    auto [sender, receiver] = create_transport_pair();
+    test_messages(sender, receiver);
+    test_messages(receiver, sender);
+}
+
+TEST_CASE(shared_memory)
+{
+    auto [sender, receiver] = create_transport_pair();
+    MUST(sender.send_messages_through_shared_memory());
+
+    test_messages(sender, receiver);
+    test_messages(receiver, sender);
+    test_messages(sender, receiver);
+}
+
+TEST_CASE(shared_memory_in_both_directions)
+{
+    auto [sender, receiver] = create_transport_pair();
+    MUST(sender.send_messages_through_shared_memory());
+    MUST(receiver.send_messages_through_shared_memory());
+
+    test_messages(sender, receiver);
+    test_messages(receiver, sender);
+}
+
+TEST_CASE(shared_memory_with_file_descriptors)
+{
+    auto [sender, receiver] = create_transport_pair();
+    MUST(sender.send_messages_through_shared_memory());
+
+    auto pipe_fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    Array<u8, 4> message { 1, 2, 3, 4 };
+    MUST(sender.transfer(message, { pipe_fds[1] }));
+    MUST(Core::System::close(pipe_fds[1]));
+
+    Vector<int> fds;
+    auto bytes = read_bytes(receiver, message.size(), &fds);
+    EXPECT_EQ(bytes, Vector<u8> { message.span() });
+    EXPECT_EQ(fds.size(), 1u);
+
+    // Make sure we received the write end of our pipe, and not e.g. the shared memory ring's file descriptor.
+    MUST(Core::System::write(fds[0], message));
+    Array<u8, 4> buffer {};
+    EXPECT_EQ(MUST(Core::System::read(pipe_fds[0], buffer)), 4);
+    EXPECT_EQ(buffer, message);
+
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(pipe_fds[0]));
+}
+
+TEST_CASE(shared_memory_message_larger_than_ring)
+{
+    auto transports = create_transport_pair();
+    IGNORE_USE_IN_ESCAPING_LAMBDA auto& sender = transports.sender;
+    MUST(sender.send_messages_through_shared_memory());
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA auto message = MUST(ByteBuffer::create_uninitialized(IPC::SharedMemoryRing::default_capacity * 3 + 5));
+    for (size_t i = 0; i < message.size(); ++i)
+        message[i] = static_cast<u8>(i % 251);
+
+    auto sending_thread = Threading::Thread::construct([&sender, &message]() -> intptr_t {
+        MUST(sender.transfer(message.bytes(), {}));
+        return 0;
+    });
+    sending_thread->start();
+
+    auto bytes = read_bytes(transports.receiver, message.size());
+    (void)sending_thread->join();
+
+    EXPECT_EQ(bytes, Vector<u8> { message.span() });
+}
+
+TEST_CASE(shared_memory_peer_disconnects)
+{
+    auto [sender, receiver] = create_transport_pair();
+    MUST(sender.send_messages_through_shared_memory());
+
+    receiver.close();
+
+    // Once the ring is full, we must notice that there is nobody left to make room in it.
+    auto message = MUST(ByteBuffer::create_zeroed(IPC::SharedMemoryRing::default_capacity + 1));
+    EXPECT(sender.transfer(message.bytes(), {}).is_error());
+}
+
+TEST_CASE(shared_memory_peer_stops_reading)
+{
+    auto [sender, receiver] = create_transport_pair();
+    MUST(sender.send_messages_through_shared_memory());
+
+    // Our peer is still there, but never makes room in the ring, so we must give up rather than wait forever.
+    auto message = MUST(ByteBuffer::create_zeroed(IPC::SharedMemoryRing::default_capacity + 1));
+    EXPECT(sender.transfer(message.bytes(), {}).is_error());
+}
@@ -23,3 +23,44 @@ TEST_CASE(master_elements_containing_crc32)
     MUST(matroska_reader.seek_to_random_access_point(iterator, AK::Duration::from_seconds(7)));
     MUST(iterator.next_block());
 }
+
+static void test_seeking_to_keyframes_before_timestamps(StringView path, bool has_cues)
+{
+    auto matroska_reader = MUST(Media::Matroska::Reader::from_file(path));
+    u64 video_track = 0;
+    MUST(matroska_reader.for_each_track_of_type(Media::Matroska::TrackEntry::TrackType::Video, [&](Media::Matroska::TrackEntry const& track_entry) -> Media::DecoderErrorOr<IterationDecision> {
+        video_track = track_entry.track_number();
+        return IterationDecision::Break;
+    }));
+    VERIFY(video_track != 0);
+    EXPECT_EQ(MUST(matroska_reader.has_cues_for_track(video_track)), has_cues);
+
+    auto iterator = MUST(matroska_reader.create_sample_iterator(video_track));
+    auto seek_to = [&](i64 milliseconds) {
+        iterator = MUST(matroska_reader.seek_to_random_access_point(iterator, AK::Duration::from_milliseconds(milliseconds)));
+        auto block = MUST(iterator.next_block());
+        EXPECT(block.only_keyframes());
+        return block.timestamp().to_milliseconds();
+    };
+
+    // These files have keyframes at 0ms and 4638ms. Seek back and forth, so that seeks happen both before and after
+    // the iterator's current position.
+    EXPECT_EQ(seek_to(1000), 0);
+    EXPECT_EQ(seek_to(5000), 4638);
+    EXPECT_EQ(seek_to(4638), 4638);
+    EXPECT_EQ(seek_to(4637), 0);
+    EXPECT_EQ(seek_to(9000), 4638);
+    EXPECT_EQ(seek_to(0), 0);
+    EXPECT_EQ(seek_to(3000), 0);
+}
+
+TEST_CASE(seek_to_keyframe_before_timestamp)
+{
+    test_seeking_to_keyframes_before_timestamps("vp9_oob_blocks.webm"sv, true);
+}
+
+// This is vp9_oob_blocks.webm with its Cues element renamed to an unknown element, so seeks have to search the clusters.
+TEST_CASE(seek_to_keyframe_before_timestamp_without_cues)
+{
+    test_seeking_to_keyframes_before_timestamps("vp9_oob_blocks_without_cues.webm"sv, false);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NonnullOwnPtr.h>
+#include <LibGfx/Bitmap.h>
+#include <LibMedia/Color/ColorConverter.h>
+#include <LibMedia/VideoFrame.h>
+#include <LibTest/TestCase.h>
+
+using namespace Media;
+
+static constexpr CodingIndependentCodePoints bt709_studio { ColorPrimaries::BT709, TransferCharacteristics::SRGB, MatrixCoefficients::BT709, VideoFullRangeFlag::Studio };
+
+static NonnullOwnPtr<SubsampledYUVFrame> create_frame(Gfx::Size<u32> size, Subsampling subsampling)
+{
+    auto frame = MUST(SubsampledYUVFrame::try_create({}, size, 8, bt709_studio, subsampling));
+    auto chroma_size = subsampling.subsampled_size(size);
+
+    auto* y = frame->get_plane_data<u8>(0);
+    auto* u = frame->get_plane_data<u8>(1);
+    auto* v = frame->get_plane_data<u8>(2);
+
+    for (size_t i = 0; i < size.width() * size.height(); i++)
+        y[i] = static_cast<u8>(i * 7);
+    for (size_t i = 0; i < chroma_size.width() * chroma_size.height(); i++) {
+        u[i] = static_cast<u8>(i * 13);
+        v[i] = static_cast<u8>(i * 29 + 5);
+    }
+
+    return frame;
+}
+
+// Interpolates the chroma sample of one pixel on its own, as a reference for the conversion of whole rows.
+static u8 expected_chroma_sample(u8 const* plane, Subsampling subsampling, Gfx::Size<u32> chroma_size, u32 width, u32 column, u32 row)
+{
+    auto horizontally_interpolated = [&](u32 chroma_row) -> u32 {
+        auto const* samples = &plane[chroma_row * chroma_size.width()];
+        if (!subsampling.x())
+            return samples[column];
+
+        // Odd columns sit on a chroma sample and even columns between two, except for the first column, which takes the
+        // first sample. With an even width, the last column repeats the one before it.
+        auto sample_column = column;
+        if ((width & 1) == 0 && sample_column == width - 1)
+            sample_column--;
+        if (sample_column == 0)
+            return samples[0];
+        if ((sample_column & 1) != 0)
+            return samples[sample_column / 2];
+        return (samples[sample_column / 2 - 1] + samples[sample_column / 2]) >> 1;
+    };
+
+    if (!subsampling.y())
+        return horizontally_interpolated(row);
+
+    // Each pair of rows shares a chroma row. The first row of a pair is interpolated between that and the one above it.
+    auto chroma_row = row / 2;
+    if ((row & 1) != 0 || chroma_row == 0)
+        return horizontally_interpolated(chroma_row);
+    return (horizontally_interpolated(chroma_row - 1) + horizontally_interpolated(chroma_row)) >> 1;
+}
+
+static void expect_frame_matches_per_pixel_conversion(SubsampledYUVFrame& frame, Subsampling subsampling)
+{
+    auto bitmap = MUST(frame.to_bitmap());
+    auto width = frame.width();
+    auto chroma_size = subsampling.subsampled_size(frame.size());
+
+    auto* y = frame.get_plane_data<u8>(0);
+    auto* u = frame.get_plane_data<u8>(1);
+    auto* v = frame.get_plane_data<u8>(2);
+
+    for (u32 row = 0; row < frame.height(); row++) {
+        for (u32 column = 0; column < width; column++) {
+            auto expected_u = expected_chroma_sample(u, subsampling, chroma_size, width, column, row);
+            auto expected_v = expected_chroma_sample(v, subsampling, chroma_size, width, column, row);
+            auto expected = ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio, u8>(y[row * width + column], expected_u, expected_v);
+            if (bitmap->get_pixel(column, row) != expected) {
+                FAIL(ByteString::formatted("Pixel {},{} of a {}x{} frame differs", column, row, width, frame.height()));
+                return;
+            }
+        }
+    }
+}
+
+TEST_CASE(convert_frame_without_subsampling)
+{
+    // Include sizes that are not a multiple of the vector width, and sizes large enough to be converted in several bands.
+    for (auto size : { Gfx::Size<u32> { 1, 1 }, Gfx::Size<u32> { 7, 5 }, Gfx::Size<u32> { 33, 17 }, Gfx::Size<u32> { 1279, 721 } }) {
+        Subsampling subsampling { false, false };
+        auto frame = create_frame(size, subsampling);
+        expect_frame_matches_per_pixel_conversion(*frame, subsampling);
+    }
+}
+
+TEST_CASE(convert_subsampled_frame)
+{
+    // The large sizes are converted in several bands, each of which has to start from the chroma row above it.
+    for (auto size : { Gfx::Size<u32> { 1, 1 }, Gfx::Size<u32> { 2, 2 }, Gfx::Size<u32> { 7, 5 }, Gfx::Size<u32> { 8, 6 }, Gfx::Size<u32> { 1920, 1081 }, Gfx::Size<u32> { 1281, 720 } }) {
+        for (auto subsampling : { Subsampling { true, false }, Subsampling { true, true } }) {
+            auto frame = create_frame(size, subsampling);
+            expect_frame_matches_per_pixel_conversion(*frame, subsampling);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibMedia/VideoFramePool.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(surfaces_are_reused_once_released)
+{
+    auto pool = MUST(Media::VideoFramePool::create());
+
+    auto first = MUST(pool->acquire_surface({ 64, 48 }));
+    auto* first_pointer = first.ptr();
+
+    // As long as someone holds onto the first surface, we must get a different one.
+    auto second = MUST(pool->acquire_surface({ 64, 48 }));
+    EXPECT_NE(second.ptr(), first_pointer);
+
+    pool->present(first);
+    first = second;
+
+    // The presented surface is still in use by the pool itself.
+    auto third = MUST(pool->acquire_surface({ 64, 48 }));
+    EXPECT_NE(third.ptr(), first_pointer);
+    EXPECT_NE(third.ptr(), second.ptr());
+
+    // Presenting another surface releases the previously presented one.
+    pool->present(third);
+    auto fourth = MUST(pool->acquire_surface({ 64, 48 }));
+    EXPECT_EQ(fourth.ptr(), first_pointer);
+    EXPECT_EQ(pool->presented_surface().ptr(), third.ptr());
+}
+
+TEST_CASE(surfaces_are_resized_when_reused)
+{
+    auto pool = MUST(Media::VideoFramePool::create());
+
+    auto* surface_pointer = MUST(pool->acquire_surface({ 64, 48 })).ptr();
+
+    auto surface = MUST(pool->acquire_surface({ 32, 16 }));
+    EXPECT_EQ(surface.ptr(), surface_pointer);
+    EXPECT_EQ(surface->size(), Gfx::IntSize(32, 16));
+    EXPECT_EQ(surface->bitmap().size(), Gfx::IntSize(32, 16));
+}
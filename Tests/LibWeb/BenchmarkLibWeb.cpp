@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <AK/Time.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/ResourceImplementationFile.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/PathFontProvider.h>
+#include <LibGfx/Palette.h>
+#include <LibGfx/SystemTheme.h>
+#include <LibTest/TestCase.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/DocumentState.h>
+#include <LibWeb/HTML/NavigationParams.h>
+#include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Platform/EventLoopPluginSerenity.h>
+#include <LibWebView/Plugins/FontPlugin.h>
+#include <LibWebView/Utilities.h>
+
+static Gfx::IntSize const viewport_size { 1280, 1024 };
+
+template<typename Callback>
+static void report_per_operation(StringView name, size_t iterations, Callback callback)
+{
+    auto start = MonotonicTime::now();
+    for (size_t i = 0; i < iterations; ++i)
+        callback();
+    auto elapsed = MonotonicTime::now() - start;
+
+    outln("{}: {} ns/op", name, elapsed.to_nanoseconds() / static_cast<i64>(iterations));
+}
+
+class BenchmarkPageClient final : public Web::PageClient {
+    GC_CELL(BenchmarkPageClient, Web::PageClient);
+    GC_DECLARE_ALLOCATOR(BenchmarkPageClient);
+
+public:
+    static GC::Ref<BenchmarkPageClient> create(JS::VM& vm)
+    {
+        return vm.heap().allocate<BenchmarkPageClient>();
+    }
+
+    virtual ~BenchmarkPageClient() override = default;
+
+    GC::Ptr<Web::Page> m_page;
+
+    virtual Web::Page& page() override { return *m_page; }
+    virtual Web::Page const& page() const override { return *m_page; }
+    virtual bool is_connection_open() const override { return false; }
+    virtual Gfx::Palette palette() const override { return Gfx::Palette(*m_palette_impl); }
+    virtual Web::DevicePixelRect screen_rect() const override { return { {}, viewport_size.to_type<Web::DevicePixels>() }; }
+    virtual double device_pixels_per_css_pixel() const override { return 1.0; }
+    virtual Web::CSS::PreferredColorScheme preferred_color_scheme() const override { return Web::CSS::PreferredColorScheme::Auto; }
+    virtual Web::CSS::PreferredContrast preferred_contrast() const override { return Web::CSS::PreferredContrast::Auto; }
+    virtual Web::CSS::PreferredMotion preferred_motion() const override { return Web::CSS::PreferredMotion::Auto; }
+    virtual void request_file(Web::FileRequest) override { }
+    virtual void paint_next_frame() override { }
+    virtual void process_screenshot_requests() override { }
+    virtual void paint(Web::DevicePixelRect const&, Web::Painting::BackingStore&, Web::PaintOptions = {}) override { }
+    virtual bool is_ready_to_paint() const override { return true; }
+    virtual Web::DisplayListPlayerType display_list_player_type() const override { return Web::DisplayListPlayerType::SkiaCPU; }
+
+private:
+    BenchmarkPageClient()
+    {
+        auto buffer = MUST(Core::AnonymousBuffer::create_with_size(sizeof(Gfx::SystemTheme)));
+        m_palette_impl = Gfx::PaletteImpl::create_with_anonymous_buffer(buffer);
+    }
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_page);
+    }
+
+    RefPtr<Gfx::PaletteImpl> m_palette_impl;
+};
+
+GC_DEFINE_ALLOCATOR(BenchmarkPageClient);
+
+static Web::Page& benchmark_page()
+{
+    static GC::Root<Web::Page> s_page;
+    if (s_page)
+        return *s_page;
+
+    // The same environment WebContent sets up, minus everything that would talk to other processes.
+    static Core::EventLoop s_event_loop;
+    Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
+
+    WebView::platform_init();
+    Core::ResourceImplementation::install(make<Core::ResourceImplementationFile>(MUST(String::from_byte_string(WebView::s_ladybird_resource_root))));
+
+    auto& font_provider = static_cast<Gfx::PathFontProvider&>(Gfx::FontDatabase::the().install_system_font_provider(make<Gfx::PathFontProvider>()));
+    font_provider.load_all_fonts_from_uri("resource://fonts"sv);
+
+    // Layout test mode picks the same fonts everywhere, so the numbers from different machines stay comparable.
+    Web::Platform::FontPlugin::install(*new WebView::FontPlugin(true, &font_provider));
+
+    MUST(Web::Bindings::initialize_main_thread_vm(Web::HTML::EventLoop::Type::Window));
+
+    auto& vm = Web::Bindings::main_thread_vm();
+    auto page_client = BenchmarkPageClient::create(vm);
+    auto page = Web::Page::create(vm, page_client);
+    page_client->m_page = page.ptr();
+    page->set_top_level_traversable(MUST(Web::HTML::TraversableNavigable::create_a_new_top_level_traversable(page, nullptr, {})));
+    page->top_level_traversable()->set_viewport_size(viewport_size.to_type<Web::CSSPixels>());
+
+    s_page = GC::make_root(page);
+    return *s_page;
+}
+
+// Replaces the active document of the benchmark page with a fresh one, parsed from `html`.
+static GC::Ref<Web::DOM::Document> create_document(StringView html)
+{
+    auto& page = benchmark_page();
+    GC::Ref<Web::HTML::Navigable> navigable = page.top_level_traversable();
+
+    auto response = Web::Fetch::Infrastructure::Response::create(navigable->vm());
+    response->url_list().append(URL::URL("about:blank"sv));
+    auto navigation_params = navigable->heap().allocate<Web::HTML::NavigationParams>();
+    navigation_params->navigable = navigable;
+    navigation_params->response = response;
+    navigation_params->origin = URL::Origin {};
+    navigation_params->policy_container = Web::HTML::PolicyContainer {};
+    navigation_params->final_sandboxing_flag_set = Web::HTML::SandboxingFlagSet {};
+    navigation_params->opener_policy = Web::HTML::OpenerPolicy {};
+
+    auto document = MUST(Web::DOM::Document::create_and_initialize(Web::DOM::Document::Type::HTML, "text/html"_string, navigation_params));
+    navigable->set_ongoing_navigation({});
+    navigable->active_document()->destroy();
+    navigable->active_session_history_entry()->document_state()->set_document(document);
+
+    auto parser = Web::HTML::HTMLParser::create(document, html, "utf-8"sv);
+    parser->run(document->url());
+    return document;
+}
+
+// A news-site-like page: a header with navigation, then articles made of headings, paragraphs with inline
+// markup, lists and asides. Roughly 20 elements per article.
+static String generate_article_page(size_t article_count, StringView stylesheet = {})
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><html><head><title>Benchmark</title>"sv);
+    if (!stylesheet.is_empty())
+        builder.appendff("<style>{}</style>", stylesheet);
+    builder.append("</head><body><header class=\"site-header\"><nav><ul>"sv);
+    for (size_t i = 0; i < 10; ++i)
+        builder.appendff("<li class=\"nav-item\"><a href=\"/section/{}\">Section {}</a></li>", i, i);
+    builder.append("</ul></nav></header><main id=\"content\">"sv);
+
+    for (size_t i = 0; i < article_count; ++i) {
+        builder.appendff("<article class=\"story c{}\" id=\"story-{}\" data-index=\"{}\">", i % 100, i, i);
+        builder.appendff("<h2 class=\"headline\"><a href=\"/story/{}\">Story number {} &amp; friends</a></h2>", i, i);
+        builder.append("<p class=\"byline\">By <span class=\"author\">Some Body</span> on <time>2026-01-01</time></p>"sv);
+        builder.append("<p>Lorem ipsum dolor sit amet, <em>consectetur</em> adipiscing elit, sed do eiusmod tempor "sv);
+        builder.append("incididunt ut <strong>labore et dolore</strong> magna aliqua. Ut enim ad minim veniam, quis "sv);
+        builder.append("nostrud <a href=\"#\">exercitation</a> ullamco laboris nisi ut aliquip ex ea commodo.</p>"sv);
+        builder.append("<ul class=\"tags\"><li>alpha</li><li>beta</li><li>gamma</li></ul>"sv);
+        builder.append("<aside class=\"note\"><p>Duis aute irure dolor in <code>reprehenderit</code>.</p></aside>"sv);
+        builder.append("</article>"sv);
+    }
+
+    builder.append("</main><footer><p>&copy; Benchmark</p></footer></body></html>"sv);
+    return MUST(builder.to_string());
+}
+
+// Lots of rules of the kinds real sites have: class selectors, descendant and child combinators, attribute
+// selectors and structural pseudo-classes, most of which only match a few elements.
+static String generate_stylesheet(size_t rule_count)
+{
+    StringBuilder builder;
+    builder.append("body { font: 14px/1.4 sans-serif; margin: 0; } .story { margin: 8px; padding: 4px; }"sv);
+    for (size_t i = 0; i < rule_count; ++i) {
+        switch (i % 5) {
+        case 0:
+            builder.appendff(".c{} .headline a {{ color: rgb({}, 0, 0); }}\n", i % 100, i % 256);
+            break;
+        case 1:
+            builder.appendff("article.c{} > p:nth-child(2n+1) {{ margin-left: {}px; }}\n", i % 100, i % 13);
+            break;
+        case 2:
+            builder.appendff("[data-index=\"{}\"] .tags li:first-child {{ font-weight: bold; }}\n", i);
+            break;
+        case 3:
+            builder.appendff("#story-{} aside p code {{ background-color: #{:06x}; }}\n", i, i * 2654435761u & 0xffffff);
+            break;
+        case 4:
+            builder.appendff("main > .c{}:hover .byline span.author {{ text-decoration: underline; }}\n", i % 100);
+            break;
+        }
+    }
+    return MUST(builder.to_string());
+}
+
+// Nested containers of the given display type, `depth` levels deep, each holding a few items with text.
+static String generate_nested_page(StringView display, size_t depth, size_t items_per_level)
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><html><head><style>"sv);
+    builder.appendff(".container {{ display: {}; padding: 2px; border: 1px solid black; }}", display);
+    builder.append(".container { grid-template-columns: repeat(4, 1fr); flex-wrap: wrap; gap: 2px; }"sv);
+    builder.append(".item { padding: 1px; margin: 1px; }"sv);
+    builder.append("</style></head><body>"sv);
+
+    for (size_t level = 0; level < depth; ++level) {
+        builder.append("<div class=\"container\">"sv);
+        for (size_t i = 0; i < items_per_level; ++i)
+            builder.appendff("<div class=\"item\">Item {} at level {} with some text</div>", i, level);
+    }
+    for (size_t level = 0; level < depth; ++level)
+        builder.append("</div>"sv);
+
+    builder.append("</body></html>"sv);
+    return MUST(builder.to_string());
+}
+
+static void benchmark_layout(StringView name, StringView display)
+{
+    auto html = generate_nested_page(display, 100, 20);
+    auto document = create_document(html);
+    document->update_layout();
+
+    report_per_operation(name, 20, [&] {
+        document->set_needs_layout();
+        document->update_layout();
+    });
+}
+
+BENCHMARK_CASE(html_tokenize)
+{
+    auto html = generate_article_page(5000);
+
+    report_per_operation("HTML tokenization"sv, 10, [&] {
+        Web::HTML::HTMLTokenizer tokenizer { html, "utf-8"sv };
+        while (true) {
+            auto token = tokenizer.next_token();
+            if (!token.has_value())
+                break;
+            AK::taint_for_optimizer(token);
+        }
+    });
+}
+
+BENCHMARK_CASE(html_tree_build)
+{
+    auto html = generate_article_page(5000);
+
+    report_per_operation("HTML tree building"sv, 10, [&] {
+        auto document = create_document(html);
+        AK::taint_for_optimizer(document);
+    });
+}
+
+BENCHMARK_CASE(style_cascade)
+{
+    // 2500 articles of about 20 elements each make for 50k elements.
+    auto html = generate_article_page(2500, generate_stylesheet(2000));
+    auto document = create_document(html);
+    document->update_style();
+
+    report_per_operation("Style cascade"sv, 10, [&] {
+        document->invalidate_style(Web::DOM::StyleInvalidationReason::SettingsChange);
+        document->update_style();
+    });
+
+    // The counters cover the last style update only.
+    auto const& counters = document->style_computer().selector_matching_counters();
+    outln("Style cascade: {} candidate rules, {} rejected by the ancestor filter, {} rejected by their subject, {} fully matched, {} interpreted, {} matched",
+        counters.candidate_rules, counters.rejected_by_ancestor_filter, counters.rejected_by_subject, counters.fully_matched, counters.interpreted, counters.matched);
+}
+
+BENCHMARK_CASE(layout_block)
+{
+    benchmark_layout("Block layout"sv, "block"sv);
+}
+
+BENCHMARK_CASE(layout_flex)
+{
+    benchmark_layout("Flex layout"sv, "flex"sv);
+}
+
+BENCHMARK_CASE(layout_grid)
+{
+    benchmark_layout("Grid layout"sv, "grid"sv);
+}
+
+BENCHMARK_CASE(display_list_recording)
+{
+    auto html = generate_article_page(500, generate_stylesheet(200));
+    auto document = create_document(html);
+    document->update_layout();
+
+    report_per_operation("Display list recording"sv, 50, [&] {
+        document->invalidate_display_list();
+        auto display_list = document->record_display_list({});
+        AK::taint_for_optimizer(display_list);
+    });
+}
+
+BENCHMARK_CASE(skia_playback)
+{
+    auto html = generate_article_page(500, generate_stylesheet(200));
+    auto document = create_document(html);
+    document->update_layout();
+
+    auto display_list = document->record_display_list({});
+    VERIFY(display_list);
+
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, viewport_size));
+
+    report_per_operation("Skia playback"sv, 50, [&] {
+        Web::Painting::DisplayListPlayerSkia player { *bitmap };
+        player.execute(*display_list);
+    });
+}
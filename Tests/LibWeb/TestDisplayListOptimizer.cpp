@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/TextLayout.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayListOptimizer.h>
+
+using namespace Web::Painting;
+
+// The optimizer only compares fonts by identity, so glyph runs can be batched without loading a real font.
+class TestFont final : public Gfx::Font {
+public:
+    virtual Gfx::FontPixelMetrics pixel_metrics() const override { VERIFY_NOT_REACHED(); }
+    virtual u8 slope() const override { VERIFY_NOT_REACHED(); }
+    virtual float point_size() const override { VERIFY_NOT_REACHED(); }
+    virtual float pixel_size() const override { VERIFY_NOT_REACHED(); }
+    virtual int pixel_size_rounded_up() const override { VERIFY_NOT_REACHED(); }
+    virtual u16 weight() const override { VERIFY_NOT_REACHED(); }
+    virtual bool contains_glyph(u32) const override { VERIFY_NOT_REACHED(); }
+    virtual u32 glyph_id_for_code_point(u32) const override { VERIFY_NOT_REACHED(); }
+    virtual float glyph_width(u32) const override { VERIFY_NOT_REACHED(); }
+    virtual int x_height() const override { VERIFY_NOT_REACHED(); }
+    virtual float preferred_line_height() const override { VERIFY_NOT_REACHED(); }
+    virtual u8 baseline() const override { VERIFY_NOT_REACHED(); }
+    virtual float width(StringView) const override { VERIFY_NOT_REACHED(); }
+    virtual float width(Utf8View const&) const override { VERIFY_NOT_REACHED(); }
+    virtual FlyString const& family() const override { VERIFY_NOT_REACHED(); }
+    virtual NonnullRefPtr<Gfx::Font> with_size(float) const override { VERIFY_NOT_REACHED(); }
+    virtual Gfx::Typeface const& typeface() const override { VERIFY_NOT_REACHED(); }
+};
+
+static void append_fill_rect(DisplayList& display_list, Gfx::IntRect rect, Color color, Optional<i32> scroll_frame_id = {})
+{
+    display_list.append(FillRect { rect, color }, scroll_frame_id);
+}
+
+static void append_glyph_run(DisplayList& display_list, Gfx::Font& font, Vector<Gfx::DrawGlyph> glyphs, Gfx::FloatPoint translation, Color color = Color::Black)
+{
+    auto glyph_run = adopt_ref(*new Gfx::GlyphRun(move(glyphs), font, Gfx::GlyphRun::TextType::Ltr, 10));
+    display_list.append(DrawGlyphRun {
+                            .glyph_run = move(glyph_run),
+                            .scale = 2,
+                            .rect = Gfx::IntRect(translation.to_type<int>(), { 20, 20 }),
+                            .translation = translation,
+                            .color = color,
+                        },
+        {});
+}
+
+TEST_CASE(save_and_restore_without_draws_are_removed)
+{
+    auto display_list = DisplayList::create();
+    display_list->append(Save {}, {});
+    display_list->append(AddClipRect { { 0, 0, 10, 10 } }, {});
+    display_list->append(Translate { { 5, 5 } }, {});
+    display_list->append(Restore {}, {});
+    append_fill_rect(display_list, { 0, 0, 10, 10 }, Color::Red);
+
+    DisplayListOptimizationStatistics statistics;
+    optimize_display_list(display_list, &statistics);
+    EXPECT_EQ(statistics.command_count_before_optimization, 5u);
+    EXPECT_EQ(statistics.command_count_after_optimization, 1u);
+    EXPECT_EQ(display_list->commands().size(), 1u);
+    EXPECT(display_list->commands()[0].command.has<FillRect>());
+}
+
+TEST_CASE(stacking_contexts_without_draws_are_kept)
+{
+    auto display_list = DisplayList::create();
+    display_list->append(Save {}, {});
+    display_list->append(PushStackingContext { .opacity = 0.5f, .filter = {}, .source_paintable_rect = { 0, 0, 10, 10 }, .transform = {} }, {});
+    display_list->append(PopStackingContext {}, {});
+    display_list->append(Restore {}, {});
+
+    optimize_display_list(display_list);
+    EXPECT_EQ(display_list->commands().size(), 4u);
+}
+
+TEST_CASE(draws_outside_of_the_clip_are_culled)
+{
+    auto display_list = DisplayList::create();
+    display_list->append(Save {}, {});
+    display_list->append(AddClipRect { { 0, 0, 10, 10 } }, {});
+    append_fill_rect(display_list, { 20, 20, 5, 5 }, Color::Red);
+    append_fill_rect(display_list, { 0, 0, 5, 5 }, Color::Green);
+    // Draws in another scroll frame move relative to the clip, so they have to be kept.
+    append_fill_rect(display_list, { 40, 40, 5, 5 }, Color::Blue, 1);
+    append_fill_rect(display_list, { 50, 50, 0, 5 }, Color::Blue);
+    display_list->append(Restore {}, {});
+
+    DisplayListOptimizationStatistics statistics;
+    optimize_display_list(display_list, &statistics);
+    EXPECT_EQ(statistics.passes[0].removed_command_count, 2u);
+
+    auto const& commands = display_list->commands();
+    EXPECT_EQ(commands.size(), 5u);
+    EXPECT_EQ(commands[2].command.get<FillRect>().color, Color::Green);
+    EXPECT_EQ(commands[3].command.get<FillRect>().color, Color::Blue);
+}
+
+TEST_CASE(draws_beneath_opaque_fills_are_removed)
+{
+    auto display_list = DisplayList::create();
+    append_fill_rect(display_list, { 0, 0, 10, 10 }, Color::Red);
+    append_fill_rect(display_list, { 30, 0, 10, 10 }, Color::Red);
+    append_fill_rect(display_list, { 0, 0, 20, 20 }, Color::Green);
+    append_fill_rect(display_list, { 0, 0, 40, 40 }, Color(0, 0, 255, 128));
+
+    optimize_display_list(display_list);
+
+    auto const& commands = display_list->commands();
+    EXPECT_EQ(commands.size(), 3u);
+    EXPECT_EQ(commands[0].command.get<FillRect>().rect, Gfx::IntRect(30, 0, 10, 10));
+    EXPECT_EQ(commands[1].command.get<FillRect>().color, Color::Green);
+}
+
+TEST_CASE(draws_are_not_removed_across_state_changes)
+{
+    auto display_list = DisplayList::create();
+    append_fill_rect(display_list, { 0, 0, 10, 10 }, Color::Red);
+    display_list->append(Save {}, {});
+    display_list->append(AddClipRect { { 0, 0, 5, 5 } }, {});
+    append_fill_rect(display_list, { 0, 0, 20, 20 }, Color::Green);
+    display_list->append(Restore {}, {});
+
+    optimize_display_list(display_list);
+    EXPECT_EQ(display_list->commands().size(), 5u);
+}
+
+TEST_CASE(adjacent_fill_rects_are_merged)
+{
+    auto display_list = DisplayList::create();
+    append_fill_rect(display_list, { 0, 0, 10, 10 }, Color::Red);
+    append_fill_rect(display_list, { 10, 0, 10, 10 }, Color::Red);
+    append_fill_rect(display_list, { 0, 10, 20, 5 }, Color::Red);
+    // This one would not make the merged fill a rectangle.
+    append_fill_rect(display_list, { 0, 15, 5, 5 }, Color::Red);
+
+    optimize_display_list(display_list);
+
+    auto const& commands = display_list->commands();
+    EXPECT_EQ(commands.size(), 2u);
+    EXPECT_EQ(commands[0].command.get<FillRect>().rect, Gfx::IntRect(0, 0, 20, 15));
+    EXPECT_EQ(commands[1].command.get<FillRect>().rect, Gfx::IntRect(0, 15, 5, 5));
+}
+
+TEST_CASE(overlapping_translucent_fill_rects_are_not_merged)
+{
+    auto display_list = DisplayList::create();
+    auto color = Color(255, 0, 0, 128);
+    append_fill_rect(display_list, { 0, 0, 10, 10 }, color);
+    append_fill_rect(display_list, { 0, 5, 10, 10 }, color);
+
+    optimize_display_list(display_list);
+    EXPECT_EQ(display_list->commands().size(), 2u);
+}
+
+TEST_CASE(draws_are_only_checked_for_occlusion_by_nearby_fills)
+{
+    for (size_t draws_in_between : { 31u, 32u }) {
+        auto display_list = DisplayList::create();
+        append_fill_rect(display_list, { 0, 0, 10, 10 }, Color::Red);
+        for (size_t i = 0; i < draws_in_between; ++i)
+            append_fill_rect(display_list, { 100 + static_cast<int>(i) * 20, 0, 5, 5 }, Color::Blue);
+        append_fill_rect(display_list, { 0, 0, 10, 10 }, Color::Green);
+
+        optimize_display_list(display_list);
+
+        // The red fill is covered, but once it's more than 32 draws back it's no longer checked.
+        EXPECT_EQ(display_list->commands().size(), draws_in_between == 31 ? 32u : 34u);
+    }
+}
+
+TEST_CASE(adjacent_glyph_runs_are_batched)
+{
+    auto font = adopt_ref(*new TestFont);
+    auto display_list = DisplayList::create();
+    append_glyph_run(display_list, font, { { { 0, 0 }, 1 }, { { 5, 0 }, 2 } }, { 10, 20 });
+    append_glyph_run(display_list, font, { { { 0, 0 }, 3 } }, { 50, 20 });
+    append_glyph_run(display_list, font, { { { 1, 2 }, 4 } }, { 10, 60 });
+    // A glyph run in another color can't be drawn in the same batch.
+    append_glyph_run(display_list, font, { { { 0, 0 }, 5 } }, { 90, 20 }, Color::Red);
+    NonnullRefPtr first_glyph_run = display_list->commands()[0].command.get<DrawGlyphRun>().glyph_run;
+
+    optimize_display_list(display_list);
+
+    auto const& commands = display_list->commands();
+    EXPECT_EQ(commands.size(), 2u);
+
+    // The batched glyphs are positioned relative to the first run's translation, in units unscaled by the runs' scale.
+    auto const& batched_draw = commands[0].command.get<DrawGlyphRun>();
+    EXPECT_EQ(batched_draw.translation, Gfx::FloatPoint(10, 20));
+    EXPECT_EQ(batched_draw.rect, Gfx::IntRect(10, 20, 60, 60));
+    auto const& glyphs = batched_draw.glyph_run->glyphs();
+    EXPECT_EQ(glyphs.size(), 4u);
+    Array<Gfx::FloatPoint, 4> expected_positions { Gfx::FloatPoint { 0, 0 }, { 5, 0 }, { 20, 0 }, { 1, 22 } };
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        EXPECT_EQ(glyphs[i].glyph_id, i + 1);
+        EXPECT_EQ(glyphs[i].position, expected_positions[i]);
+    }
+
+    // The glyph run that was batched into is shared with a paintable, so it must not change.
+    EXPECT_EQ(first_glyph_run->glyphs().size(), 2u);
+    EXPECT_NE(batched_draw.glyph_run.ptr(), first_glyph_run.ptr());
+
+    EXPECT_EQ(commands[1].command.get<DrawGlyphRun>().color, Color::Red);
+}
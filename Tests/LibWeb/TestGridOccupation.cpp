@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Layout/GridFormattingContext.h>
+
+using namespace Web::Layout;
+
+// Keeps occupied cells in a hash table and probes them one at a time, which is easy to get right.
+class ReferenceOccupationGrid {
+public:
+    ReferenceOccupationGrid(size_t columns_count, size_t rows_count)
+        : m_max_column_index(max(0, static_cast<int>(columns_count) - 1))
+        , m_max_row_index(max(0, static_cast<int>(rows_count) - 1))
+    {
+    }
+
+    void set_occupied(int column_start, int column_end, int row_start, int row_end)
+    {
+        for (int row_index = row_start; row_index < row_end; row_index++) {
+            for (int column_index = column_start; column_index < column_end; column_index++) {
+                m_min_column_index = min(m_min_column_index, column_index);
+                m_max_column_index = max(m_max_column_index, column_index);
+                m_min_row_index = min(m_min_row_index, row_index);
+                m_max_row_index = max(m_max_row_index, row_index);
+                m_cells.set(cell_key(column_index, row_index));
+            }
+        }
+    }
+
+    bool is_occupied(int column_index, int row_index) const { return m_cells.contains(cell_key(column_index, row_index)); }
+
+    int first_unoccupied_column_in_row(int row_index, int column_index) const
+    {
+        while (is_occupied(column_index, row_index))
+            column_index++;
+        return column_index;
+    }
+
+    FoundUnoccupiedPlace find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span) const
+    {
+        if (dimension == GridDimension::Column) {
+            while (row_index <= m_max_row_index) {
+                while (column_index <= m_max_column_index) {
+                    auto enough_span_for_span = column_index + column_span - 1 <= m_max_column_index;
+                    if (enough_span_for_span && !is_occupied(column_index, row_index))
+                        return FoundUnoccupiedPlace::Yes;
+                    column_index++;
+                }
+                row_index++;
+                column_index = m_min_column_index;
+            }
+        } else {
+            while (column_index <= m_max_column_index) {
+                while (row_index <= m_max_row_index) {
+                    auto enough_span_for_span = row_index + row_span - 1 <= m_max_row_index;
+                    if (enough_span_for_span && !is_occupied(column_index, row_index))
+                        return FoundUnoccupiedPlace::Yes;
+                    row_index++;
+                }
+                column_index++;
+                row_index = m_min_row_index;
+            }
+        }
+        return FoundUnoccupiedPlace::No;
+    }
+
+    int min_column_index() const { return m_min_column_index; }
+    int max_column_index() const { return m_max_column_index; }
+    int min_row_index() const { return m_min_row_index; }
+    int max_row_index() const { return m_max_row_index; }
+
+private:
+    static u64 cell_key(int column_index, int row_index) { return (static_cast<u64>(static_cast<u32>(row_index)) << 32) | static_cast<u32>(column_index); }
+
+    HashTable<u64> m_cells;
+    int m_min_column_index { 0 };
+    int m_max_column_index { 0 };
+    int m_min_row_index { 0 };
+    int m_max_row_index { 0 };
+};
+
+// A fixed xorshift generator, so that failures can be reproduced.
+class Random {
+public:
+    int next(int min, int max)
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return min + static_cast<int>(m_state % static_cast<u64>(max - min + 1));
+    }
+
+private:
+    u64 m_state { 0x2545f4914f6cdd1dULL };
+};
+
+static void expect_same_occupancy(OccupationGrid const& grid, ReferenceOccupationGrid const& reference, Random& random)
+{
+    EXPECT_EQ(grid.min_column_index(), reference.min_column_index());
+    EXPECT_EQ(grid.max_column_index(), reference.max_column_index());
+    EXPECT_EQ(grid.min_row_index(), reference.min_row_index());
+    EXPECT_EQ(grid.max_row_index(), reference.max_row_index());
+
+    for (int row_index = reference.min_row_index() - 1; row_index <= reference.max_row_index() + 1; row_index++) {
+        for (int column_index = reference.min_column_index() - 1; column_index <= reference.max_column_index() + 1; column_index++) {
+            EXPECT_EQ(grid.is_occupied(column_index, row_index), reference.is_occupied(column_index, row_index));
+            EXPECT_EQ(grid.first_unoccupied_column_in_row(row_index, column_index), reference.first_unoccupied_column_in_row(row_index, column_index));
+        }
+    }
+
+    for (auto dimension : { GridDimension::Column, GridDimension::Row }) {
+        for (size_t i = 0; i < 8; i++) {
+            auto column_index = random.next(reference.min_column_index(), reference.max_column_index());
+            auto row_index = random.next(reference.min_row_index(), reference.max_row_index());
+            auto column_span = random.next(1, 4);
+            auto row_span = random.next(1, 4);
+
+            auto reference_column_index = column_index;
+            auto reference_row_index = row_index;
+            auto found = grid.find_unoccupied_place(dimension, column_index, row_index, column_span, row_span);
+            auto reference_found = reference.find_unoccupied_place(dimension, reference_column_index, reference_row_index, column_span, row_span);
+            EXPECT_EQ(found, reference_found);
+            if (found == FoundUnoccupiedPlace::Yes) {
+                EXPECT_EQ(column_index, reference_column_index);
+                EXPECT_EQ(row_index, reference_row_index);
+            }
+        }
+    }
+}
+
+TEST_CASE(occupation_grid_matches_reference_on_random_placements)
+{
+    Random random;
+    for (size_t grid_index = 0; grid_index < 50; grid_index++) {
+        auto columns_count = static_cast<size_t>(random.next(1, 10));
+        auto rows_count = static_cast<size_t>(random.next(1, 5));
+        OccupationGrid grid(columns_count, rows_count);
+        ReferenceOccupationGrid reference(columns_count, rows_count);
+
+        for (size_t item_index = 0; item_index < 40; item_index++) {
+            // Most items are placed near the origin, some far enough out to need more than one word per row.
+            auto column_start = random.next(0, 3) == 0 ? random.next(-5, 150) : random.next(-2, 12);
+            auto row_start = random.next(-3, 12);
+            auto column_end = column_start + random.next(0, 4);
+            auto row_end = row_start + random.next(0, 3);
+            grid.set_occupied(column_start, column_end, row_start, row_end);
+            reference.set_occupied(column_start, column_end, row_start, row_end);
+            expect_same_occupancy(grid, reference, random);
+        }
+    }
+}
+
+TEST_CASE(occupation_grid_finds_free_cells_behind_filled_rows)
+{
+    OccupationGrid grid(200, 2);
+    grid.set_occupied(0, 130, 0, 1);
+    EXPECT_EQ(grid.first_unoccupied_column_in_row(0, 0), 130);
+    EXPECT_EQ(grid.first_unoccupied_column_in_row(1, 0), 0);
+
+    grid.set_occupied(130, 131, 0, 1);
+    EXPECT_EQ(grid.first_unoccupied_column_in_row(0, 0), 131);
+
+    int column_index = 0;
+    int row_index = 0;
+    EXPECT_EQ(grid.find_unoccupied_place(GridDimension::Column, column_index, row_index, 70, 1), FoundUnoccupiedPlace::Yes);
+    EXPECT_EQ(column_index, 0);
+    EXPECT_EQ(row_index, 1);
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+using Web::IndexedDB::Key;
+using Web::IndexedDB::KeyRange;
+
+// Compares like SQLite compares blobs.
+static int compare_bytes(ReadonlyBytes a, ReadonlyBytes b)
+{
+    auto length = min(a.size(), b.size());
+    if (auto result = length == 0 ? 0 : __builtin_memcmp(a.data(), b.data(), length); result != 0)
+        return result < 0 ? -1 : 1;
+    if (a.size() == b.size())
+        return 0;
+    return a.size() < b.size() ? -1 : 1;
+}
+
+static int compare_serialized(Key const& a, Key const& b)
+{
+    return compare_bytes(MUST(a.serialize()), MUST(b.serialize()));
+}
+
+static ByteBuffer bytes(Vector<u8> values)
+{
+    return MUST(ByteBuffer::copy(values.span()));
+}
+
+// Keys in ascending order, according to https://w3c.github.io/IndexedDB/#compare-two-keys
+static Vector<Key> ordered_keys()
+{
+    return {
+        Key::create_number(-AK::Infinity<double>),
+        Key::create_number(-1e300),
+        Key::create_number(-1),
+        Key::create_number(-1e-300),
+        Key::create_number(0),
+        Key::create_number(1e-300),
+        Key::create_number(1),
+        Key::create_number(2),
+        Key::create_number(1e300),
+        Key::create_number(AK::Infinity<double>),
+        Key::create_date(-1),
+        Key::create_date(0),
+        Key::create_date(1700000000000),
+        Key::create_string(""_string),
+        Key::create_string("\0"_string),
+        Key::create_string("\0\0"_string),
+        Key::create_string("\0a"_string),
+        Key::create_string("a"_string),
+        Key::create_string("a\0"_string),
+        Key::create_string("aa"_string),
+        Key::create_string("b"_string),
+        Key::create_string("é"_string),
+        // Supplementary code points are encoded as surrogates, so they sort before U+E000..U+FFFF.
+        Key::create_string("\U0001F600"_string),
+        Key::create_string("￿"_string),
+        Key::create_binary(bytes({})),
+        Key::create_binary(bytes({ 0x00 })),
+        Key::create_binary(bytes({ 0x00, 0x00 })),
+        Key::create_binary(bytes({ 0x00, 0xff })),
+        Key::create_binary(bytes({ 0x01 })),
+        Key::create_binary(bytes({ 0xff })),
+        Key::create_binary(bytes({ 0xff, 0xff })),
+        Key::create_array({}),
+        Key::create_array({ Key::create_number(0) }),
+        Key::create_array({ Key::create_number(0), Key::create_number(0) }),
+        Key::create_array({ Key::create_number(1) }),
+        Key::create_array({ Key::create_string("a"_string) }),
+        Key::create_array({ Key::create_string("a"_string), Key::create_number(0) }),
+        Key::create_array({ Key::create_string("a\0"_string) }),
+        Key::create_array({ Key::create_array({}) }),
+        Key::create_array({ Key::create_array({ Key::create_number(0) }) }),
+    };
+}
+
+TEST_CASE(compare_two_keys)
+{
+    auto keys = ordered_keys();
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        for (size_t j = 0; j < keys.size(); ++j) {
+            auto expected = i < j ? -1 : (i > j ? 1 : 0);
+            EXPECT_EQ(Key::compare_two_keys(keys[i], keys[j]), expected);
+        }
+    }
+
+    EXPECT_EQ(Key::compare_two_keys(Key::create_number(-0.0), Key::create_number(0.0)), 0);
+}
+
+TEST_CASE(serialized_keys_compare_like_keys)
+{
+    auto keys = ordered_keys();
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        for (size_t j = 0; j < keys.size(); ++j) {
+            auto expected = i < j ? -1 : (i > j ? 1 : 0);
+            EXPECT_EQ(compare_serialized(keys[i], keys[j]), expected);
+        }
+    }
+
+    EXPECT_EQ(compare_serialized(Key::create_number(-0.0), Key::create_number(0.0)), 0);
+}
+
+TEST_CASE(serialize_round_trip)
+{
+    for (auto const& key : ordered_keys()) {
+        auto deserialized = MUST(Key::deserialize(MUST(key.serialize())));
+        EXPECT_EQ(deserialized.type(), key.type());
+        EXPECT_EQ(Key::compare_two_keys(deserialized, key), 0);
+    }
+
+    EXPECT(Key::deserialize({}).is_error());
+    EXPECT(Key::deserialize(bytes({ 0x10, 0x80 })).is_error());
+    EXPECT(Key::deserialize(bytes({ 0x30, 0x00, 0x61 })).is_error());
+    EXPECT(Key::deserialize(bytes({ 0x50, 0x10 })).is_error());
+    EXPECT(Key::deserialize(bytes({ 0x40, 0x00, 0x00 })).is_error());
+}
+
+TEST_CASE(key_range)
+{
+    auto keys = ordered_keys();
+    auto const& lower = keys[5];
+    auto const& upper = keys[20];
+
+    auto check_range = [&](KeyRange const& range) {
+        auto bounds = MUST(range.serialize_bounds());
+
+        for (auto const& key : keys) {
+            auto serialized = MUST(key.serialize());
+            auto in_serialized_range = compare_bytes(serialized, bounds.lower) >= 0 && compare_bytes(serialized, bounds.upper) < 0;
+            EXPECT_EQ(range.is_in_range(key), in_serialized_range);
+        }
+    };
+
+    for (auto lower_open : { false, true }) {
+        for (auto upper_open : { false, true }) {
+            check_range({ .lower = lower, .upper = upper, .lower_open = lower_open, .upper_open = upper_open });
+            check_range({ .lower = lower, .upper = {}, .lower_open = lower_open, .upper_open = upper_open });
+            check_range({ .lower = {}, .upper = upper, .lower_open = lower_open, .upper_open = upper_open });
+        }
+    }
+    check_range({});
+
+    auto only = KeyRange::only(lower);
+    for (auto const& key : keys)
+        EXPECT_EQ(only.is_in_range(key), Key::compare_two_keys(key, lower) == 0);
+}
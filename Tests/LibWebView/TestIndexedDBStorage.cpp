@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWebView/Database.h>
+#include <LibWebView/IndexedDBStorage.h>
+
+using Web::IndexedDB::Key;
+using Web::IndexedDB::KeyRange;
+using WebView::IndexedDBStorage;
+
+static ByteBuffer serialize(Key const& key)
+{
+    return MUST(key.serialize());
+}
+
+static ByteBuffer value(StringView string)
+{
+    return MUST(ByteBuffer::copy(string.bytes()));
+}
+
+static IndexedDBStorage::KeyBounds bounds(KeyRange const& range)
+{
+    auto bounds = MUST(range.serialize_bounds());
+    return { move(bounds.lower), move(bounds.upper) };
+}
+
+static IndexedDBStorage::KeyBounds unbounded()
+{
+    return bounds({});
+}
+
+static IndexedDBStorage::ObjectStoreID const object_store { "https://example.com"_string, "database"_string, "store"_string };
+
+TEST_CASE(put_and_get)
+{
+    auto database = MUST(WebView::Database::create_memory_backed());
+    auto storage = MUST(IndexedDBStorage::create(*database));
+
+    auto key = serialize(Key::create_string("key"_string));
+
+    storage->write(object_store, { IndexedDBStorage::PutOperation { MUST(ByteBuffer::copy(key)), value("first"sv), {} } });
+    EXPECT(storage->get(object_store, key) == value("first"sv));
+
+    storage->write(object_store, { IndexedDBStorage::PutOperation { MUST(ByteBuffer::copy(key)), value("second"sv), {} } });
+    EXPECT(storage->get(object_store, key) == value("second"sv));
+    EXPECT_EQ(storage->count(object_store, unbounded()), 1);
+
+    // Records of other object stores are separate.
+    IndexedDBStorage::ObjectStoreID other_object_store { "https://example.com"_string, "database"_string, "other"_string };
+    EXPECT(!storage->get(other_object_store, key).has_value());
+    EXPECT_EQ(storage->count(other_object_store, unbounded()), 0);
+}
+
+TEST_CASE(records_are_in_key_order)
+{
+    auto database = MUST(WebView::Database::create_memory_backed());
+    auto storage = MUST(IndexedDBStorage::create(*database));
+
+    // Insert in an order that differs from both key order and the order of the keys' (unserialized) bit patterns.
+    Vector<double> numbers { 3, -1, 100, 0, -250, 0.5, 42 };
+
+    Vector<IndexedDBStorage::Operation> operations;
+    for (auto number : numbers)
+        operations.append(IndexedDBStorage::PutOperation { serialize(Key::create_number(number)), value("number"sv), {} });
+    operations.append(IndexedDBStorage::PutOperation { serialize(Key::create_string("a"_string)), value("string"sv), {} });
+    storage->write(object_store, operations);
+
+    auto records = storage->get_all(object_store, unbounded());
+    EXPECT_EQ(records.size(), 8u);
+
+    auto sorted_numbers = numbers;
+    quick_sort(sorted_numbers);
+
+    for (size_t i = 0; i < sorted_numbers.size(); ++i) {
+        auto key = MUST(Key::deserialize(records[i].key));
+        EXPECT_EQ(key.type(), Key::Type::Number);
+        EXPECT_EQ(key.value_as_double(), sorted_numbers[i]);
+    }
+    EXPECT_EQ(MUST(Key::deserialize(records[7].key)).type(), Key::Type::String);
+
+    auto reversed = storage->get_all(object_store, unbounded(), IndexedDBStorage::Direction::Prev, 2);
+    EXPECT_EQ(reversed.size(), 2u);
+    EXPECT(reversed[0].key == records[7].key);
+    EXPECT(reversed[1].key == records[6].key);
+
+    KeyRange range;
+    range.lower = Key::create_number(0);
+    range.upper = Key::create_number(42);
+    range.lower_open = true;
+
+    auto in_range = storage->get_all(object_store, bounds(range));
+    EXPECT_EQ(in_range.size(), 3u);
+    EXPECT_EQ(MUST(Key::deserialize(in_range[0].key)).value_as_double(), 0.5);
+    EXPECT_EQ(MUST(Key::deserialize(in_range[2].key)).value_as_double(), 42);
+    EXPECT_EQ(storage->count(object_store, bounds(range)), 3);
+}
+
+TEST_CASE(delete_range)
+{
+    auto database = MUST(WebView::Database::create_memory_backed());
+    auto storage = MUST(IndexedDBStorage::create(*database));
+
+    Vector<IndexedDBStorage::Operation> operations;
+    for (auto i = 0; i < 10; ++i)
+        operations.append(IndexedDBStorage::PutOperation { serialize(Key::create_number(i)), value("value"sv), {} });
+    storage->write(object_store, operations);
+
+    KeyRange range;
+    range.lower = Key::create_number(2);
+    range.upper = Key::create_number(5);
+    storage->write(object_store, { IndexedDBStorage::DeleteOperation { bounds(range) } });
+
+    EXPECT_EQ(storage->count(object_store, unbounded()), 6);
+    EXPECT(!storage->get(object_store, serialize(Key::create_number(2))).has_value());
+    EXPECT(!storage->get(object_store, serialize(Key::create_number(5))).has_value());
+    EXPECT(storage->get(object_store, serialize(Key::create_number(6))).has_value());
+}
+
+TEST_CASE(index_records)
+{
+    auto database = MUST(WebView::Database::create_memory_backed());
+    auto storage = MUST(IndexedDBStorage::create(*database));
+
+    auto put = [&](double primary_key, StringView name) {
+        Vector<IndexedDBStorage::IndexKey> index_keys;
+        index_keys.append({ "name"_string, serialize(Key::create_string(MUST(String::from_utf8(name)))) });
+
+        storage->write(object_store, { IndexedDBStorage::PutOperation { serialize(Key::create_number(primary_key)), value(name), move(index_keys) } });
+    };
+
+    put(1, "carol"sv);
+    put(2, "alice"sv);
+    put(3, "bob"sv);
+    put(4, "alice"sv);
+
+    auto records = storage->get_all_from_index(object_store, "name"_string, unbounded());
+    EXPECT_EQ(records.size(), 4u);
+    EXPECT(records[0].value == value("alice"sv));
+    EXPECT_EQ(MUST(Key::deserialize(records[0].primary_key)).value_as_double(), 2);
+    EXPECT_EQ(MUST(Key::deserialize(records[1].primary_key)).value_as_double(), 4);
+    EXPECT(records[2].value == value("bob"sv));
+    EXPECT(records[3].value == value("carol"sv));
+
+    // Replacing a record must drop the index entries of its previous value.
+    put(2, "dave"sv);
+
+    auto alices = storage->get_all_from_index(object_store, "name"_string, bounds(KeyRange::only(Key::create_string("alice"_string))));
+    EXPECT_EQ(alices.size(), 1u);
+    EXPECT_EQ(MUST(Key::deserialize(alices[0].primary_key)).value_as_double(), 4);
+
+    // As must deleting it.
+    storage->write(object_store, { IndexedDBStorage::DeleteOperation { bounds(KeyRange::only(Key::create_number(4))) } });
+    EXPECT(storage->get_all_from_index(object_store, "name"_string, bounds(KeyRange::only(Key::create_string("alice"_string)))).is_empty());
+
+    auto reversed = storage->get_all_from_index(object_store, "name"_string, unbounded(), IndexedDBStorage::Direction::Prev, 1);
+    EXPECT_EQ(reversed.size(), 1u);
+    EXPECT(reversed[0].value == value("dave"sv));
+}
+
+TEST_CASE(cursor)
+{
+    auto database = MUST(WebView::Database::create_memory_backed());
+    auto storage = MUST(IndexedDBStorage::create(*database));
+
+    Vector<IndexedDBStorage::Operation> operations;
+    for (auto string : { "a"sv, "ab"sv, "b"sv, "ba"sv })
+        operations.append(IndexedDBStorage::PutOperation { serialize(Key::create_string(MUST(String::from_utf8(string)))), value(string), {} });
+    storage->write(object_store, operations);
+
+    Vector<ByteBuffer> values;
+    Optional<ByteBuffer> position;
+
+    while (true) {
+        Optional<IndexedDBStorage::Record> record;
+        if (position.has_value()) {
+            record = storage->continue_cursor(object_store, unbounded(), IndexedDBStorage::Direction::Next, *position);
+        } else {
+            auto first = storage->get_all(object_store, unbounded(), IndexedDBStorage::Direction::Next, 1);
+            if (!first.is_empty())
+                record = first.take_first();
+        }
+        if (!record.has_value())
+            break;
+
+        position = move(record->key);
+        values.append(move(record->value));
+    }
+
+    EXPECT_EQ(values.size(), 4u);
+    EXPECT(values[0] == value("a"sv));
+    EXPECT(values[1] == value("ab"sv));
+    EXPECT(values[2] == value("b"sv));
+    EXPECT(values[3] == value("ba"sv));
+
+    auto previous = storage->continue_cursor(object_store, unbounded(), IndexedDBStorage::Direction::Prev, serialize(Key::create_string("b"_string)));
+    EXPECT(previous.has_value());
+    EXPECT(previous->value == value("ab"sv));
+}
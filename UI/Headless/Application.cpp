@@ -46,6 +46,7 @@ void Application::create_platform_arguments(Core::ArgsParser& args_parser)
     args_parser.add_option(rebaseline, "Rebaseline any executed layout or text tests", "rebaseline");
     args_parser.add_option(per_test_timeout_in_seconds, "Per-test timeout (default: 30)", "per-test-timeout", 't', "seconds");
     args_parser.add_option(verbose, "Log extra information about test results", "verbose", 'v');
+    args_parser.add_option(performance_trace_path, "Load the given page (or every page in the given directory) and write a Chrome trace of it to [path]", "perf-trace", 0, "path");
     args_parser.add_option(width, "Set viewport width in pixels (default: 800)", "width", 'W', "pixels");
     args_parser.add_option(height, "Set viewport height in pixels (default: 600)", "height", 'H', "pixels");
 }
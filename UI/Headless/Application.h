@@ -59,6 +59,7 @@ public:
     bool rebaseline { false };
     bool verbose { false };
     int per_test_timeout_in_seconds { 30 };
+    ByteString performance_trace_path;
     int width { 800 };
     int height { 600 };
 
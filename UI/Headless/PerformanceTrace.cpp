@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/Environment.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/PerformanceTrace.h>
+#include <LibCore/Timer.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibURL/URL.h>
+#include <UI/Headless/HeadlessWebView.h>
+#include <UI/Headless/PerformanceTrace.h>
+
+namespace Ladybird {
+
+static Vector<URL::URL> s_pages;
+static size_t s_next_page { 0 };
+static Optional<MonotonicTime> s_page_load_start;
+static RefPtr<Core::Timer> s_page_load_timeout;
+
+ErrorOr<NonnullOwnPtr<FileSystem::TempFile>> enable_performance_tracing()
+{
+    auto trace_directory = TRY(FileSystem::TempFile::create_temp_directory());
+    TRY(Core::Environment::set(Core::PerformanceTrace::directory_environment_variable, trace_directory->path(), Core::Environment::Overwrite::Yes));
+    return trace_directory;
+}
+
+static ErrorOr<Vector<URL::URL>> collect_pages(URL::URL const& url)
+{
+    if (url.scheme() != "file"sv)
+        return Vector { url };
+
+    auto path = URL::percent_decode(url.serialize_path());
+    if (!FileSystem::is_directory(path))
+        return Vector { url };
+
+    Vector<ByteString> paths;
+
+    Core::DirIterator it(path, Core::DirIterator::Flags::SkipDots);
+    while (it.has_next()) {
+        auto page_path = it.next_full_path();
+        if (page_path.ends_with(".html"sv) && !FileSystem::is_directory(page_path))
+            TRY(paths.try_append(TRY(FileSystem::real_path(page_path))));
+    }
+
+    // Load the pages in a stable order, so that traces of separate runs can be compared with each other.
+    quick_sort(paths);
+
+    Vector<URL::URL> pages;
+    for (auto const& page_path : paths)
+        TRY(pages.try_append(URL::create_with_file_scheme(page_path)));
+
+    return pages;
+}
+
+static void load_next_page(HeadlessWebView& view)
+{
+    if (s_next_page == s_pages.size()) {
+        s_page_load_timeout->stop();
+        Core::EventLoop::current().quit(0);
+        return;
+    }
+
+    auto const& url = s_pages[s_next_page++];
+    outln("Loading {}", url);
+
+    s_page_load_start = MonotonicTime::now();
+    s_page_load_timeout->restart();
+    view.load(url);
+}
+
+static void finish_page_load(HeadlessWebView& view, URL::URL const& url)
+{
+    s_page_load_timeout->stop();
+    Core::PerformanceTrace::record_span("page"sv, "page-load"sv, *s_page_load_start, MonotonicTime::now(), url.serialize());
+
+    Core::deferred_invoke([&view]() {
+        load_next_page(view);
+    });
+}
+
+ErrorOr<void> run_performance_trace(HeadlessWebView& view, URL::URL const& url, int timeout_in_milliseconds)
+{
+    s_pages = TRY(collect_pages(url));
+    if (s_pages.is_empty())
+        return Error::from_string_literal("No pages to load");
+
+    s_page_load_timeout = Core::Timer::create_single_shot(timeout_in_milliseconds, [&view]() {
+        auto const& url = s_pages[s_next_page - 1];
+        warnln("Timed out loading {}", url);
+        finish_page_load(view, url);
+    });
+
+    view.on_load_finish = [&view](URL::URL const& loaded_url) {
+        // Only the top-level page we asked for counts, not e.g. a redirect that is still in flight.
+        if (s_next_page == 0 || loaded_url != s_pages[s_next_page - 1])
+            return;
+        finish_page_load(view, loaded_url);
+    };
+
+    load_next_page(view);
+    return {};
+}
+
+ErrorOr<void> write_performance_trace(StringView trace_directory, StringView output_path)
+{
+    JsonArray events;
+    HashMap<ByteString, i64> microseconds_per_category;
+
+    Core::DirIterator it(trace_directory, Core::DirIterator::Flags::SkipDots);
+    while (it.has_next()) {
+        auto trace_path = it.next_full_path();
+        if (LexicalPath { trace_path }.extension() != Core::PerformanceTrace::file_extension)
+            continue;
+
+        auto trace_file = TRY(Core::File::open(trace_path, Core::File::OpenMode::Read));
+        auto contents = TRY(trace_file->read_until_eof());
+
+        for (auto line : StringView { contents }.lines()) {
+            // A process that crashed in the middle of a write may have left a truncated last line behind.
+            auto event = JsonValue::from_string(line);
+            if (event.is_error() || !event.value().is_object())
+                continue;
+
+            auto const& object = event.value().as_object();
+            if (object.get_byte_string("ph"sv) == "X"sv) {
+                auto category = object.get_byte_string("cat"sv).value_or({});
+                auto duration = object.get_integer<i64>("dur"sv).value_or(0);
+                microseconds_per_category.ensure(category, [] { return 0; }) += duration;
+            }
+
+            TRY(events.append(event.release_value()));
+        }
+    }
+
+    JsonObject trace;
+    trace.set("traceEvents"sv, move(events));
+
+    auto serialized_trace = trace.serialized<StringBuilder>();
+    auto output_file = TRY(Core::File::open(output_path, Core::File::OpenMode::Write));
+    TRY(output_file->write_until_depleted(serialized_trace.bytes()));
+
+    Vector<ByteString> categories;
+    for (auto const& it : microseconds_per_category)
+        TRY(categories.try_append(it.key));
+    quick_sort(categories, [&](auto const& a, auto const& b) {
+        return microseconds_per_category.get(a).value() > microseconds_per_category.get(b).value();
+    });
+
+    outln("Wrote performance trace to {}", output_path);
+    outln("Total time per category:");
+    for (auto const& category : categories)
+        outln("    {:20} {:10.2} ms", category, static_cast<double>(microseconds_per_category.get(category).value()) / 1000.0);
+
+    return {};
+}
+
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/StringView.h>
+#include <LibFileSystem/TempFile.h>
+#include <LibURL/Forward.h>
+
+namespace Ladybird {
+
+class HeadlessWebView;
+
+// Must be called before any helper process is launched, so that they all inherit the trace directory.
+ErrorOr<NonnullOwnPtr<FileSystem::TempFile>> enable_performance_tracing();
+
+// Loads the given URL (or every HTML file in it, if it refers to a local directory) one page after the other,
+// and quits the event loop once the last page has finished loading.
+ErrorOr<void> run_performance_trace(HeadlessWebView&, URL::URL const&, int timeout_in_milliseconds);
+
+// Merges the per-process traces into a single Chrome trace file, and prints the total time spent in each category.
+ErrorOr<void> write_performance_trace(StringView trace_directory, StringView output_path);
+
+}
@@ -17,6 +17,7 @@
 #include <LibCore/ResourceImplementationFile.h>
 #include <LibCore/Timer.h>
 #include <LibFileSystem/FileSystem.h>
+#include <LibFileSystem/TempFile.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
 #include <LibGfx/SystemTheme.h>
@@ -24,6 +25,7 @@
 #include <LibWebView/Utilities.h>
 #include <UI/Headless/Application.h>
 #include <UI/Headless/HeadlessWebView.h>
+#include <UI/Headless/PerformanceTrace.h>
 #include <UI/Headless/Test.h>
 
 static ErrorOr<NonnullRefPtr<Core::Timer>> load_page_for_screenshot_and_exit(Core::EventLoop& event_loop, Ladybird::HeadlessWebView& view, URL::URL const& url, int screenshot_timeout)
@@ -64,6 +66,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     WebView::platform_init();
 
     auto app = Ladybird::Application::create(arguments, "about:newtab"sv);
+
+    OwnPtr<FileSystem::TempFile> performance_trace_directory;
+    if (!app->performance_trace_path.is_empty())
+        performance_trace_directory = TRY(Ladybird::enable_performance_tracing());
+
     TRY(app->launch_services());
 
     Core::ResourceImplementation::install(make<Core::ResourceImplementationFile>(MUST(String::from_byte_string(app->resources_folder))));
@@ -90,6 +97,15 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         return Error::from_string_literal("Invalid URL");
     }
 
+    if (performance_trace_directory) {
+        app->performance_trace_path = LexicalPath::absolute_path(TRY(FileSystem::current_working_directory()), app->performance_trace_path);
+        TRY(Ladybird::run_performance_trace(view, url, app->per_test_timeout_in_seconds * 1000));
+
+        auto result = app->execute();
+        TRY(Ladybird::write_performance_trace(performance_trace_directory->path(), app->performance_trace_path));
+        return result;
+    }
+
     if (app->dump_layout_tree || app->dump_text) {
         Ladybird::Test test { app->dump_layout_tree ? Ladybird::TestMode::Layout : Ladybird::TestMode::Text };
         Ladybird::run_dump_test(view, test, url, app->per_test_timeout_in_seconds * 1000);
@@ -437,6 +437,12 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         debug_request("dump-local-storage");
     });
 
+    auto* dump_task_queue_statistics_action = new QAction("Dump &Task Queue Statistics", this);
+    debug_menu->addAction(dump_task_queue_statistics_action);
+    QObject::connect(dump_task_queue_statistics_action, &QAction::triggered, this, [this] {
+        debug_request("dump-task-queue-statistics");
+    });
+
     debug_menu->addSeparator();
 
     m_show_line_box_borders_action = new QAction("Show Line Box Borders", this);